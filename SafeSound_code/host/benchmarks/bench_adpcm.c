@@ -0,0 +1,77 @@
+// Times the IMA ADPCM encoder on its own and the audio history as the main loop feeds it, one
+// frame at a time, and prints the memory the history takes per microphone.
+//
+//   bench_adpcm [seconds of audio]
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "adpcm.h"
+#include "audio_history.h"
+#include "common.h"
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : 60.0;
+	// one second of audio, encoded over and over
+	static short audio[AUDIO_SAMPLE_RATE + ADPCM_BLOCK_SAMPLES];
+	srand(1);
+	for (int i = 0; i < (int)(sizeof(audio) / sizeof(audio[0])); ++i) {
+		audio[i] = (short)(8000 * sin(2 * 3.14159265358979 * 440.0 * i / AUDIO_SAMPLE_RATE) + (rand() % 801 - 400));
+	}
+	const int rounds = (int)(seconds + 0.5);
+	if (rounds < 1) {
+		return 1;
+	}
+	printf("IMA ADPCM, %d-byte blocks of %d samples, %d s of audio\n", ADPCM_BLOCK_BYTES,
+		ADPCM_BLOCK_SAMPLES, rounds);
+	printf("%-16s %12s %12s\n", "", "ns/sample", "ms/s audio");
+
+	AdpcmEncoder encoder;
+	adpcm_encoder_init(&encoder);
+	static unsigned char block[ADPCM_BLOCK_BYTES];
+	const int blocksPerRound = AUDIO_SAMPLE_RATE / ADPCM_BLOCK_SAMPLES;
+	unsigned int checksum = 0;
+	long long start = NowNs();
+	for (int round = 0; round < rounds; ++round) {
+		for (int b = 0; b < blocksPerRound; ++b) {
+			adpcm_encode_block(&encoder, audio + b * ADPCM_BLOCK_SAMPLES, block);
+			checksum += block[ADPCM_BLOCK_BYTES - 1];
+		}
+	}
+	long long elapsedNs = NowNs() - start;
+	long long samples = (long long)rounds * blocksPerRound * ADPCM_BLOCK_SAMPLES;
+	printf("%-16s %12.1f %12.3f\n", "encoder", (double)elapsedNs / (double)samples,
+		(double)elapsedNs / 1e6 * AUDIO_SAMPLE_RATE / (double)samples);
+
+	AudioHistory history;
+	audio_history_init(&history);
+	const int framesPerRound = AUDIO_SAMPLE_RATE / AUDIO_FRAME_SIZE;
+	start = NowNs();
+	for (int round = 0; round < rounds; ++round) {
+		for (int frame = 0; frame < framesPerRound; ++frame) {
+			audio_history_append(&history, audio + frame * AUDIO_FRAME_SIZE, AUDIO_FRAME_SIZE, NULL);
+		}
+	}
+	elapsedNs = NowNs() - start;
+	if (history.blocks == NULL) {
+		return 1;
+	}
+	samples = (long long)rounds * framesPerRound * AUDIO_FRAME_SIZE;
+	printf("%-16s %12.1f %12.3f\n", "history", (double)elapsedNs / (double)samples,
+		(double)elapsedNs / 1e6 * AUDIO_SAMPLE_RATE / (double)samples);
+	audio_history_free(&history);
+
+	printf("History memory per microphone: %d blocks, %d bytes, plus %zu bytes of state\n",
+		AUDIO_HISTORY_BLOCKS, AUDIO_HISTORY_BYTES, sizeof(AudioHistory));
+	// keeps the encoder output live
+	return checksum == 0xffffffffu;
+}
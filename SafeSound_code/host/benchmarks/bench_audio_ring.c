@@ -0,0 +1,91 @@
+// Measures the cost of one hop through an AudioBuffer: the producer writes a hop and the
+// consumer reads the frame it completes, summing the frame as the featurizer would read it.
+// The mirrored ring reads every frame in place; the copied mirror also copies the start of the
+// ring past its end for the frames that wrap. Both run on one thread, so this is the cost of
+// the ring itself without cache line transfers between cores.
+//
+//   bench_audio_ring_<hop> [hops]
+//
+// Built once per hop size, see AUDIO_HOP_SIZE.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common.h"
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+/// <summary>
+///     Runs the given number of hops through a buffer.
+/// </summary>
+/// <returns>Nanoseconds per hop, or a negative number if the ring could not be set up.</returns>
+static double RunHops(bool mirrored, long hops)
+{
+	static AudioBuffer buffer;
+	if (!initialize_audio_buffer(&buffer)) {
+		return -1;
+	}
+	if (!mirrored) {
+		// what initialize_audio_buffer falls back to when the platform refuses the mapping
+		free_audio_buffer(&buffer);
+		buffer.samples = calloc(AUDIO_RING_SAMPLES + AUDIO_FRAME_SIZE, sizeof(short));
+		buffer.mirrored = false;
+		if (buffer.samples == NULL) {
+			return -1;
+		}
+	}
+	else if (!buffer.mirrored) {
+		return -1;
+	}
+	static short hop[AUDIO_HOP_SIZE];
+	for (int i = 0; i < AUDIO_HOP_SIZE; ++i) {
+		hop[i] = (short)(i * 7);
+	}
+	volatile long sink = 0;
+	long long start = NowNs();
+	for (long i = 0; i < hops; ++i) {
+		FrameInfo* info;
+		short* slot = acquire_write_slot(&buffer, &info);
+		memcpy(slot, hop, sizeof(hop));
+		info->sequence = (unsigned long long)i;
+		if (!commit_write_slot(&buffer)) {
+			continue;
+		}
+		const FrameInfo* frameInfo;
+		const short* frame = acquire_read_slot(&buffer, &frameInfo);
+		long sum = 0;
+		for (int j = 0; j < AUDIO_FRAME_SIZE; ++j) {
+			sum += frame[j];
+		}
+		sink += sum;
+		release_read_slot(&buffer);
+	}
+	long long elapsedNs = NowNs() - start;
+	free_audio_buffer(&buffer);
+	close(buffer.dataAvailableFd);
+	return (double)elapsedNs / (double)hops;
+}
+
+int main(int argc, char* argv[])
+{
+	long hops = (argc > 1) ? atol(argv[1]) : 1000000;
+	double mirroredNs = RunHops(true, hops);
+	double copiedNs = RunHops(false, hops);
+	if (mirroredNs < 0 || copiedNs < 0) {
+		fprintf(stderr, "Could not set up the ring\n");
+		return 1;
+	}
+	// a frame is classified per hop, so the hop period is the time budget per hop
+	double hopPeriodNs = AUDIO_HOP_SIZE * 1e9 / AUDIO_SAMPLE_RATE;
+	printf("%5s %5s %14s %14s %16s\n", "hop", "frame", "mirrored ns", "copied ns", "of hop period");
+	printf("%5d %5d %14.1f %14.1f %15.5f%%\n", AUDIO_HOP_SIZE, AUDIO_FRAME_SIZE, mirroredNs, copiedNs,
+		100.0 * mirroredNs / hopPeriodNs);
+	return 0;
+}
@@ -0,0 +1,105 @@
+// Runs the capture thread on generated audio with different block sizes, and on the ADC path
+// with the simulated ADC of the host stubs, and prints its wakeups and CPU time per second of
+// audio. A block size of 1 is how the polled ADC is read, AUDIO_CAPTURE_BLOCK_SIZE is how
+// sources which buffer their samples are read.
+//
+//   bench_capture [seconds per run]
+//
+// The simulated ADC answers at once, so the cost of ADC_Poll itself is not included; on the
+// device the debug log shows the same figures for the source in use.
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "record_audio.h"
+
+typedef struct CaptureRun {
+	const char* spec;  // audio source
+	int max_block;  // replaces the source's max_block, 0 keeps it
+} CaptureRun;
+
+static const CaptureRun runs[] = {
+	{ "synth:noise", 1 },
+	{ "synth:noise", 2 },
+	{ "synth:noise", 4 },
+	{ "synth:noise", 8 },
+	{ "synth:noise", AUDIO_CAPTURE_BLOCK_SIZE },
+	{ "adc", 0 },
+};
+
+/// <summary>
+///     Captures for the given time and prints one row of results. The capture thread keeps its
+///     state in statics, so each run is a process of its own.
+/// </summary>
+static int RunCapture(const CaptureRun* run, double seconds)
+{
+	static AudioBuffer buffer;
+	static RecordAudioContext context;
+	if (!initialize_audio_buffer(&buffer)) {
+		return 1;
+	}
+	context.buffers[0] = &buffer;
+	context.buffer_count = 1;
+	context.source = audio_source_create(run->spec);
+	if (context.source == NULL) {
+		return 1;
+	}
+	if (run->max_block > 0) {
+		context.source->max_block = run->max_block;
+	}
+	if (context.source->open(context.source) != 0) {
+		return 1;
+	}
+
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, RecordAudioThread, &context) != 0) {
+		return 1;
+	}
+	struct timespec tick = { .tv_sec = 0, .tv_nsec = 10000000 };
+	for (double waited = 0; waited < seconds && !terminationRequired; waited += 0.01) {
+		nanosleep(&tick, NULL);
+		// keep the ring drained, as the main loop would
+		while (acquire_read_slot(&buffer, NULL) != NULL) {
+			release_read_slot(&buffer);
+		}
+	}
+	terminationRequired = true;
+	pthread_join(thread, NULL);
+
+	CaptureStats* stats = &context.stats;
+	double audioSeconds = (double)stats->samples / AUDIO_SAMPLE_RATE;
+	if (stats->samples == 0) {
+		return 1;
+	}
+	printf("%-12s %6d %10.0f %12.2f %14.1f\n", run->spec, stats->block_size, stats->wakeups / audioSeconds,
+		(double)stats->cpu_ns / 1e6 / audioSeconds, (double)stats->max_wake_latency_ns / 1000.0);
+	context.source->close(context.source);
+	audio_source_destroy(context.source);
+	return 0;
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : 2.0;
+	setenv("SAFESOUND_SIMULATED_ADC", "1", 1);
+	printf("Capture thread at %d Hz, %.1f s per run\n", AUDIO_CAPTURE_RATE, seconds);
+	printf("%-12s %6s %10s %12s %14s\n", "source", "block", "wakeups/s", "CPU ms/s", "max late us");
+	fflush(stdout);
+	int failures = 0;
+	for (size_t i = 0; i < sizeof(runs) / sizeof(runs[0]); ++i) {
+		pid_t child = fork();
+		if (child == 0) {
+			exit(RunCapture(&runs[i], seconds));
+		}
+		int status;
+		if (child < 0 || waitpid(child, &status, 0) != child || !WIFEXITED(status)
+			|| WEXITSTATUS(status) != 0) {
+			++failures;
+		}
+	}
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,65 @@
+// Times the level meter per hop next to the featurizer per frame, the two costs the debug log
+// reports side by side on the device.
+//
+//   bench_level_meter [seconds of audio]
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common.h"
+#include "level_meter.h"
+#include "log_mel.h"
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : 60.0;
+	const int frames = (int)(seconds * AUDIO_SAMPLE_RATE / AUDIO_FRAME_SIZE);
+	if (frames < 1) {
+		return 1;
+	}
+	static short samples[AUDIO_FRAME_SIZE];
+	static float input[AUDIO_FRAME_SIZE];
+	static float features[LOG_MEL_FILTERS];
+	srand(1);
+	for (int i = 0; i < AUDIO_FRAME_SIZE; ++i) {
+		samples[i] = (short)(3000 * sin(2 * 3.14159265358979 * 440.0 * i / AUDIO_SAMPLE_RATE) + (rand() % 801 - 400));
+		input[i] = samples[i] / 32768.0f;
+	}
+	printf("%.1f s of audio, hop %d, frame %d\n", seconds, AUDIO_HOP_SIZE, AUDIO_FRAME_SIZE);
+
+	// the meter sees each hop once
+	LevelMeter meter;
+	level_meter_init(&meter);
+	const int hops = frames * AUDIO_FRAME_HOPS;
+	float levels = 0;
+	long long start = NowNs();
+	for (int hop = 0; hop < hops; ++hop) {
+		levels += level_meter_process(&meter, samples + (hop % AUDIO_FRAME_HOPS) * AUDIO_HOP_SIZE, AUDIO_HOP_SIZE);
+	}
+	long long meterNs = NowNs() - start;
+
+	float sum = 0;
+	start = NowNs();
+	for (int frame = 0; frame < frames; ++frame) {
+		log_mel_filter(input, features);
+		sum += features[frame % LOG_MEL_FILTERS];
+	}
+	long long featurizerNs = NowNs() - start;
+
+	double meterPerHop = (double)meterNs / hops;
+	double featurizerPerFrame = (double)featurizerNs / frames;
+	printf("level meter: %8.1f ns per hop\n", meterPerHop);
+	printf("featurizer:  %8.1f ns per frame\n", featurizerPerFrame);
+	printf("The meter adds %.1f%% to the featurizer\n",
+		100.0 * meterPerHop * AUDIO_FRAME_HOPS / featurizerPerFrame);
+	// keeps the results live
+	return (levels == 1.0f && sum == 1.0f) ? 1 : 0;
+}
@@ -0,0 +1,226 @@
+// Times the stages of the native featurizer against straightforward versions of the same
+// stage, and prints how far apart their results are. log_mel.c is included rather than linked,
+// to reach its static stages.
+//
+//   bench_log_mel [frames]
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "log_mel.c"
+
+#define BENCH_INPUTS 16  // different frames cycled through, so no stage sees one input only
+
+static const double pi = 3.14159265358979323846;
+typedef float StageInputs[BENCH_INPUTS][LOG_MEL_FFT_SIZE];
+static StageInputs frames;  // samples
+static StageInputs spectra;  // magnitudes of the frames, LOG_MEL_BINS of each row
+static StageInputs sums;  // filter outputs of the spectra plus LOG_MEL_OFFSET, LOG_MEL_FILTERS of each row
+static volatile float sink;  // keeps the results of each stage live
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+// Reference spectrum: a complex FFT of the whole frame with zero imaginary parts, as ELL's
+// FFTC kernels compute it
+static float referenceTwiddleRe[LOG_MEL_FFT_SIZE / 2];
+static float referenceTwiddleIm[LOG_MEL_FFT_SIZE / 2];
+static int referenceReverse[LOG_MEL_FFT_SIZE];
+
+static void ReferenceInit(void)
+{
+	for (int k = 0; k < LOG_MEL_FFT_SIZE / 2; ++k) {
+		referenceTwiddleRe[k] = (float)cos(-2 * pi * k / LOG_MEL_FFT_SIZE);
+		referenceTwiddleIm[k] = (float)sin(-2 * pi * k / LOG_MEL_FFT_SIZE);
+	}
+	for (int i = 0; i < LOG_MEL_FFT_SIZE; ++i) {
+		int reversed = 0;
+		for (int bit = 1, mirror = LOG_MEL_FFT_SIZE / 2; bit < LOG_MEL_FFT_SIZE; bit <<= 1, mirror >>= 1) {
+			if (i & bit) {
+				reversed |= mirror;
+			}
+		}
+		referenceReverse[i] = reversed;
+	}
+}
+
+static void ReferenceSpectrum(const float* input, float* magnitude)
+{
+	float re[LOG_MEL_FFT_SIZE];
+	float im[LOG_MEL_FFT_SIZE];
+	for (int i = 0; i < LOG_MEL_FFT_SIZE; ++i) {
+		re[referenceReverse[i]] = input[i];
+		im[referenceReverse[i]] = 0;
+	}
+	for (int span = 1; span < LOG_MEL_FFT_SIZE; span *= 2) {
+		int stride = LOG_MEL_FFT_SIZE / 2 / span;
+		for (int start = 0; start < LOG_MEL_FFT_SIZE; start += 2 * span) {
+			for (int k = 0; k < span; ++k) {
+				float wr = referenceTwiddleRe[k * stride];
+				float wi = referenceTwiddleIm[k * stride];
+				int a = start + k, b = a + span;
+				float tr = wr * re[b] - wi * im[b];
+				float ti = wr * im[b] + wi * re[b];
+				re[b] = re[a] - tr;
+				im[b] = im[a] - ti;
+				re[a] += tr;
+				im[a] += ti;
+			}
+		}
+	}
+	for (int k = 0; k < LOG_MEL_BINS; ++k) {
+		magnitude[k] = sqrtf(re[k] * re[k] + im[k] * im[k]);
+	}
+}
+
+// The spectrum as log_mel_filter computes it
+static void NativeSpectrum(const float* input, float* magnitude)
+{
+	float re[HALF_SIZE];
+	float im[HALF_SIZE];
+	for (int i = 0; i < HALF_SIZE; ++i) {
+		re[bitReverse[i]] = input[2 * i];
+		im[bitReverse[i]] = input[2 * i + 1];
+	}
+	Fft(re, im);
+	SplitMagnitudes(re, im, magnitude);
+}
+
+// Filterbank as a dense matrix of LOG_MEL_FILTERS by LOG_MEL_BINS, zeros included
+static float denseWeights[LOG_MEL_FILTERS][LOG_MEL_BINS];
+
+static void DenseInit(void)
+{
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		for (int j = 0; j < filters[f].length; ++j) {
+			denseWeights[f][filters[f].first_bin + j] = filterWeights[filters[f].offset + j];
+		}
+	}
+}
+
+static void DenseFilterbank(const float* magnitude, float* sums)
+{
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		float sum = 0;
+		for (int k = 0; k < LOG_MEL_BINS; ++k) {
+			sum += magnitude[k] * denseWeights[f][k];
+		}
+		sums[f] = sum + LOG_MEL_OFFSET;
+	}
+}
+
+// The filterbank as log_mel_filter applies it
+static void SparseFilterbank(const float* magnitude, float* sums)
+{
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		const float* bins = magnitude + filters[f].first_bin;
+		const float* weights = filterWeights + filters[f].offset;
+		float sum = 0;
+		for (int j = 0; j < filters[f].length; ++j) {
+			sum += bins[j] * weights[j];
+		}
+		sums[f] = sum + LOG_MEL_OFFSET;
+	}
+}
+
+static void LibmLogs(const float* sums, float* output)
+{
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		output[f] = logf(sums[f]);
+	}
+}
+
+// The logs as log_mel_filter takes them
+static void NativeLogs(const float* sums, float* output)
+{
+	FastLogs(sums, output, LOG_MEL_FILTERS);
+}
+
+typedef void (*Stage)(const float* input, float* output);
+
+/// <summary>
+///     Runs a stage over the inputs and returns its average time per frame, after a tenth as
+///     many frames untimed to warm up the caches and the clock.
+/// </summary>
+static double TimeStage(Stage stage, const StageInputs inputs, int count)
+{
+	static float output[LOG_MEL_BINS];
+	for (int frame = 0; frame < count / 10; ++frame) {
+		stage(inputs[frame % BENCH_INPUTS], output);
+	}
+	long long start = NowNs();
+	for (int frame = 0; frame < count; ++frame) {
+		stage(inputs[frame % BENCH_INPUTS], output);
+		sink = output[frame % LOG_MEL_FILTERS];
+	}
+	return (double)(NowNs() - start) / count;
+}
+
+/// <summary>
+///     Largest difference between the outputs of two stages over the inputs, relative to the
+///     largest output of the first.
+/// </summary>
+static double CompareStages(Stage reference, Stage candidate, const StageInputs inputs, int count)
+{
+	double maxDifference = 0, maxValue = 0;
+	for (int i = 0; i < BENCH_INPUTS; ++i) {
+		float expected[LOG_MEL_BINS], actual[LOG_MEL_BINS];
+		reference(inputs[i], expected);
+		candidate(inputs[i], actual);
+		for (int k = 0; k < count; ++k) {
+			maxDifference = fmax(maxDifference, fabs((double)expected[k] - actual[k]));
+			maxValue = fmax(maxValue, fabs(expected[k]));
+		}
+	}
+	return maxDifference / maxValue;
+}
+
+/// <summary>
+///     Times a stage and its reference and prints both with the difference of their results.
+/// </summary>
+static void CompareStage(const char* name, Stage reference, Stage native, const StageInputs inputs,
+	int outputs, int count)
+{
+	double difference = CompareStages(reference, native, inputs, outputs);
+	double referenceNs = TimeStage(reference, inputs, count);
+	double nativeNs = TimeStage(native, inputs, count);
+	printf("%-12s %10.1f %10.1f %8.2fx %12.2g\n", name, referenceNs, nativeNs, referenceNs / nativeNs,
+		difference);
+}
+
+int main(int argc, char* argv[])
+{
+	int count = (argc > 1) ? atoi(argv[1]) : 20000;
+	if (count < 1) {
+		return 1;
+	}
+	// tones and noise at several levels
+	srand(1);
+	for (int i = 0; i < BENCH_INPUTS; ++i) {
+		float level = 0.02f * (float)(i + 1);
+		for (int j = 0; j < LOG_MEL_FFT_SIZE; ++j) {
+			frames[i][j] = level * (float)sin(2 * pi * (200.0 + 300.0 * i) * j / AUDIO_SAMPLE_RATE)
+				+ 0.01f * (float)(rand() % 2001 - 1000) / 1000.0f;
+		}
+	}
+	ReferenceInit();
+	DenseInit();
+	for (int i = 0; i < BENCH_INPUTS; ++i) {
+		NativeSpectrum(frames[i], spectra[i]);
+		SparseFilterbank(spectra[i], sums[i]);
+	}
+
+	printf("Log-mel featurizer, %d-point frames, %d filters, %d frames per stage\n", LOG_MEL_FFT_SIZE,
+		LOG_MEL_FILTERS, count);
+	printf("%-12s %10s %10s %9s %12s\n", "stage", "ref ns", "native ns", "speedup", "difference");
+	CompareStage("spectrum", ReferenceSpectrum, NativeSpectrum, frames, LOG_MEL_BINS, count);
+	CompareStage("filterbank", DenseFilterbank, SparseFilterbank, spectra, LOG_MEL_FILTERS, count);
+	CompareStage("logs", LibmLogs, NativeLogs, sums, LOG_MEL_FILTERS, count);
+	printf("%-12s %10s %10.1f\n", "featurizer", "", TimeStage(log_mel_filter, frames, count));
+	return 0;
+}
@@ -0,0 +1,98 @@
+// Times the work a rate profile does per second of captured audio after capture: the
+// decimator, the activity gate and the featurizer, with every frame active. The host build
+// compiles it once for each profile, as bench_rate_profile_16000 and bench_rate_profile_8000,
+// so the two can be compared side by side. The classifier is not timed, since the host only has
+// the stub model; it takes the same features at the same number of frames per second in both
+// profiles.
+//
+//   bench_rate_profile [seconds of audio]
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "activity_detector.h"
+#include "common.h"
+#include "decimator.h"
+#include "log_mel.h"
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : 60.0;
+	const int hops = (int)(seconds * AUDIO_SAMPLE_RATE / AUDIO_HOP_SIZE);
+	if (hops < AUDIO_FRAME_HOPS) {
+		return 1;
+	}
+	// a second of a tone with noise at the capture rate, cycled through
+	static short captured[AUDIO_CAPTURE_RATE];
+	srand(1);
+	for (int i = 0; i < AUDIO_CAPTURE_RATE; ++i) {
+		captured[i] = (short)(3000 * sin(2 * 3.14159265358979 * 440.0 * i / AUDIO_CAPTURE_RATE)
+			+ (rand() % 801 - 400));
+	}
+	const int capturedHop = AUDIO_HOP_SIZE * AUDIO_DECIMATION;
+	static short frame[AUDIO_FRAME_SIZE];
+	float features[LOG_MEL_FILTERS];
+	float sum = 0;
+	Decimator decimator;
+	decimator_init(&decimator);
+	ActivityDetector detector;
+	activity_detector_init(&detector);
+	long long decimatorNs = 0, gateNs = 0, featurizerNs = 0;
+	int frames = 0;
+	for (int hop = 0; hop < hops; ++hop) {
+		// slide the frame along by one hop and fill in the new hop, as the ring does in place
+		memmove(frame, frame + AUDIO_HOP_SIZE, (AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE) * sizeof(short));
+		short* next = frame + AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE;
+		const short* source = captured + (hop % (AUDIO_CAPTURE_RATE / capturedHop)) * capturedHop;
+		long long start = NowNs();
+#if AUDIO_DECIMATION > 1
+		decimator_process(&decimator, source, capturedHop, next);
+#else
+		memcpy(next, source, AUDIO_HOP_SIZE * sizeof(short));
+#endif
+		long long decimated = NowNs();
+		decimatorNs += decimated - start;
+		if (hop + 1 < AUDIO_FRAME_HOPS) {
+			continue;
+		}
+		FrameInfo info = { .sequence = frames };
+		activity_detector_process(&detector, frame, &info);
+		long long gated = NowNs();
+		gateNs += gated - decimated;
+#if AUDIO_FIXED_POINT_FEATURIZER
+		log_mel_filter_pcm(frame, features);
+#else
+		float input[AUDIO_FRAME_SIZE];
+		for (int i = 0; i < AUDIO_FRAME_SIZE; ++i) {
+			input[i] = frame[i] * (1.0f / 32768.0f);
+		}
+		log_mel_filter(input, features);
+#endif
+		featurizerNs += NowNs() - gated;
+		sum += features[frames % LOG_MEL_FILTERS];
+		++frames;
+	}
+
+	double audioSeconds = (double)hops * AUDIO_HOP_SIZE / AUDIO_SAMPLE_RATE;
+	printf("%d Hz profile: %d-sample frames every %d samples, %.2f frames per second, %s featurizer\n",
+		AUDIO_SAMPLE_RATE, AUDIO_FRAME_SIZE, AUDIO_HOP_SIZE, frames / audioSeconds,
+		AUDIO_FIXED_POINT_FEATURIZER ? "fixed-point" : "float");
+	printf("%-12s %10s %14s\n", "stage", "us/frame", "ms CPU per s");
+	printf("%-12s %10.2f %14.3f\n", AUDIO_DECIMATION > 1 ? "decimator" : "hop copy",
+		decimatorNs / 1000.0 / frames, decimatorNs / 1e6 / audioSeconds);
+	printf("%-12s %10.2f %14.3f\n", "gate", gateNs / 1000.0 / frames, gateNs / 1e6 / audioSeconds);
+	printf("%-12s %10.2f %14.3f\n", "featurizer", featurizerNs / 1000.0 / frames, featurizerNs / 1e6 / audioSeconds);
+	long long totalNs = decimatorNs + gateNs + featurizerNs;
+	printf("%-12s %10.2f %14.3f\n", "total", totalNs / 1000.0 / frames, totalNs / 1e6 / audioSeconds);
+	// keeps the results live
+	return (sum == 1.0f) ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+// Times the drift-correcting resampler on its own, in blocks of AUDIO_CAPTURE_BLOCK_SIZE, at
+// the nominal rate, where the samples pass through, and at the largest corrections it applies. The capture thread reports the
+// same figure as resample_ns for the rate it actually measures.
+//
+//   bench_resampler [seconds of audio]
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "common.h"
+#include "resampler.h"
+
+static const double steps[] = { 1.0, 1.0 - RESAMPLER_MAX_DRIFT, 1.0 + RESAMPLER_MAX_DRIFT };
+
+static long long NowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return now.tv_sec * 1000000000LL + now.tv_nsec;
+}
+
+int main(int argc, char* argv[])
+{
+	double seconds = (argc > 1) ? atof(argv[1]) : 10.0;
+	const int blocks = (int)(seconds * AUDIO_SAMPLE_RATE / AUDIO_CAPTURE_BLOCK_SIZE);
+	static short input[AUDIO_CAPTURE_BLOCK_SIZE];
+	static short output[RESAMPLER_MAX_OUTPUT];
+	srand(1);
+	for (int i = 0; i < AUDIO_CAPTURE_BLOCK_SIZE; ++i) {
+		input[i] = (short)(rand() % 20000 - 10000);
+	}
+
+	printf("Resampler, %d taps, %d phases, %.1f s of audio in blocks of %d\n", RESAMPLER_TAPS,
+		RESAMPLER_PHASES, seconds, AUDIO_CAPTURE_BLOCK_SIZE);
+	printf("%8s %12s %12s\n", "step", "ns/sample", "ms/s audio");
+	for (size_t i = 0; i < sizeof(steps) / sizeof(steps[0]); ++i) {
+		Resampler rs;
+		resampler_init(&rs);
+		rs.step = steps[i];
+		long long outputSamples = 0;
+		long long start = NowNs();
+		for (int block = 0; block < blocks; ++block) {
+			int count = resampler_process(&rs, input, AUDIO_CAPTURE_BLOCK_SIZE, output, RESAMPLER_MAX_OUTPUT);
+			outputSamples += count;
+		}
+		long long elapsedNs = NowNs() - start;
+		if (outputSamples == 0) {
+			return 1;
+		}
+		double audioSeconds = (double)blocks * AUDIO_CAPTURE_BLOCK_SIZE / AUDIO_SAMPLE_RATE;
+		printf("%8.3f %12.1f %12.3f\n", steps[i], (double)elapsedNs / (double)outputSamples,
+			(double)elapsedNs / 1e6 / audioSeconds);
+	}
+	return 0;
+}
@@ -0,0 +1,13 @@
+# Regenerates a checked-in header with its tool and fails if the result differs, i.e. if the
+# header was not regenerated after the tool or its inputs changed.
+#
+#   cmake -DPYTHON=<python3> -DTOOL=<script> -DHEADER=<checked-in header> -DOUTPUT=<scratch file>
+#         -P check_generated.cmake
+execute_process(COMMAND ${PYTHON} ${TOOL} --output ${OUTPUT} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "${TOOL} failed")
+endif()
+execute_process(COMMAND ${CMAKE_COMMAND} -E compare_files ${HEADER} ${OUTPUT} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+	message(FATAL_ERROR "${HEADER} is out of date, rerun ${TOOL}")
+endif()
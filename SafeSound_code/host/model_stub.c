@@ -0,0 +1,96 @@
+// Stand-in for the prebuilt ELL classifier and featurizer in lib/, which are compiled for the
+// Azure Sphere only. The classifier always predicts background noise with full confidence
+// and the featurizer reports an input size of 0, so check_predict_setup skips comparing it
+// with the native featurizer. The pipeline runs end to end with it, which is enough to
+// profile it and test its plumbing, but its predictions mean nothing. Set
+// SAFESOUND_HOST_MODEL to objects of the real model compiled for the host instead.
+#include <string.h>
+
+#include "process_audio.h"
+#define MODEL_WRAPPER_DEFINED
+#include "classifier.h"
+#define MFCC_WRAPPER_DEFINED
+#include "featurizer.h"
+
+void model_Predict(void* context, float* input, float* output)
+{
+	memset(output, 0, NUM_CATEGORIES * sizeof(float));
+	output[0] = 1.0f;
+}
+
+void model_Reset(void)
+{
+}
+
+int32_t model_GetInputSize(int32_t index)
+{
+	return FEATURES_SIZE;
+}
+
+int32_t model_GetOutputSize(int32_t index)
+{
+	return NUM_CATEGORIES;
+}
+
+int32_t model_GetNumNodes(void)
+{
+	return 0;
+}
+
+void model_GetInputShape(int32_t index, TensorShape* shape)
+{
+	shape->rows = 1;
+	shape->columns = 1;
+	shape->channels = FEATURES_SIZE;
+}
+
+void model_GetOutputShape(int32_t index, TensorShape* shape)
+{
+	shape->rows = 1;
+	shape->columns = 1;
+	shape->channels = NUM_CATEGORIES;
+}
+
+char* model_GetMetadata(char* key)
+{
+	return NULL;
+}
+
+void mfcc_Filter(void* context, float* input, float* output)
+{
+	memset(output, 0, FEATURES_SIZE * sizeof(float));
+}
+
+void mfcc_Reset(void)
+{
+}
+
+int32_t mfcc_GetInputSize(int32_t index)
+{
+	return 0;
+}
+
+int32_t mfcc_GetOutputSize(int32_t index)
+{
+	return 0;
+}
+
+int32_t mfcc_GetNumNodes(void)
+{
+	return 0;
+}
+
+void mfcc_GetInputShape(int32_t index, TensorShape* shape)
+{
+	memset(shape, 0, sizeof(*shape));
+}
+
+void mfcc_GetOutputShape(int32_t index, TensorShape* shape)
+{
+	memset(shape, 0, sizeof(*shape));
+}
+
+char* mfcc_GetMetadata(char* key)
+{
+	return NULL;
+}
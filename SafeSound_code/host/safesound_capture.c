@@ -0,0 +1,149 @@
+// Runs an audio source through the capture thread and the detection pipeline on the host,
+// the way main.c does on the device, and prints the detections and capture statistics.
+//
+//   safesound_capture <source> [seconds]
+//
+// <source> is an audio source specification, see audio_source_create, e.g. wav:clip.wav or
+// synth:noise. The source is paced by the capture timer, so a file plays in real time. Without
+// seconds it runs until a file source ends, or until interrupted.
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "process_audio.h"
+#include "record_audio.h"
+
+static AudioBuffer buffers[MAX_AUDIO_CHANNELS];
+static ActivityDetector detectors[MAX_AUDIO_CHANNELS];
+static PredictionState states[MAX_AUDIO_CHANNELS];
+static RecordAudioContext recordAudioContext;
+
+static void TerminationHandler(int signalNumber)
+{
+	terminationRequired = true;
+}
+
+static double Seconds(const struct timespec* time)
+{
+	return (double)time->tv_sec + (double)time->tv_nsec / 1e9;
+}
+
+/// <summary>
+///     Classifies every frame queued for one microphone.
+/// </summary>
+/// <returns>Number of frames taken from the buffer.</returns>
+static unsigned int DrainChannel(int channel, const struct timespec* start, unsigned int* classified)
+{
+	unsigned int frames = 0;
+	const FrameInfo* info;
+	const short* frame;
+	while ((frame = acquire_read_slot(&buffers[channel], &info)) != NULL) {
+		FrameInfo frameInfo = *info;
+		int prediction;
+		float confidence;
+		*classified += (unsigned int)predict_active_frame(&detectors[channel], &states[channel], frame,
+			&frameInfo, false, &prediction, &confidence);
+		release_read_slot(&buffers[channel]);
+		if (confidence > 0) {
+			printf("Microphone %d: %s with confidence %.3f at %.3f s\n", channel, categories[prediction],
+				confidence, Seconds(&frameInfo.capture_time) - Seconds(start));
+		}
+		++frames;
+	}
+	return frames;
+}
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2 || argc > 3) {
+		fprintf(stderr, "usage: %s <audio source> [seconds]\n", argv[0]);
+		return 2;
+	}
+	double duration = (argc == 3) ? atof(argv[2]) : 0;
+	struct sigaction action = { .sa_handler = TerminationHandler };
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+
+	if (!check_predict_setup()) {
+		return 1;
+	}
+	AudioSource* source = audio_source_create(argv[1]);
+	if (source == NULL || source->open(source) != 0) {
+		return 1;
+	}
+	// only the channels of the source are prepared
+	const int channels = source->channels;
+	if (channels < 1 || channels > MAX_AUDIO_CHANNELS) {
+		fprintf(stderr, "The audio source has %d channels, expecting 1 to %d.\n", channels, MAX_AUDIO_CHANNELS);
+		return 1;
+	}
+	for (int channel = 0; channel < channels; ++channel) {
+		if (!initialize_audio_buffer(&buffers[channel])) {
+			fprintf(stderr, "Could not allocate the audio buffers.\n");
+			return 1;
+		}
+		activity_detector_init(&detectors[channel]);
+		prediction_state_reset(&states[channel]);
+		recordAudioContext.buffers[channel] = &buffers[channel];
+	}
+	recordAudioContext.buffer_count = channels;
+	recordAudioContext.source = source;
+
+	struct timespec start, now;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, RecordAudioThread, &recordAudioContext) != 0) {
+		fprintf(stderr, "Could not start the capture thread.\n");
+		return 1;
+	}
+	struct pollfd fds[MAX_AUDIO_CHANNELS];
+	for (int channel = 0; channel < channels; ++channel) {
+		fds[channel].fd = buffers[channel].dataAvailableFd;
+		fds[channel].events = POLLIN;
+	}
+	unsigned int frames = 0;
+	unsigned int classified = 0;
+	while (!terminationRequired) {
+		poll(fds, (nfds_t)channels, 100);
+		for (int channel = 0; channel < channels; ++channel) {
+			uint64_t notifications;
+			if ((fds[channel].revents & POLLIN) != 0
+				&& read(fds[channel].fd, &notifications, sizeof(notifications)) > 0) {
+				frames += DrainChannel(channel, &start, &classified);
+			}
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		if (duration > 0 && Seconds(&now) - Seconds(&start) >= duration) {
+			terminationRequired = true;
+		}
+	}
+	pthread_join(thread, NULL);
+	// the frames completed before the thread stopped
+	for (int channel = 0; channel < channels; ++channel) {
+		frames += DrainChannel(channel, &start, &classified);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	CaptureStats* stats = &recordAudioContext.stats;
+	double audioSeconds = (double)stats->samples / AUDIO_SAMPLE_RATE;
+	unsigned int dropped = 0;
+	for (int channel = 0; channel < channels; ++channel) {
+		dropped += atomic_load(&buffers[channel].dropped_frames);
+	}
+	printf("Captured %u samples in %u wakeups over %.2f s, %u frames, %u classified, %u dropped.\n",
+		stats->samples, stats->wakeups, Seconds(&now) - Seconds(&start), frames, classified, dropped);
+	if (audioSeconds > 0) {
+		printf("Capture thread CPU %.2f ms per second of audio.\n",
+			(double)stats->cpu_ns / 1e6 / audioSeconds);
+	}
+	source->close(source);
+	audio_source_destroy(source);
+	return 0;
+}
@@ -0,0 +1,44 @@
+// Replays WAV files through the detection pipeline as fast as possible on the host, the way the
+// replay direct method does on the device, and prints the timing and detections of each.
+//
+//   safesound_replay <file.wav>...
+//
+// The files must be 16-bit mono at AUDIO_SAMPLE_RATE, or at AUDIO_CAPTURE_RATE if the rate
+// profile decimates. Returns non-zero if any file could not be replayed.
+#include <stdio.h>
+
+#include "common.h"
+#include "replay.h"
+
+int main(int argc, char* argv[])
+{
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s <file.wav>...\n", argv[0]);
+		return 2;
+	}
+	if (!check_predict_setup()) {
+		fprintf(stderr, "Prediction setup failed\n");
+		return 1;
+	}
+	int failures = 0;
+	for (int i = 1; i < argc; ++i) {
+		ReplayResult result;
+		if (!replay_wav_file(argv[i], 0.95f, &result)) {
+			printf("%s: replay failed\n", argv[i]);
+			++failures;
+			continue;
+		}
+		printf("%s: %u frames (%u skipped), %.2f s of audio, real-time factor %.4f, %.1f frames/s, %d detections\n",
+			argv[i], result.frames, result.skipped_frames, result.audio_seconds, result.real_time_factor,
+			result.frames_per_second, result.detection_count);
+		int stored = result.detection_count < REPLAY_MAX_DETECTIONS ? result.detection_count : REPLAY_MAX_DETECTIONS;
+		for (int j = 0; j < stored; ++j) {
+			const ReplayDetection* detection = &result.detections[j];
+			printf("  %s with confidence %.3f, samples %llu to %llu, %.1f ms after onset\n",
+				categories[detection->prediction], detection->confidence, detection->onset_sample,
+				detection->decision_sample,
+				(double)(detection->decision_sample - detection->onset_sample) * 1000.0 / AUDIO_SAMPLE_RATE);
+		}
+	}
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,80 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <applibs/adc.h>
+#include <applibs/log.h>
+#include <applibs/storage.h>
+
+int Log_Debug(const char* fmt, ...)
+{
+	static int quiet = -1;
+	if (quiet < 0) {
+		const char* setting = getenv("SAFESOUND_QUIET");
+		quiet = setting != NULL && strcmp(setting, "1") == 0;
+	}
+	if (quiet) {
+		return 0;
+	}
+	va_list args;
+	va_start(args, fmt);
+	int result = vfprintf(stderr, fmt, args);
+	va_end(args);
+	return result;
+}
+
+int Storage_OpenFileInImagePackage(const char* relativePath)
+{
+	return open(relativePath, O_RDONLY);
+}
+
+// Set SAFESOUND_SIMULATED_ADC=1 to stand in a 12-bit ADC which reads noise, e.g. to time the
+// capture thread on the ADC path
+static bool SimulatedAdc(void)
+{
+	static int simulated = -1;
+	if (simulated < 0) {
+		const char* setting = getenv("SAFESOUND_SIMULATED_ADC");
+		simulated = setting != NULL && strcmp(setting, "1") == 0;
+	}
+	return simulated;
+}
+
+int ADC_Open(ADC_ControllerId id)
+{
+	if (SimulatedAdc()) {
+		return open("/dev/null", O_RDONLY);
+	}
+	errno = ENODEV;
+	return -1;
+}
+
+int ADC_GetSampleBitCount(int fd, ADC_ChannelId channel)
+{
+	if (SimulatedAdc()) {
+		return 12;
+	}
+	errno = EBADF;
+	return -1;
+}
+
+int ADC_Poll(int fd, ADC_ChannelId channel, uint32_t* outSampleValue)
+{
+	if (SimulatedAdc()) {
+		static uint32_t state = 1;
+		state = state * 1664525u + 1013904223u;
+		*outSampleValue = state >> 20;
+		return 0;
+	}
+	errno = EBADF;
+	return -1;
+}
+
+int ADC_SetReferenceVoltage(int fd, ADC_ChannelId channel, float referenceVoltage)
+{
+	errno = EBADF;
+	return -1;
+}
@@ -0,0 +1,14 @@
+// Host stand-in for the Azure Sphere applibs ADC API. There is no ADC on the host, so
+// ADC_Open fails and the "adc" audio source cannot be opened, unless SAFESOUND_SIMULATED_ADC=1
+// stands in a simulated one.
+#pragma once
+
+#include <stdint.h>
+
+typedef int ADC_ControllerId;
+typedef uint32_t ADC_ChannelId;
+
+int ADC_Open(ADC_ControllerId id);
+int ADC_GetSampleBitCount(int fd, ADC_ChannelId channel);
+int ADC_Poll(int fd, ADC_ChannelId channel, uint32_t* outSampleValue);
+int ADC_SetReferenceVoltage(int fd, ADC_ChannelId channel, float referenceVoltage);
@@ -0,0 +1,7 @@
+// Host stand-in for the Azure Sphere applibs logging API.
+#pragma once
+
+/// <summary>
+///     Writes a debug message to stderr. SAFESOUND_QUIET=1 in the environment drops them.
+/// </summary>
+int Log_Debug(const char* fmt, ...) __attribute__((format(printf, 1, 2)));
@@ -0,0 +1,8 @@
+// Host stand-in for the Azure Sphere applibs storage API.
+#pragma once
+
+/// <summary>
+///     Opens a file of the image package for reading. On the host the image package is the
+///     current directory.
+/// </summary>
+int Storage_OpenFileInImagePackage(const char* relativePath);
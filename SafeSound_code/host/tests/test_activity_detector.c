@@ -0,0 +1,39 @@
+// Checks the activity detector's levels on full-scale audio, where the first difference of
+// neighbouring samples no longer fits in 16 bits.
+#include <stdio.h>
+
+#include "activity_detector.h"
+#include "common.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+int main(void)
+{
+	// the highest frequency at full scale: every difference is 65535 or -65535
+	static short frame[AUDIO_FRAME_SIZE];
+	for (int i = 0; i < AUDIO_FRAME_SIZE; ++i) {
+		frame[i] = (i % 2 == 0) ? 32767 : -32768;
+	}
+	ActivityDetector detector;
+	activity_detector_init(&detector);
+	FrameInfo info = { .sequence = 0 };
+	activity_detector_process(&detector, frame, &info);
+	// the first frame sets the noise floors to its levels
+	CHECK(detector.noise_floor > 1.0e9f);
+	CHECK(detector.band_noise_floor > 4.0e9f);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Activity detector passed\n");
+	return 0;
+}
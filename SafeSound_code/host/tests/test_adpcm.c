@@ -0,0 +1,186 @@
+// Encodes a tone with noise as IMA ADPCM and decodes it again with a reference decoder written
+// from the IMA standard, directly and through a clip frozen from an AudioHistory. The decoded
+// audio must be within ADPCM_MIN_SNR_DB of the original, every block must start with its first
+// sample, and the clip must be a WAV file of the expected layout which starts the pre-roll
+// before an onset dated by its capture time, half a second before the clip is frozen.
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "adpcm.h"
+#include "audio_history.h"
+#include "common.h"
+
+// ADPCM codes the change from one sample to the next, so its error grows with the step of the
+// tone per sample: about 6 dB less for each halving of the sample rate. 30 dB at 16 kHz.
+#define ADPCM_MIN_SNR_DB (30.0 - 20.0 * log10(16000.0 / AUDIO_SAMPLE_RATE))
+#define TEST_SECONDS 6
+
+static int failures = 0;
+
+/// <summary>
+///     Capture time of a sample, with the first captured a thousand seconds into the clock.
+/// </summary>
+static struct timespec SampleTime(int sample)
+{
+	long long ns = (long long)sample * 1000000000LL / AUDIO_SAMPLE_RATE;
+	struct timespec time = { (time_t)(1000 + ns / 1000000000LL), (long)(ns % 1000000000LL) };
+	return time;
+}
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static const int referenceSteps[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+static const int referenceIndexSteps[16] = { -1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8 };
+
+/// <summary>
+///     Decodes one mono IMA ADPCM block as a WAV reader does.
+/// </summary>
+static void DecodeBlock(const unsigned char* block, short* samples)
+{
+	int predictor = (short)(block[0] | (block[1] << 8));
+	int index = block[2];
+	samples[0] = (short)predictor;
+	for (int i = 1; i < ADPCM_BLOCK_SAMPLES; ++i) {
+		unsigned char byte = block[4 + (i - 1) / 2];
+		int code = ((i - 1) % 2 == 0) ? (byte & 0x0f) : (byte >> 4);
+		int step = referenceSteps[index];
+		int delta = step >> 3;
+		if (code & 4) {
+			delta += step;
+		}
+		if (code & 2) {
+			delta += step >> 1;
+		}
+		if (code & 1) {
+			delta += step >> 2;
+		}
+		predictor += (code & 8) ? -delta : delta;
+		predictor = predictor > 32767 ? 32767 : (predictor < -32768 ? -32768 : predictor);
+		index += referenceIndexSteps[code];
+		index = index < 0 ? 0 : (index > 88 ? 88 : index);
+		samples[i] = (short)predictor;
+	}
+}
+
+static double SnrDb(const short* original, const short* decoded, int count)
+{
+	double signal = 0, noise = 0;
+	for (int i = 0; i < count; ++i) {
+		double error = (double)original[i] - decoded[i];
+		signal += (double)original[i] * original[i];
+		noise += error * error;
+	}
+	return 10.0 * log10(signal / (noise > 0 ? noise : 1e-9));
+}
+
+static unsigned int GetLe(const unsigned char* in, int bytes)
+{
+	unsigned int value = 0;
+	for (int i = bytes - 1; i >= 0; --i) {
+		value = (value << 8) | in[i];
+	}
+	return value;
+}
+
+int main(void)
+{
+	const int count = TEST_SECONDS * AUDIO_SAMPLE_RATE;
+	short* audio = malloc((size_t)count * sizeof(short));
+	short* decoded = malloc((size_t)count * sizeof(short));
+	if (audio == NULL || decoded == NULL) {
+		return 1;
+	}
+	// a tone with a swell and some noise, so the step size has to follow the level
+	srand(1);
+	for (int i = 0; i < count; ++i) {
+		double t = (double)i / AUDIO_SAMPLE_RATE;
+		double level = 3000.0 + 9000.0 * (0.5 + 0.5 * sin(2 * 3.14159265358979 * 0.5 * t));
+		audio[i] = (short)(level * sin(2 * 3.14159265358979 * 440.0 * t) + (rand() % 801 - 400));
+	}
+
+	// block by block
+	AdpcmEncoder encoder;
+	adpcm_encoder_init(&encoder);
+	unsigned char block[ADPCM_BLOCK_BYTES];
+	const int blocks = count / ADPCM_BLOCK_SAMPLES;
+	bool headersExact = true;
+	for (int b = 0; b < blocks; ++b) {
+		const short* samples = audio + b * ADPCM_BLOCK_SAMPLES;
+		adpcm_encode_block(&encoder, samples, block);
+		DecodeBlock(block, decoded + b * ADPCM_BLOCK_SAMPLES);
+		headersExact = headersExact && decoded[b * ADPCM_BLOCK_SAMPLES] == samples[0];
+	}
+	double snr = SnrDb(audio, decoded, blocks * ADPCM_BLOCK_SAMPLES);
+	printf("Round trip of %d blocks: %.1f dB SNR\n", blocks, snr);
+	CHECK(headersExact);
+	CHECK(snr > ADPCM_MIN_SNR_DB);
+
+	// through the history, in frames as the main loop appends them
+	AudioHistory history;
+	audio_history_init(&history);
+	const int preSamples = AUDIO_SNAPSHOT_PRE_SECONDS * AUDIO_SAMPLE_RATE;
+	const int postSamples = AUDIO_SNAPSHOT_POST_SECONDS * AUDIO_SAMPLE_RATE;
+	// leaves a few frames after the post-roll
+	const int freezeAt = count - postSamples - 8 * AUDIO_FRAME_SIZE;
+	int onsetSample = 0;
+	bool frozen = false;
+	unsigned char* clip = NULL;
+	size_t clipSize = 0;
+	for (int i = 0; i + AUDIO_FRAME_SIZE <= count && clip == NULL; i += AUDIO_FRAME_SIZE) {
+		struct timespec captureTime = SampleTime(i);
+		audio_history_append(&history, audio + i, AUDIO_FRAME_SIZE, &captureTime);
+		if (!frozen && i + AUDIO_FRAME_SIZE >= freezeAt) {
+			onsetSample = i + AUDIO_FRAME_SIZE - AUDIO_SAMPLE_RATE / 2;
+			struct timespec onsetTime = SampleTime(onsetSample);
+			CHECK(audio_history_freeze(&history, &onsetTime, (unsigned int)preSamples, (unsigned int)postSamples));
+			frozen = true;
+		}
+		clip = audio_history_take_clip(&history, &clipSize);
+	}
+	CHECK(clip != NULL);
+	if (clip != NULL) {
+		unsigned int clipBlocks = (unsigned int)(history.clip_end - history.clip_start);
+		CHECK(clipSize == AUDIO_CLIP_HEADER_BYTES + (size_t)clipBlocks * ADPCM_BLOCK_BYTES);
+		CHECK(memcmp(clip, "RIFF", 4) == 0 && memcmp(clip + 8, "WAVE", 4) == 0);
+		CHECK(GetLe(clip + 20, 2) == 0x0011);
+		CHECK(GetLe(clip + 24, 4) == AUDIO_SAMPLE_RATE);
+		CHECK(GetLe(clip + 32, 2) == ADPCM_BLOCK_BYTES);
+		CHECK(GetLe(clip + 56, 4) == clipBlocks * ADPCM_BLOCK_BYTES);
+		// the clip starts with the block holding the start of the pre-roll before the onset, and
+		// covers the onset and the post-roll
+		CHECK(history.clip_start == (unsigned long long)((onsetSample - preSamples) / ADPCM_BLOCK_SAMPLES));
+		CHECK(clipBlocks * ADPCM_BLOCK_SAMPLES >= (unsigned int)(preSamples + AUDIO_SAMPLE_RATE / 2 + postSamples));
+		const short* original = audio + history.clip_start * ADPCM_BLOCK_SAMPLES;
+		for (unsigned int b = 0; b < clipBlocks; ++b) {
+			DecodeBlock(clip + AUDIO_CLIP_HEADER_BYTES + b * ADPCM_BLOCK_BYTES, decoded + b * ADPCM_BLOCK_SAMPLES);
+		}
+		double clipSnr = SnrDb(original, decoded, (int)clipBlocks * ADPCM_BLOCK_SAMPLES);
+		printf("Clip of %u blocks: %.1f dB SNR\n", clipBlocks, clipSnr);
+		CHECK(clipSnr > ADPCM_MIN_SNR_DB);
+		free(clip);
+	}
+	audio_history_free(&history);
+	free(audio);
+	free(decoded);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("ADPCM passed\n");
+	return 0;
+}
@@ -0,0 +1,352 @@
+// Runs a producer and a consumer thread on one AudioBuffer with random stalls on both sides, for
+// each overload policy, with the mirrored ring and with the copied mirror. Every hop is filled
+// with a pattern derived from its sequence number, so the consumer and two AudioReaders can check
+// that each frame they read is whole, in order and consists of committed hops only. One reader
+// runs on the consumer thread ahead of the consumer; the other runs on its own thread with long
+// stalls, so the producer laps it and overwrites frames while it reads them. At the end
+// the frames read, skipped and dropped must add up to the hops written. A single-threaded run
+// then fills the ring without a consumer, to check that AudioOverload_DropOldest keeps the newest
+// hops and that the other policies keep the oldest, and that a frame the consumer is reading is
+// never taken back.
+//
+// Built once per hop size, see AUDIO_HOP_SIZE.
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common.h"
+
+#define TEST_HOPS 30000
+#define TEST_DEPTH 4
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+typedef struct RingTest {
+	AudioBuffer buffer;
+	atomic_bool done;  // the producer has written every hop
+	// producer totals
+	unsigned int committed;
+	unsigned int dropped;
+	// consumer totals
+	unsigned int frames;
+	unsigned int reader_frames;
+	// lagging reader totals
+	unsigned int lagging_frames;
+	unsigned int lagging_skipped;
+	unsigned int lagging_bad_frames;
+	unsigned int bad_frames;  // frames with samples that are not the pattern of their hops
+	unsigned int out_of_order;  // frames whose sequence did not increase
+} RingTest;
+
+/// <summary>
+///     Small per-thread random numbers for the stalls.
+/// </summary>
+static unsigned int NextRandom(unsigned int* state)
+{
+	*state ^= *state << 13;
+	*state ^= *state >> 17;
+	*state ^= *state << 5;
+	return *state;
+}
+
+static void Stall(unsigned int* random, unsigned int oneIn, long maxNs)
+{
+	if (NextRandom(random) % oneIn == 0) {
+		struct timespec pause = { .tv_sec = 0, .tv_nsec = (long)(NextRandom(random) % (unsigned int)maxNs) };
+		nanosleep(&pause, NULL);
+	}
+}
+
+static short Pattern(unsigned long long sequence, int index)
+{
+	return (short)((sequence * 7919 + (unsigned long long)index * 31) & 0x7fff);
+}
+
+/// <summary>
+///     Fills a hop: its sequence number in the first two samples, the pattern in the rest.
+/// </summary>
+static void FillHop(short* hop, unsigned long long sequence)
+{
+	hop[0] = (short)(sequence & 0x7fff);
+	hop[1] = (short)((sequence >> 15) & 0x7fff);
+	for (int i = 2; i < AUDIO_HOP_SIZE; ++i) {
+		hop[i] = Pattern(sequence, i);
+	}
+}
+
+/// <summary>
+///     Checks that every hop of a frame holds its pattern, that the hops are in order and that
+///     the first one is the hop the FrameInfo names.
+/// </summary>
+static bool FrameIntact(const short* frame, const FrameInfo* info)
+{
+	unsigned long long previous = 0;
+	for (int hop = 0; hop < AUDIO_FRAME_HOPS; ++hop) {
+		const short* samples = frame + hop * AUDIO_HOP_SIZE;
+		unsigned long long sequence = (unsigned long long)samples[0] | ((unsigned long long)samples[1] << 15);
+		if ((hop == 0 && sequence != info->sequence) || (hop > 0 && sequence <= previous)) {
+			return false;
+		}
+		for (int i = 2; i < AUDIO_HOP_SIZE; ++i) {
+			if (samples[i] != Pattern(sequence, i)) {
+				return false;
+			}
+		}
+		previous = sequence;
+	}
+	return true;
+}
+
+static void* Producer(void* argument)
+{
+	RingTest* test = argument;
+	unsigned int random = 12345;
+	for (unsigned long long sequence = 0; sequence < TEST_HOPS; ++sequence) {
+		FrameInfo* info;
+		short* hop = acquire_write_slot(&test->buffer, &info);
+		if (hop == NULL) {
+			drop_write_slot(&test->buffer);
+			++test->dropped;
+		}
+		else {
+			FillHop(hop, sequence);
+			memset(info, 0, sizeof(*info));
+			info->sequence = sequence;
+			commit_write_slot(&test->buffer);
+			++test->committed;
+		}
+		Stall(&random, 8, 50000);
+	}
+	atomic_store(&test->done, true);
+	return NULL;
+}
+
+static void* Consumer(void* argument)
+{
+	RingTest* test = argument;
+	unsigned int random = 67890;
+	AudioReader reader;
+	audio_reader_init(&test->buffer, &reader);
+	static short copy[AUDIO_FRAME_SIZE];
+	bool started = false;
+	unsigned long long lastSequence = 0;
+	for (;;) {
+		bool done = atomic_load(&test->done);
+		// a reader ahead of the consumer, as the history and level meter are in main.c
+		const FrameInfo* readerInfo;
+		const short* readerFrame;
+		while ((readerFrame = acquire_reader_slot(&test->buffer, &reader, &readerInfo)) != NULL) {
+			memcpy(copy, readerFrame, sizeof(copy));
+			FrameInfo info = *readerInfo;
+			if (release_reader_slot(&test->buffer, &reader)) {
+				test->bad_frames += FrameIntact(copy, &info) ? 0 : 1;
+				++test->reader_frames;
+			}
+		}
+		const FrameInfo* info;
+		const short* frame = acquire_read_slot(&test->buffer, &info);
+		if (frame == NULL) {
+			if (done) {
+				break;
+			}
+			sched_yield();
+			continue;
+		}
+		// stall while holding the frame, the producer must not touch it meanwhile
+		Stall(&random, 32, 200000);
+		test->bad_frames += FrameIntact(frame, info) ? 0 : 1;
+		test->out_of_order += (started && info->sequence <= lastSequence) ? 1 : 0;
+		started = true;
+		lastSequence = info->sequence;
+		++test->frames;
+		release_read_slot(&test->buffer);
+	}
+	return NULL;
+}
+
+static void* LaggingReader(void* argument)
+{
+	RingTest* test = argument;
+	unsigned int random = 24680;
+	AudioReader reader;
+	audio_reader_init(&test->buffer, &reader);
+	static short copy[AUDIO_FRAME_SIZE];
+	for (;;) {
+		bool done = atomic_load(&test->done);
+		const FrameInfo* info;
+		const short* frame = acquire_reader_slot(&test->buffer, &reader, &info);
+		if (frame == NULL) {
+			if (done) {
+				break;
+			}
+			sched_yield();
+			continue;
+		}
+		// stall while reading, so the producer may refill the frame in between
+		Stall(&random, 4, 500000);
+		memcpy(copy, frame, sizeof(copy));
+		FrameInfo frameInfo = *info;
+		if (release_reader_slot(&test->buffer, &reader)) {
+			test->lagging_bad_frames += FrameIntact(copy, &frameInfo) ? 0 : 1;
+			++test->lagging_frames;
+		}
+	}
+	test->lagging_skipped = reader.skipped_frames;
+	return NULL;
+}
+
+/// <summary>
+///     Replaces the mirror mapping of a buffer with a ring whose start is copied past its end.
+/// </summary>
+static bool UseCopiedMirror(AudioBuffer* buffer)
+{
+	free_audio_buffer(buffer);
+	buffer->samples = calloc(AUDIO_RING_SAMPLES + AUDIO_FRAME_SIZE, sizeof(short));
+	buffer->mirrored = false;
+	return buffer->samples != NULL;
+}
+
+static void RunRingTest(AudioOverloadPolicy policy, bool mirrored)
+{
+	static RingTest test;
+	memset(&test, 0, sizeof(test));
+	atomic_init(&test.done, false);
+	if (!initialize_audio_buffer(&test.buffer) || (mirrored && !test.buffer.mirrored)
+		|| (!mirrored && !UseCopiedMirror(&test.buffer))) {
+		fprintf(stderr, "Could not set up the %s ring\n", mirrored ? "mirrored" : "copied");
+		++failures;
+		return;
+	}
+	set_audio_buffer_policy(&test.buffer, policy);
+	set_audio_buffer_depth(&test.buffer, TEST_DEPTH);
+
+	pthread_t producer, consumer, laggingReader;
+	pthread_create(&consumer, NULL, Consumer, &test);
+	pthread_create(&laggingReader, NULL, LaggingReader, &test);
+	pthread_create(&producer, NULL, Producer, &test);
+	pthread_join(producer, NULL);
+	pthread_join(consumer, NULL);
+	pthread_join(laggingReader, NULL);
+
+	unsigned int skipped = atomic_load(&test.buffer.overload_frames[AudioOverload_DropOldest]);
+	printf("policy %d, %s: %u hops committed, %u dropped; %u frames read, %u skipped, %u by the reader\n",
+		(int)policy, mirrored ? "mirrored" : "copied", test.committed, test.dropped, test.frames, skipped,
+		test.reader_frames);
+	printf("    lagging reader: %u frames read, %u skipped\n", test.lagging_frames, test.lagging_skipped);
+	CHECK(test.bad_frames == 0);
+	CHECK(test.lagging_bad_frames == 0);
+	CHECK(test.out_of_order == 0);
+	CHECK(atomic_load(&test.buffer.dropped_frames) == test.dropped);
+	// after priming, every committed hop completes one frame, which is read, skipped by the
+	// consumer or taken back by the producer
+	CHECK(test.frames + skipped == test.committed - AUDIO_FRAME_HOPS + 1);
+	if (policy != AudioOverload_DropOldest) {
+		CHECK(skipped == 0);
+	}
+	if (policy == AudioOverload_DropNewest) {
+		CHECK(atomic_load(&test.buffer.overload_frames[AudioOverload_DropNewest]) == test.dropped);
+	}
+	free_audio_buffer(&test.buffer);
+	close(test.buffer.dataAvailableFd);
+}
+
+/// <summary>
+///     Writes one hop with the next sequence number.
+/// </summary>
+/// <returns>True if the ring took the hop.</returns>
+static bool WriteHop(AudioBuffer* buffer, unsigned long long* sequence)
+{
+	FrameInfo* info;
+	short* hop = acquire_write_slot(buffer, &info);
+	if (hop != NULL) {
+		FillHop(hop, *sequence);
+		memset(info, 0, sizeof(*info));
+		info->sequence = *sequence;
+		commit_write_slot(buffer);
+	}
+	else {
+		drop_write_slot(buffer);
+	}
+	++*sequence;
+	return hop != NULL;
+}
+
+static void RunFullRingTest(AudioOverloadPolicy policy)
+{
+	static AudioBuffer buffer;
+	if (!initialize_audio_buffer(&buffer)) {
+		++failures;
+		return;
+	}
+	set_audio_buffer_policy(&buffer, policy);
+	set_audio_buffer_depth(&buffer, AUDIO_MAX_QUEUE_DEPTH);
+	// twice around the ring with nobody reading
+	unsigned long long sequence = 0;
+	unsigned int written = 0;
+	for (int i = 0; i < 2 * AUDIO_RING_HOPS; ++i) {
+		written += WriteHop(&buffer, &sequence) ? 1 : 0;
+	}
+	const FrameInfo* info;
+	const short* frame = acquire_read_slot(&buffer, &info);
+	CHECK(frame != NULL);
+	if (frame == NULL) {
+		return;
+	}
+	CHECK(FrameIntact(frame, info));
+	if (policy == AudioOverload_DropOldest) {
+		// every hop went in, and the oldest frame left is the one the last hop did not overwrite
+		CHECK(written == 2 * AUDIO_RING_HOPS);
+		CHECK(info->sequence == AUDIO_RING_HOPS);
+		CHECK(atomic_load(&buffer.overload_frames[AudioOverload_DropOldest]) == AUDIO_RING_HOPS);
+	}
+	else {
+		CHECK(written == AUDIO_RING_HOPS);
+		CHECK(info->sequence == 0);
+	}
+	CHECK(atomic_load(&buffer.dropped_frames) == 2 * AUDIO_RING_HOPS - written);
+	// while the consumer holds the oldest frame, the next hop would overwrite it
+	unsigned long long held = info->sequence;
+	CHECK(!WriteHop(&buffer, &sequence));
+	CHECK(FrameIntact(frame, info) && info->sequence == held);
+	release_read_slot(&buffer);
+	frame = acquire_read_slot(&buffer, &info);
+	CHECK(frame != NULL && info->sequence == held + 1);
+	if (frame != NULL) {
+		release_read_slot(&buffer);
+	}
+	if (policy == AudioOverload_DropOldest) {
+		// with the frame released the producer takes the next one back again
+		CHECK(WriteHop(&buffer, &sequence));
+	}
+	free_audio_buffer(&buffer);
+	close(buffer.dataAvailableFd);
+}
+
+int main(void)
+{
+	printf("Ring of %d samples, hop %d, frame %d, depth %d\n", AUDIO_RING_SAMPLES, AUDIO_HOP_SIZE,
+		AUDIO_FRAME_SIZE, TEST_DEPTH);
+	for (int policy = 0; policy < AudioOverload_Count; ++policy) {
+		RunRingTest((AudioOverloadPolicy)policy, true);
+		RunRingTest((AudioOverloadPolicy)policy, false);
+		RunFullRingTest((AudioOverloadPolicy)policy);
+	}
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Audio ring passed\n");
+	return 0;
+}
@@ -0,0 +1,159 @@
+// Checks that the file audio sources read what was written and release their file descriptor
+// whenever open fails.
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "audio_source.h"
+#include "common.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static void PutLe16(uint8_t* bytes, unsigned int value)
+{
+	bytes[0] = (uint8_t)value;
+	bytes[1] = (uint8_t)(value >> 8);
+}
+
+static void PutLe32(uint8_t* bytes, uint32_t value)
+{
+	PutLe16(bytes, value & 0xffff);
+	PutLe16(bytes + 2, value >> 16);
+}
+
+/// <summary>
+///     Writes a WAV file with a format chunk and the given samples.
+/// </summary>
+static void WriteWav(const char* path, int format, int channels, int sampleRate, int bits,
+	const short* samples, int count)
+{
+	uint8_t header[44];
+	uint32_t dataSize = (uint32_t)count * sizeof(short);
+	memcpy(header, "RIFF", 4);
+	PutLe32(header + 4, 36 + dataSize);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	PutLe32(header + 16, 16);
+	PutLe16(header + 20, (unsigned int)format);
+	PutLe16(header + 22, (unsigned int)channels);
+	PutLe32(header + 24, (uint32_t)sampleRate);
+	PutLe32(header + 28, (uint32_t)(sampleRate * channels * bits / 8));
+	PutLe16(header + 32, (unsigned int)(channels * bits / 8));
+	PutLe16(header + 34, (unsigned int)bits);
+	memcpy(header + 36, "data", 4);
+	PutLe32(header + 40, dataSize);
+	FILE* file = fopen(path, "wb");
+	fwrite(header, 1, sizeof(header), file);
+	fwrite(samples, sizeof(short), (size_t)count, file);
+	fclose(file);
+}
+
+static void WriteBytes(const char* path, const void* bytes, size_t size)
+{
+	FILE* file = fopen(path, "wb");
+	fwrite(bytes, 1, size, file);
+	fclose(file);
+}
+
+/// <summary>
+///     The lowest free file descriptor, which open takes next.
+/// </summary>
+static int NextFd(void)
+{
+	int fd = open("/dev/null", O_RDONLY);
+	close(fd);
+	return fd;
+}
+
+/// <summary>
+///     Opens a source which must fail to open, and checks that it leaves no file open.
+/// </summary>
+static void CheckOpenFails(AudioSource* source)
+{
+	int nextFd = NextFd();
+	CHECK(source->open(source) != 0);
+	CHECK(NextFd() == nextFd);
+	audio_source_destroy(source);
+}
+
+int main(void)
+{
+	char directory[] = "/tmp/safesound_sourcesXXXXXX";
+	if (mkdtemp(directory) == NULL) {
+		perror("mkdtemp");
+		return 1;
+	}
+	char path[128];
+	short samples[64];
+	for (int i = 0; i < 64; ++i) {
+		samples[i] = (short)(i * 1000 - 32000);
+	}
+
+	// a stereo file comes back as interleaved periods
+	snprintf(path, sizeof(path), "%s/stereo.wav", directory);
+	WriteWav(path, 1, 2, AUDIO_CAPTURE_RATE, 16, samples, 64);
+	AudioSource* source = wav_audio_source_create(path);
+	CHECK(source->open(source) == 0);
+	CHECK(source->channels == 2 && source->sample_rate == AUDIO_CAPTURE_RATE);
+	short read[64];
+	CHECK(source->read_block(source, read, 20) == 20);
+	CHECK(source->read_block(source, read + 40, 20) == 12);
+	CHECK(memcmp(read, samples, 40 * sizeof(short)) == 0);
+	CHECK(memcmp(read + 40, samples + 40, 24 * sizeof(short)) == 0);
+	CHECK(source->read_block(source, read, 20) == -1);
+	source->close(source);
+	audio_source_destroy(source);
+
+	// every way a header can be rejected closes the file again
+	snprintf(path, sizeof(path), "%s/missing.wav", directory);
+	CheckOpenFails(wav_audio_source_create(path));
+	snprintf(path, sizeof(path), "%s/text.wav", directory);
+	WriteBytes(path, "not a wave file", 15);
+	CheckOpenFails(wav_audio_source_create(path));
+	snprintf(path, sizeof(path), "%s/nodata.wav", directory);
+	WriteBytes(path, "RIFF\x04\0\0\0WAVE", 12);
+	CheckOpenFails(wav_audio_source_create(path));
+	snprintf(path, sizeof(path), "%s/float.wav", directory);
+	WriteWav(path, 3, 1, AUDIO_CAPTURE_RATE, 32, samples, 64);
+	CheckOpenFails(wav_audio_source_create(path));
+	snprintf(path, sizeof(path), "%s/surround.wav", directory);
+	WriteWav(path, 1, MAX_AUDIO_CHANNELS + 1, AUDIO_CAPTURE_RATE, 16, samples, 60);
+	CheckOpenFails(wav_audio_source_create(path));
+	snprintf(path, sizeof(path), "%s/missing.pcm", directory);
+	CheckOpenFails(pcm_audio_source_create(path));
+	// there is no ADC on the host
+	CheckOpenFails(audio_source_create("adc"));
+
+	// raw PCM in, the same samples out
+	snprintf(path, sizeof(path), "%s/raw.pcm", directory);
+	WriteBytes(path, samples, sizeof(samples));
+	source = pcm_audio_source_create(path);
+	CHECK(source->open(source) == 0);
+	CHECK(source->read_block(source, read, 64) == 64);
+	CHECK(memcmp(read, samples, sizeof(samples)) == 0);
+	CHECK(source->read_block(source, read, 64) == -1);
+	source->close(source);
+	audio_source_destroy(source);
+
+	char command[160];
+	snprintf(command, sizeof(command), "rm -r %s", directory);
+	if (system(command) != 0) {
+		fprintf(stderr, "Could not remove %s\n", directory);
+	}
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Audio sources passed\n");
+	return 0;
+}
@@ -0,0 +1,128 @@
+// Feeds the capture thread from a FIFO written at a rate below AUDIO_CAPTURE_RATE and checks
+// that the drift correction measures that rate, and that the resampler still delivers about
+// AUDIO_SAMPLE_RATE samples per second.
+#include <fcntl.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "record_audio.h"
+
+#define WRITER_RATE 15600  // samples/sec, 2.5% slow
+#define WRITER_SECONDS 10
+#define CHUNK_MS 10
+
+static char fifoPath[64];
+
+static void AddNs(struct timespec* time, long ns)
+{
+	time->tv_nsec += ns;
+	while (time->tv_nsec >= 1000000000L) {
+		time->tv_nsec -= 1000000000L;
+		++time->tv_sec;
+	}
+}
+
+/// <summary>
+///     Writes a tone to the FIFO, CHUNK_MS at a time, paced by CLOCK_MONOTONIC.
+/// </summary>
+static void* WriterThread(void* argument)
+{
+	int fd = open(fifoPath, O_WRONLY);
+	if (fd < 0) {
+		return NULL;
+	}
+	short chunk[WRITER_RATE * CHUNK_MS / 1000];
+	const int chunkSamples = (int)(sizeof(chunk) / sizeof(chunk[0]));
+	unsigned int sample = 0;
+	struct timespec next;
+	clock_gettime(CLOCK_MONOTONIC, &next);
+	for (int i = 0; i < WRITER_SECONDS * 1000 / CHUNK_MS; ++i) {
+		for (int j = 0; j < chunkSamples; ++j, ++sample) {
+			chunk[j] = (short)(8000 * sin(2 * 3.14159265358979 * 440.0 * sample / WRITER_RATE));
+		}
+		if (write(fd, chunk, sizeof(chunk)) != (ssize_t)sizeof(chunk)) {
+			break;
+		}
+		AddNs(&next, CHUNK_MS * 1000000L);
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL);
+	}
+	close(fd);
+	return NULL;
+}
+
+int main(void)
+{
+	snprintf(fifoPath, sizeof(fifoPath), "/tmp/safesound_rate_%d", (int)getpid());
+	if (mkfifo(fifoPath, 0600) != 0) {
+		perror("mkfifo");
+		return 1;
+	}
+	static AudioBuffer buffer;
+	static RecordAudioContext context;
+	if (!initialize_audio_buffer(&buffer)) {
+		return 1;
+	}
+	char spec[80];
+	snprintf(spec, sizeof(spec), "pcm:%s", fifoPath);
+	context.buffers[0] = &buffer;
+	context.buffer_count = 1;
+	context.source = audio_source_create(spec);
+
+	pthread_t writer, capture;
+	pthread_create(&writer, NULL, WriterThread, NULL);
+	// opening the FIFO waits for the writer
+	if (context.source == NULL || context.source->open(context.source) != 0) {
+		return 1;
+	}
+	pthread_create(&capture, NULL, RecordAudioThread, &context);
+	struct timespec start, now, tick = { .tv_sec = 0, .tv_nsec = 10000000 };
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	unsigned int startSamples = 0;
+	double startSeconds = 0;
+	while (!terminationRequired) {
+		nanosleep(&tick, NULL);
+		while (acquire_read_slot(&buffer, NULL) != NULL) {
+			release_read_slot(&buffer);
+		}
+		clock_gettime(CLOCK_MONOTONIC, &now);
+		double seconds = (double)(now.tv_sec - start.tv_sec) + (double)(now.tv_nsec - start.tv_nsec) / 1e9;
+		if (startSeconds == 0 && seconds >= 6.0) {
+			// the smoothed estimate has covered most of the way by now, measure the output from
+			// here on
+			startSamples = context.stats.samples;
+			startSeconds = seconds;
+		}
+	}
+	// the capture thread stops when the writer closes the FIFO
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	double seconds = (double)(now.tv_sec - start.tv_sec) + (double)(now.tv_nsec - start.tv_nsec) / 1e9
+		- startSeconds;
+	pthread_join(capture, NULL);
+	pthread_join(writer, NULL);
+	unlink(fifoPath);
+	context.source->close(context.source);
+	audio_source_destroy(context.source);
+
+	double outputRate = (context.stats.samples - startSamples) / seconds * AUDIO_CAPTURE_RATE / AUDIO_SAMPLE_RATE;
+	printf("Estimated input rate %.1f Hz for a %d Hz writer, %.0f samples/s out, %u samples lost to late wakeups\n",
+		context.stats.input_rate * AUDIO_CAPTURE_RATE / AUDIO_SAMPLE_RATE, WRITER_RATE, outputRate,
+		context.stats.lost_samples);
+	// the estimate is smoothed, so after a few seconds it has covered only part of the way from
+	// AUDIO_CAPTURE_RATE to the writer's rate, and the output part of the way back up
+	const double margin = (AUDIO_CAPTURE_RATE - WRITER_RATE) / 4.0;
+	bool rateMeasured = context.stats.input_rate * AUDIO_CAPTURE_RATE / AUDIO_SAMPLE_RATE
+		< AUDIO_CAPTURE_RATE - margin;
+	bool outputCorrected = outputRate > WRITER_RATE + margin;
+	if (!rateMeasured || !outputCorrected) {
+		fprintf(stderr, "Drift correction did not follow the writer\n");
+		return 1;
+	}
+	return 0;
+}
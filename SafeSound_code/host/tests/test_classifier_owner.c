@@ -0,0 +1,102 @@
+// Checks that the classifier serves one stream at a time and that active microphones take
+// turns: a second active microphone is left out until the first has had CLASSIFIER_TURN_FRAMES
+// frames, then starts afresh on its pre-roll, and neither is starved. A stream which holds the
+// classifier keeps out both.
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common.h"
+#include "process_audio.h"
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static short quiet[AUDIO_FRAME_SIZE];
+static short loud[AUDIO_FRAME_SIZE];
+static ActivityDetector detectors[2];
+static PredictionState states[2];
+static unsigned long long sequences[2];
+
+/// <summary>
+///     Passes the next frame of a microphone through predict_active_frame.
+/// </summary>
+/// <returns>Number of frames classified.</returns>
+static int Feed(int microphone, const short* frame)
+{
+	FrameInfo info = { .sequence = sequences[microphone]++ };
+	int prediction;
+	float confidence;
+	return predict_active_frame(&detectors[microphone], &states[microphone], frame, &info, false,
+		&prediction, &confidence);
+}
+
+int main(void)
+{
+	srand(1);
+	for (int i = 0; i < AUDIO_FRAME_SIZE; ++i) {
+		loud[i] = (short)(rand() % 20001 - 10000);
+	}
+	for (int microphone = 0; microphone < 2; ++microphone) {
+		activity_detector_init(&detectors[microphone]);
+		prediction_state_reset(&states[microphone]);
+		for (int i = 0; i < ACTIVITY_PREROLL_FRAMES; ++i) {
+			CHECK(Feed(microphone, quiet) == 0);
+		}
+	}
+
+	// microphone 0 turns active first and gets the classifier, with its pre-roll
+	CHECK(Feed(0, loud) == ACTIVITY_PREROLL_FRAMES + 1);
+	CHECK(Feed(1, loud) == 0);
+	CHECK(states[1].excluded_frames == 1);
+	CHECK(!states[1].decimated);
+
+	// both stay active, so microphone 0 keeps the classifier for its turn, then hands it over
+	const int turnRest = CLASSIFIER_TURN_FRAMES - ACTIVITY_PREROLL_FRAMES - 1;
+	for (int i = 1; i < turnRest; ++i) {
+		CHECK(Feed(0, loud) == 1);
+		CHECK(Feed(1, loud) == 0);
+	}
+	CHECK(Feed(0, loud) == 1);
+	CHECK(states[1].excluded_frames == (unsigned int)turnRest);
+	// microphone 1 starts afresh on the frames it left out last, and microphone 0 waits
+	CHECK(Feed(1, loud) == ACTIVITY_PREROLL_FRAMES + 1);
+	CHECK(Feed(0, loud) == 0);
+	CHECK(states[0].excluded_frames == 1);
+
+	// and gets it back after microphone 1's turn
+	for (int i = 1; i < turnRest; ++i) {
+		CHECK(Feed(1, loud) == 1);
+		CHECK(Feed(0, loud) == 0);
+	}
+	CHECK(Feed(1, loud) == 1);
+	CHECK(Feed(0, loud) == ACTIVITY_PREROLL_FRAMES + 1);
+	CHECK(Feed(1, loud) == 0);
+
+	// a held classifier keeps every microphone out, and only one stream can hold it
+	PredictionState replayState, otherState;
+	CHECK(predict_hold(&replayState));
+	CHECK(!predict_hold(&otherState));
+	CHECK(Feed(0, loud) == 0);
+	CHECK(Feed(1, loud) == 0);
+	predict_release(&otherState);
+	CHECK(Feed(0, loud) == 0);
+	// after the release, microphone 1 has waited longest and goes first
+	predict_release(&replayState);
+	CHECK(Feed(0, loud) == 0);
+	CHECK(Feed(1, loud) == ACTIVITY_PREROLL_FRAMES + 1);
+	CHECK(Feed(0, loud) == 0);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Classifier ownership passed\n");
+	return 0;
+}
@@ -0,0 +1,72 @@
+// Checks the logarithm of the native featurizer against double-precision log over a sweep of
+// the positive normal floats, both the scalar FastLog and FastLogs, which takes four values at a
+// time with NEON or SSE2. log_mel.c is included rather than linked, to reach them.
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "log_mel.c"
+
+#define FAST_LOG_MAX_ULP 2.0  // the bound given in log_mel.c
+#define SWEEP_STRIDE 61  // checks every 61st float, about 34 million values
+#define SWEEP_BATCH 64
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+/// <summary>
+///     Error of a float result in units of the last place of the exact result.
+/// </summary>
+static double UlpError(float result, double exact)
+{
+	if (exact == 0) {
+		return (result == 0) ? 0 : INFINITY;
+	}
+	double ulp = ldexp(1.0, ilogb((float)exact) - 23);
+	return fabs((double)result - exact) / ulp;
+}
+
+int main(void)
+{
+	double maxScalar = 0, maxVector = 0;
+	float worstInput = 0;
+	float x[SWEEP_BATCH], y[SWEEP_BATCH];
+	int batch = 0;
+	for (uint32_t bits = 0x00800000; bits <= 0x7f7fffff - SWEEP_STRIDE; bits += SWEEP_STRIDE) {
+		memcpy(&x[batch], &bits, sizeof(float));
+		if (++batch < SWEEP_BATCH) {
+			continue;
+		}
+		FastLogs(x, y, SWEEP_BATCH);
+		for (int i = 0; i < SWEEP_BATCH; ++i) {
+			double exact = log((double)x[i]);
+			double scalarError = UlpError(FastLog(x[i]), exact);
+			if (scalarError > maxScalar) {
+				maxScalar = scalarError;
+				worstInput = x[i];
+			}
+			maxVector = fmax(maxVector, UlpError(y[i], exact));
+		}
+		batch = 0;
+	}
+	printf("FastLog within %.2f ulp, worst at %g; FastLogs within %.2f ulp\n", maxScalar, worstInput, maxVector);
+	CHECK(maxScalar <= FAST_LOG_MAX_ULP);
+	CHECK(maxVector <= FAST_LOG_MAX_ULP);
+	// the values the featurizer sees start at LOG_MEL_OFFSET
+	CHECK(FastLog(1.0f) == 0.0f);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Fast log passed\n");
+	return 0;
+}
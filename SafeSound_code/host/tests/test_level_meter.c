@@ -0,0 +1,99 @@
+// Checks the level meter against levels worked out by hand: a sine, full-scale and silent
+// blocks, and a mix of a loud and a quiet level whose energy average, percentiles, minimum and
+// maximum are known.
+#include <math.h>
+#include <stdio.h>
+
+#include "common.h"
+#include "level_meter.h"
+
+#define LEVEL_TOLERANCE_DB 0.05f
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static bool Near(float value, double expected)
+{
+	return fabs(value - expected) < LEVEL_TOLERANCE_DB;
+}
+
+static void FillSquare(short* block, int amplitude)
+{
+	for (int i = 0; i < AUDIO_HOP_SIZE; ++i) {
+		block[i] = (short)((i % 2 == 0) ? amplitude : -amplitude);
+	}
+}
+
+int main(void)
+{
+	static short block[AUDIO_HOP_SIZE];
+	LevelMeter meter;
+	LevelSummary summary;
+
+	// a sine of amplitude 1000 over whole periods: RMS 1000 / sqrt(2), peak 1000
+	level_meter_init(&meter);
+	CHECK(!level_meter_summarize(&meter, &summary));
+	const int period = 32;
+	float sineDb = 0;
+	for (int hop = 0; hop < 100; ++hop) {
+		for (int i = 0; i < AUDIO_HOP_SIZE; ++i) {
+			block[i] = (short)lrint(1000.0 * sin(2 * 3.14159265358979 * i / period));
+		}
+		sineDb = level_meter_process(&meter, block, AUDIO_HOP_SIZE);
+	}
+	const double sineExpected = 20.0 * log10(1000.0 / sqrt(2.0) / 32768.0);
+	printf("Sine of amplitude 1000: %.2f dBFS, expected %.2f\n", sineDb, sineExpected);
+	CHECK(Near(sineDb, sineExpected));
+	CHECK(level_meter_summarize(&meter, &summary));
+	CHECK(summary.blocks == 100);
+	CHECK(Near(summary.leq_db, sineExpected));
+	CHECK(Near(summary.peak_db, 20.0 * log10(1000.0 / 32768.0)));
+
+	// the extremes
+	level_meter_init(&meter);
+	for (int i = 0; i < AUDIO_HOP_SIZE; ++i) {
+		block[i] = (short)((i % 2 == 0) ? 32767 : -32768);
+	}
+	CHECK(Near(level_meter_process(&meter, block, AUDIO_HOP_SIZE), 0.0));
+	FillSquare(block, 0);
+	CHECK(level_meter_process(&meter, block, AUDIO_HOP_SIZE) == LEVEL_FLOOR_DB);
+	CHECK(level_meter_summarize(&meter, &summary));
+	CHECK(summary.min_db == LEVEL_FLOOR_DB);
+	CHECK(Near(summary.peak_db, 0.0));
+
+	// 20 loud blocks among 80 quiet ones
+	const int loud = 11610, quiet = 1000;
+	const double loudDb = 20.0 * log10(loud / 32768.0), quietDb = 20.0 * log10(quiet / 32768.0);
+	level_meter_init(&meter);
+	for (int hop = 0; hop < 100; ++hop) {
+		FillSquare(block, (hop % 5 == 0) ? loud : quiet);
+		level_meter_process(&meter, block, AUDIO_HOP_SIZE);
+	}
+	CHECK(level_meter_summarize(&meter, &summary));
+	const double leqExpected = 10.0 * log10(0.2 * pow(10.0, loudDb / 10) + 0.8 * pow(10.0, quietDb / 10));
+	printf("Mix of %.1f and %.1f dBFS: Leq %.2f dBFS, expected %.2f\n", loudDb, quietDb, summary.leq_db,
+		leqExpected);
+	CHECK(Near(summary.leq_db, leqExpected));
+	CHECK(Near(summary.min_db, quietDb));
+	CHECK(Near(summary.max_db, loudDb));
+	// percentiles are the upper edges of 1 dB bins
+	CHECK(summary.p10_db == ceilf((float)quietDb));
+	CHECK(summary.p50_db == ceilf((float)quietDb));
+	CHECK(summary.p90_db == ceilf((float)loudDb));
+	// summarizing starts a new period
+	CHECK(!level_meter_summarize(&meter, &summary));
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Level meter passed\n");
+	return 0;
+}
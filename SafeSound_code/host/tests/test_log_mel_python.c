@@ -0,0 +1,96 @@
+// Checks the native featurizer against the Python model of the ELL featurizer in
+// tools/generate_prerecorded_features.py, on the prerecorded window break clip. The model
+// reimplements ELL's algorithm and bin edges in double precision and wrote its features to
+// window_break_features.h; they are not output of ELL's mfcc_Filter, which only runs on the Azure
+// Sphere. So this catches changes to the native featurizer and drift between it and the model,
+// not differences from ELL itself, which only a device build with AUDIO_FEATURIZER_SELF_TEST
+// measures. The float path must match the model to within float rounding, and the fixed-point
+// path must stay within LOG_MEL_FIXED_TOLERANCE of the float path.
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common.h"
+#include "decimator.h"
+#include "log_mel.h"
+#include "process_audio.h"
+#include "window_break_features.h"
+
+// Largest difference of the float path from the double-precision model. Float rounding
+// accounts for a few 1e-7; LOG_MEL_TOLERANCE, the bound against ELL, is far looser.
+#define NATIVE_TOLERANCE 1e-5f
+
+// defined in window_break.h, which process_audio.c includes
+extern short sample_wav_data[][AUDIO_CAPTURE_FRAME_SIZE];
+
+#define CLIP_ROWS ((int)(sizeof(sample_wav_features) / sizeof(sample_wav_features[0])))
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static float MaxDifference(const float* a, const float* b, int count)
+{
+	float max = 0;
+	for (int i = 0; i < count; ++i) {
+		float difference = fabsf(a[i] - b[i]);
+		if (difference > max) {
+			max = difference;
+		}
+	}
+	return max;
+}
+
+int main(void)
+{
+#if AUDIO_DECIMATION > 1
+	Decimator decimator;
+	decimator_init(&decimator);
+#endif
+	static short frame[AUDIO_FRAME_SIZE];
+	static float input[AUDIO_FRAME_SIZE];
+	float features[LOG_MEL_FILTERS], fixedFeatures[LOG_MEL_FILTERS];
+	float nativeError = 0, fixedError = 0;
+	for (int row = 0; row < CLIP_ROWS; ++row) {
+		// the rows are consecutive, as PrerecordedFrame takes them
+#if AUDIO_DECIMATION > 1
+		decimator_process(&decimator, sample_wav_data[row], AUDIO_CAPTURE_FRAME_SIZE, frame);
+#else
+		memcpy(frame, sample_wav_data[row], sizeof(frame));
+#endif
+		pcm_to_float(frame, input, AUDIO_FRAME_SIZE);
+		log_mel_filter(input, features);
+		log_mel_filter_pcm(frame, fixedFeatures);
+		nativeError = fmaxf(nativeError, MaxDifference(features, sample_wav_features[row], LOG_MEL_FILTERS));
+		fixedError = fmaxf(fixedError, MaxDifference(fixedFeatures, features, LOG_MEL_FILTERS));
+	}
+	printf("%d frames: float path within %.2g of the Python model, fixed-point path within %.2g of the float path\n",
+		CLIP_ROWS, nativeError, fixedError);
+	CHECK(nativeError <= NATIVE_TOLERANCE);
+	CHECK(fixedError <= LOG_MEL_FIXED_TOLERANCE);
+
+	// silence has no energy in any filter, so every feature is log(LOG_MEL_OFFSET)
+	memset(frame, 0, sizeof(frame));
+	pcm_to_float(frame, input, AUDIO_FRAME_SIZE);
+	log_mel_filter(input, features);
+	log_mel_filter_pcm(frame, fixedFeatures);
+	bool silent = true;
+	for (int i = 0; i < LOG_MEL_FILTERS; ++i) {
+		silent = silent && fabsf(features[i] - logf(LOG_MEL_OFFSET)) < 1e-6f
+			&& fabsf(fixedFeatures[i] - logf(LOG_MEL_OFFSET)) < 1e-6f;
+	}
+	CHECK(silent);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Log-mel featurizer against the Python model passed\n");
+	return 0;
+}
@@ -0,0 +1,173 @@
+// Checks that a replay worked off in steps gives the same results as one in a single pass, that
+// background noise is never reported as a detection, that the window break clip yields the
+// frames the rate profile makes of it, and that files which do not match the rate profile are
+// rejected without leaking their file.
+#include <fcntl.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "replay.h"
+
+// Samples of WINDOW_BREAK_WAV, which is recorded at AUDIO_CAPTURE_RATE
+#define WINDOW_BREAK_SAMPLES 17920
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static void PutLe16(uint8_t* bytes, unsigned int value)
+{
+	bytes[0] = (uint8_t)value;
+	bytes[1] = (uint8_t)(value >> 8);
+}
+
+static void PutLe32(uint8_t* bytes, uint32_t value)
+{
+	PutLe16(bytes, value & 0xffff);
+	PutLe16(bytes + 2, value >> 16);
+}
+
+/// <summary>
+///     Writes a 16-bit PCM WAV file with the given number of periods: silence for the first
+///     silent ones, then a decaying 1 kHz tone.
+/// </summary>
+static void WriteToneWav(const char* path, int channels, int sampleRate, int periods, int silent)
+{
+	uint8_t header[44];
+	uint32_t dataSize = (uint32_t)(periods * channels) * sizeof(short);
+	memcpy(header, "RIFF", 4);
+	PutLe32(header + 4, 36 + dataSize);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	PutLe32(header + 16, 16);
+	PutLe16(header + 20, 1);
+	PutLe16(header + 22, (unsigned int)channels);
+	PutLe32(header + 24, (uint32_t)sampleRate);
+	PutLe32(header + 28, (uint32_t)(sampleRate * channels * 2));
+	PutLe16(header + 32, (unsigned int)(channels * 2));
+	PutLe16(header + 34, 16);
+	memcpy(header + 36, "data", 4);
+	PutLe32(header + 40, dataSize);
+	FILE* file = fopen(path, "wb");
+	fwrite(header, 1, sizeof(header), file);
+	for (int i = 0; i < periods; ++i) {
+		double t = (double)(i - silent) / sampleRate;
+		short sample = (i < silent) ? 0
+			: (short)(20000.0 * exp(-4.0 * t) * sin(2 * 3.14159265358979 * 1000.0 * t));
+		for (int channel = 0; channel < channels; ++channel) {
+			fwrite(&sample, sizeof(sample), 1, file);
+		}
+	}
+	fclose(file);
+}
+
+/// <summary>
+///     The lowest free file descriptor, which open takes next.
+/// </summary>
+static int NextFd(void)
+{
+	int fd = open("/dev/null", O_RDONLY);
+	close(fd);
+	return fd;
+}
+
+static void CheckRejected(const char* path)
+{
+	int nextFd = NextFd();
+	ReplayResult result;
+	CHECK(!replay_wav_file(path, 0.5f, &result));
+	CHECK(NextFd() == nextFd);
+}
+
+int main(void)
+{
+	char directory[] = "/tmp/safesound_replayXXXXXX";
+	if (mkdtemp(directory) == NULL) {
+		perror("mkdtemp");
+		return 1;
+	}
+	if (!check_predict_setup()) {
+		return 1;
+	}
+	char path[128];
+
+	// a whole pass, and the same file one frame per step, see the same frames
+	const int frames = 20;
+	snprintf(path, sizeof(path), "%s/tone.wav", directory);
+	WriteToneWav(path, 1, AUDIO_SAMPLE_RATE, AUDIO_FRAME_SIZE + (frames - 1) * AUDIO_HOP_SIZE, 0);
+	ReplayResult whole;
+	CHECK(replay_wav_file(path, 0.5f, &whole));
+	CHECK(whole.frames == (unsigned int)frames);
+	CHECK(whole.samples == (unsigned long long)(AUDIO_FRAME_SIZE + (frames - 1) * AUDIO_HOP_SIZE));
+
+	static Replay replay;
+	AudioSource* source = wav_audio_source_create(path);
+	CHECK(replay_open(&replay, source, 0.5f));
+	int steps = 0;
+	while (replay_step(&replay, 1)) {
+		++steps;
+	}
+	replay_close(&replay);
+	audio_source_destroy(source);
+	CHECK(steps == frames - 1);
+	CHECK(replay.result.frames == whole.frames);
+	CHECK(replay.result.skipped_frames == whole.skipped_frames);
+	CHECK(replay.result.detection_count == whole.detection_count);
+
+	// a tone after silence opens the activity gate for long enough to detect something, and
+	// the classifier's background noise category is not a detection
+	snprintf(path, sizeof(path), "%s/onset.wav", directory);
+	WriteToneWav(path, 1, AUDIO_SAMPLE_RATE, AUDIO_SAMPLE_RATE * 5 / 4, AUDIO_SAMPLE_RATE / 4);
+	ReplayResult onset;
+	CHECK(replay_wav_file(path, 0.5f, &onset));
+	CHECK(onset.skipped_frames < onset.frames);
+	for (int i = 0; i < onset.detection_count && i < REPLAY_MAX_DETECTIONS; ++i) {
+		CHECK(onset.detections[i].prediction != 0);
+	}
+
+	// the clip at the capture rate comes out as one frame per hop of the profile, after decimation
+	ReplayResult clip;
+	CHECK(replay_wav_file(WINDOW_BREAK_WAV, 0.5f, &clip));
+	const unsigned int clipSamples = WINDOW_BREAK_SAMPLES / AUDIO_DECIMATION;
+	CHECK(clip.frames == (clipSamples - AUDIO_FRAME_SIZE) / AUDIO_HOP_SIZE + 1);
+
+	// the capture rate is only accepted when the profile decimates it
+	snprintf(path, sizeof(path), "%s/capture.wav", directory);
+	WriteToneWav(path, 1, AUDIO_CAPTURE_RATE, AUDIO_CAPTURE_FRAME_SIZE * 2, 0);
+	ReplayResult captured;
+	CHECK(replay_wav_file(path, 0.5f, &captured));
+	CHECK(captured.frames > 0);
+
+	// any other rate, or more than one channel, is rejected
+	snprintf(path, sizeof(path), "%s/cd.wav", directory);
+	WriteToneWav(path, 1, 44100, 44100, 0);
+	CheckRejected(path);
+	snprintf(path, sizeof(path), "%s/half.wav", directory);
+	WriteToneWav(path, 1, AUDIO_SAMPLE_RATE / 2, AUDIO_SAMPLE_RATE, 0);
+	CheckRejected(path);
+	snprintf(path, sizeof(path), "%s/stereo.wav", directory);
+	WriteToneWav(path, 2, AUDIO_SAMPLE_RATE, AUDIO_SAMPLE_RATE, 0);
+	CheckRejected(path);
+
+	char command[160];
+	snprintf(command, sizeof(command), "rm -r %s", directory);
+	if (system(command) != 0) {
+		fprintf(stderr, "Could not remove %s\n", directory);
+	}
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Replay passed\n");
+	return 0;
+}
@@ -0,0 +1,103 @@
+// Checks that the drift-correcting resampler passes audio through untouched at the nominal rate,
+// including tones near the top of the band, and that once it has measured a faster input rate
+// it delivers fewer samples and keeps a tone in the passband at its level.
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common.h"
+#include "resampler.h"
+
+#define TEST_SECONDS 4
+#define FAST_RATE (AUDIO_SAMPLE_RATE * 1.01)  // input samples/sec of the drifting source
+#define LEVEL_TOLERANCE_DB 0.5
+
+static int failures = 0;
+
+#define CHECK(condition)                                                            \
+	do {                                                                            \
+		if (!(condition)) {                                                         \
+			fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+			++failures;                                                             \
+		}                                                                           \
+	} while (0)
+
+static short input[TEST_SECONDS * AUDIO_SAMPLE_RATE];
+static short output[2 * TEST_SECONDS * AUDIO_SAMPLE_RATE];
+
+static void FillTone(double frequency, int count)
+{
+	for (int i = 0; i < count; ++i) {
+		input[i] = (short)lrint(10000.0 * sin(2 * 3.14159265358979 * frequency * i / AUDIO_SAMPLE_RATE));
+	}
+}
+
+static double RmsDb(const short* samples, int count)
+{
+	double sum = 0;
+	for (int i = 0; i < count; ++i) {
+		sum += (double)samples[i] * samples[i];
+	}
+	return 10.0 * log10(sum / count);
+}
+
+/// <summary>
+///     Resamples the input in blocks of AUDIO_CAPTURE_BLOCK_SIZE, as the capture thread does.
+///     With a rate, each block is timestamped as if the source delivered that many samples per
+///     second.
+/// </summary>
+/// <returns>Number of output samples.</returns>
+static int Resample(Resampler* rs, int count, double rate)
+{
+	int produced = 0;
+	struct timespec timestamp = { 0, 0 };
+	for (int start = 0; start + AUDIO_CAPTURE_BLOCK_SIZE <= count; start += AUDIO_CAPTURE_BLOCK_SIZE) {
+		if (rate > 0) {
+			long long ns = (long long)((start + AUDIO_CAPTURE_BLOCK_SIZE) * 1e9 / rate);
+			timestamp.tv_sec = (time_t)(ns / 1000000000LL);
+			timestamp.tv_nsec = (long)(ns % 1000000000LL);
+			resampler_update_rate(rs, AUDIO_CAPTURE_BLOCK_SIZE, &timestamp);
+		}
+		produced += resampler_process(rs, input + start, AUDIO_CAPTURE_BLOCK_SIZE, output + produced,
+			RESAMPLER_MAX_OUTPUT);
+	}
+	return produced;
+}
+
+int main(void)
+{
+	const int count = TEST_SECONDS * AUDIO_SAMPLE_RATE;
+	Resampler rs;
+
+	// at the nominal rate every sample comes out as it went in, up to the top of the band
+	const double tones[] = { 1000.0, 0.45 * AUDIO_SAMPLE_RATE };
+	for (size_t i = 0; i < sizeof(tones) / sizeof(tones[0]); ++i) {
+		FillTone(tones[i], count);
+		resampler_init(&rs);
+		int produced = Resample(&rs, count, 0);
+		printf("%.0f Hz at the nominal rate: %d of %d samples out\n", tones[i], produced, count);
+		CHECK(produced > count - RESAMPLER_TAPS);
+		CHECK(memcmp(output, input, (size_t)produced * sizeof(short)) == 0);
+	}
+
+	// a source 1% fast: once the estimate moves up, fewer samples come out
+	FillTone(1000.0, count);
+	resampler_init(&rs);
+	int produced = Resample(&rs, count, FAST_RATE);
+	printf("1000 Hz from a source at %.0f Hz: input rate estimated at %.1f Hz, %d of %d samples out\n",
+		FAST_RATE, rs.input_rate, produced, count);
+	CHECK(rs.step > 1.0);
+	CHECK(produced < count);
+	// the tone keeps its level, measured over the last second, where the step has settled
+	double levelChange = RmsDb(output + produced - AUDIO_SAMPLE_RATE, AUDIO_SAMPLE_RATE)
+		- RmsDb(input, AUDIO_SAMPLE_RATE);
+	printf("Level change %.2f dB\n", levelChange);
+	CHECK(fabs(levelChange) < LEVEL_TOLERANCE_DB);
+
+	if (failures > 0) {
+		fprintf(stderr, "%d checks failed\n", failures);
+		return 1;
+	}
+	printf("Resampler passed\n");
+	return 0;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "common.h"
+
+// Frames kept so the classifier can warm up on the audio just before it starts on a stream:
+// the quiet frames before an onset, or the frames left out while another stream had it
+#define ACTIVITY_PREROLL_FRAMES 2
+// Frames that stay active after the last loud frame. Covers the agreeing frames that
+// smooth_prediction needs, so a detection is not cut short.
+#define ACTIVITY_HANGOVER_FRAMES 12
+// Level above the noise floor, as a mean square ratio, that counts as activity
+#define ACTIVITY_ENERGY_RATIO 4.0f  // 6 dB over the full band
+#define ACTIVITY_BAND_RATIO 4.0f  // 6 dB over the high band
+// Noise floor never drops below this mean square, about -70 dBFS
+#define ACTIVITY_MIN_NOISE_FLOOR 100.0f
+
+typedef enum ActivityResult {
+	ActivityResult_Inactive,  // quiet frame, may be skipped
+	ActivityResult_Onset,  // first active frame after quiet ones, the pre-roll is available
+	ActivityResult_Active,
+} ActivityResult;
+
+/// <summary>
+/// Streaming energy gate for one microphone. Compares the full band level and the high band
+/// level (first difference of the samples) of each frame with adaptive noise floors.
+/// Use the activity_detector_* functions to manipulate this struct.
+/// </summary>
+typedef struct ActivityDetector {
+	float noise_floor;  // background mean square level of the full band
+	float band_noise_floor;  // background mean square level of the high band
+	int hangover;  // active frames left after the last loud frame
+	bool active;
+	bool floor_ready;  // false until the first frame has set the noise floors
+	short preroll[ACTIVITY_PREROLL_FRAMES][AUDIO_FRAME_SIZE];  // latest frames not classified
+	FrameInfo preroll_info[ACTIVITY_PREROLL_FRAMES];  // origin of the pre-roll frames
+	int preroll_count;  // valid frames in preroll
+	int preroll_next;  // slot the next quiet frame is stored in
+	unsigned int frames;  // frames processed since the counters were last cleared
+	unsigned int skipped_frames;  // frames found inactive since the counters were last cleared
+} ActivityDetector;
+
+/// <summary>
+///     Clears the noise floors, pre-roll and counters.
+/// </summary>
+/// <param name="detector">ActivityDetector to initialize.</param>
+void activity_detector_init(ActivityDetector* detector);
+
+/// <summary>
+///     Classifies the next frame as active or inactive and updates the noise floors.
+///     Always reports activity if AUDIO_ACTIVITY_GATE is 0.
+/// </summary>
+/// <param name="detector">ActivityDetector to use.</param>
+/// <param name="frame">AUDIO_FRAME_SIZE samples of 16-bit PCM audio.</param>
+/// <param name="info">Origin of the frame, kept with it if it becomes pre-roll.</param>
+/// <returns>Whether the frame is active, and whether it is the first active one.</returns>
+ActivityResult activity_detector_process(ActivityDetector* detector, const short* frame,
+	const FrameInfo* info);
+
+/// <summary>
+///     Keeps a frame as pre-roll, replacing the oldest one if the pre-roll is full.
+///     activity_detector_process keeps every quiet frame.
+/// </summary>
+/// <param name="detector">ActivityDetector to use.</param>
+/// <param name="frame">AUDIO_FRAME_SIZE samples of 16-bit PCM audio.</param>
+/// <param name="info">Origin of the frame.</param>
+void activity_detector_add_preroll(ActivityDetector* detector, const short* frame,
+	const FrameInfo* info);
+
+/// <summary>
+///     Drops the pre-roll once it has been classified, so it is not used again.
+/// </summary>
+/// <param name="detector">ActivityDetector to use.</param>
+void activity_detector_clear_preroll(ActivityDetector* detector);
+
+/// <summary>
+///     Returns a pre-roll frame, in the order they were kept.
+/// </summary>
+/// <param name="detector">ActivityDetector to use.</param>
+/// <param name="index">0 for the oldest frame, up to preroll_count - 1.</param>
+/// <param name="info">Receives the origin of the frame.</param>
+/// <returns>AUDIO_FRAME_SIZE samples of 16-bit PCM audio.</returns>
+const short* activity_detector_preroll(const ActivityDetector* detector, int index,
+	const FrameInfo** info);
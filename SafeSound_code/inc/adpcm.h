@@ -0,0 +1,29 @@
+#pragma once
+
+#define ADPCM_BLOCK_BYTES 256  // bytes per encoded block, the WAV block alignment
+// Samples per block: the header holds the first sample, every other byte holds two
+#define ADPCM_BLOCK_SAMPLES ((ADPCM_BLOCK_BYTES - 4) * 2 + 1)
+
+/// <summary>
+/// IMA ADPCM encoder state carried from one block to the next.
+/// Use the adpcm_* functions to manipulate this struct.
+/// </summary>
+typedef struct AdpcmEncoder {
+	int step_index;  // index into the step size table (0 - 88)
+} AdpcmEncoder;
+
+/// <summary>
+///     Starts the encoder at the smallest step size.
+/// </summary>
+/// <param name="encoder">AdpcmEncoder to initialize.</param>
+void adpcm_encoder_init(AdpcmEncoder* encoder);
+
+/// <summary>
+///     Encodes one block of mono 16-bit PCM as IMA ADPCM, 4 bits per sample, in the block
+///     layout of WAV files with format tag 0x0011. The header holds the first sample exactly,
+///     so every block decodes on its own.
+/// </summary>
+/// <param name="encoder">AdpcmEncoder of the stream the block belongs to.</param>
+/// <param name="samples">ADPCM_BLOCK_SAMPLES samples to encode.</param>
+/// <param name="block">Receives ADPCM_BLOCK_BYTES bytes.</param>
+void adpcm_encode_block(AdpcmEncoder* encoder, const short* samples, unsigned char* block);
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <time.h>
+
+#include "adpcm.h"
+#include "common.h"
+
+#define AUDIO_SNAPSHOT_PRE_SECONDS 2  // audio kept from before the onset of a detection
+#define AUDIO_SNAPSHOT_POST_SECONDS 1  // audio recorded after the detection
+// Encoded audio kept per microphone. The second beyond the snapshot covers the time between
+// the onset and the detection.
+#define AUDIO_HISTORY_SECONDS (AUDIO_SNAPSHOT_PRE_SECONDS + AUDIO_SNAPSHOT_POST_SECONDS + 1)
+#define AUDIO_HISTORY_BLOCKS \
+	((AUDIO_HISTORY_SECONDS * AUDIO_SAMPLE_RATE + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES)
+#define AUDIO_HISTORY_BYTES (AUDIO_HISTORY_BLOCKS * ADPCM_BLOCK_BYTES)  // memory per microphone
+#define AUDIO_CLIP_HEADER_BYTES 60  // RIFF, fmt, fact and data chunk headers of a clip
+
+/// <summary>
+/// Rolling IMA ADPCM history of the last AUDIO_HISTORY_SECONDS of one microphone, from which
+/// a clip around a detection can be frozen. The ring is allocated on first use.
+/// Use the audio_history_* functions to manipulate this struct.
+/// </summary>
+typedef struct AudioHistory {
+	unsigned char (*blocks)[ADPCM_BLOCK_BYTES];  // ring of AUDIO_HISTORY_BLOCKS encoded blocks
+	bool disabled;  // the ring could not be allocated
+	unsigned long long block_count;  // blocks encoded since the history was initialized
+	short pending[ADPCM_BLOCK_SAMPLES];  // samples waiting for the next block
+	int pending_count;
+	AdpcmEncoder encoder;
+	bool timed;  // appended samples came with their capture time
+	struct timespec last_time;  // CLOCK_REALTIME time the last appended samples were captured
+	unsigned long long last_time_sample;  // sample of the history captured at last_time
+	bool freezing;  // a clip was requested and its post-roll is still being recorded
+	unsigned long long clip_start;  // first block of the requested clip
+	unsigned long long clip_end;  // block after the requested clip
+} AudioHistory;
+
+/// <summary>
+///     Empties the history. The ring is not allocated until audio is appended.
+/// </summary>
+/// <param name="history">AudioHistory to initialize.</param>
+void audio_history_init(AudioHistory* history);
+
+/// <summary>
+///     Releases the ring.
+/// </summary>
+/// <param name="history">AudioHistory to release.</param>
+void audio_history_free(AudioHistory* history);
+
+/// <summary>
+///     Encodes samples into the history, overwriting the oldest blocks.
+/// </summary>
+/// <param name="history">AudioHistory to use.</param>
+/// <param name="samples">16-bit PCM samples following the ones appended before.</param>
+/// <param name="count">Number of samples.</param>
+/// <param name="capture_time">
+///		Optional. CLOCK_REALTIME time the first of the samples was captured, which dates the
+///		history for audio_history_freeze.
+/// </param>
+void audio_history_append(AudioHistory* history, const short* samples, int count,
+	const struct timespec* capture_time);
+
+/// <summary>
+///     Requests a clip of the audio from before an onset to after now. Older audio than the
+///     history holds is left out.
+/// </summary>
+/// <param name="history">AudioHistory to use.</param>
+/// <param name="onset">
+///		Optional. CLOCK_REALTIME capture time of the onset. Without it, or when the appended
+///		samples came without their capture time, the onset is the last appended sample.
+/// </param>
+/// <param name="pre_samples">Samples before the onset to include.</param>
+/// <param name="post_samples">Samples still to be appended to include.</param>
+/// <returns>True if the clip was requested, false if another clip is still being recorded.</returns>
+bool audio_history_freeze(AudioHistory* history, const struct timespec* onset, unsigned int pre_samples,
+	unsigned int post_samples);
+
+/// <summary>
+///     Returns the requested clip once its post-roll has been appended.
+/// </summary>
+/// <param name="history">AudioHistory to use.</param>
+/// <param name="size">Receives the size of the clip in bytes.</param>
+/// <returns>
+///		The clip as a mono IMA ADPCM WAV file which must be freed with free(), or NULL if no clip
+///		is ready or there is not enough memory.
+///	</returns>
+unsigned char* audio_history_take_clip(AudioHistory* history, size_t* size);
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <stdbool.h>
+
+/// <summary>
+/// A source of 16-bit PCM audio which RecordAudioThread reads from on every capture wakeup.
+/// Create one with audio_source_create and release it with audio_source_destroy.
+/// </summary>
+typedef struct AudioSource {
+	const char* name;  // short description of the source type
+	int sample_rate;  // samples/sec delivered by read_block
+	int channels;  // number of channels delivered by read_block
+	int bits_per_sample;  // significant bits in the original samples
+	// True if samples that are not read on time are lost (e.g. a microphone).
+	// False if the source can always deliver the next sample (e.g. a file).
+	bool live;
+	// Most sample periods one read_block call delivers one sample period apart, or 0 for no
+	// limit. A source which takes each reading when it is polled (e.g. the ADC) returns a block
+	// of readings taken back to back, so it sets 1 and is polled on every sample period. The
+	// capture thread still stores its readings in blocks of AUDIO_CAPTURE_BLOCK_SIZE.
+	int max_block;
+
+	/// <summary>
+	///     Prepares the source for reading.
+	/// </summary>
+	/// <returns>0 on success, or -1 on failure</returns>
+	int (*open)(struct AudioSource* source);
+
+	/// <summary>
+	///     Reads up to count sample periods. Each period holds one sample per channel, so
+	///     samples receives up to count * channels interleaved samples. A live source may
+	///     return fewer periods than requested if they are not available yet.
+	/// </summary>
+	/// <returns>Number of sample periods read, or -1 at the end of the stream or on failure.</returns>
+	int (*read_block)(struct AudioSource* source, short* samples, int count);
+
+	/// <summary>
+	///     Releases everything acquired by open.
+	/// </summary>
+	void (*close)(struct AudioSource* source);
+
+	void* context;  // implementation specific state
+} AudioSource;
+
+/// <summary>
+///     Creates an audio source from a specification string. Supported specifications are:
+///			"adc"                      the microphone on ADC channel MICROPHONE
+///			"adc:channel,channel,..."  one microphone on each listed MICROPHONE_CONTROLLER channel
+///			"wav:path"                 a 16-bit PCM WAV file with up to MAX_AUDIO_CHANNELS channels
+///			"pcm:path"                 raw 16-bit little endian PCM from a file, pipe or FIFO
+///			"synth:tone:frequency"     a sine wave with the given frequency in Hz
+///			"synth:noise"              white noise
+///			"synth:impulse:period"     a single full-scale sample every period milliseconds
+///		Relative paths are opened from the image package.
+/// </summary>
+/// <param name="spec">Audio source specification.</param>
+/// <returns>The new audio source, or NULL if spec is invalid or out of memory.</returns>
+AudioSource* audio_source_create(const char* spec);
+
+/// <summary>
+///     Frees an audio source created with audio_source_create. The source must be closed.
+/// </summary>
+/// <param name="source">Audio source to free. May be NULL.</param>
+void audio_source_destroy(AudioSource* source);
+
+/// <summary>
+///     Creates an audio source which polls one or more microphone ADC channels. All channels
+///     are read on every capture wakeup and delivered as one interleaved channel each.
+/// </summary>
+/// <param name="channelList">
+///		Comma separated channel numbers on MICROPHONE_CONTROLLER, at most MAX_AUDIO_CHANNELS,
+///		or NULL for the single MICROPHONE channel.
+///	</param>
+AudioSource* adc_audio_source_create(const char* channelList);
+
+/// <summary>
+///     Creates an audio source which reads a 16-bit PCM WAV file. Each channel of the file
+///     is treated as a separate microphone.
+/// </summary>
+/// <param name="path">Path of the file.</param>
+AudioSource* wav_audio_source_create(const char* path);
+
+/// <summary>
+///     Creates an audio source which reads raw 16-bit little endian PCM at AUDIO_CAPTURE_RATE
+///     from a file, pipe or FIFO.
+/// </summary>
+/// <param name="path">Path of the file, pipe or FIFO.</param>
+AudioSource* pcm_audio_source_create(const char* path);
+
+typedef enum SynthWaveform {
+	SynthWaveform_Tone,
+	SynthWaveform_Noise,
+	SynthWaveform_Impulse,
+} SynthWaveform;
+
+/// <summary>
+///     Creates an audio source which generates a test signal.
+/// </summary>
+/// <param name="waveform">Type of signal to generate.</param>
+/// <param name="parameter">
+///		Tone frequency in Hz for SynthWaveform_Tone, impulse period in milliseconds for
+///		SynthWaveform_Impulse, unused for SynthWaveform_Noise.
+///	</param>
+AudioSource* synth_audio_source_create(SynthWaveform waveform, float parameter);
+
+/// <summary>
+///     Opens a file for reading. Relative paths are opened from the image package.
+/// </summary>
+/// <param name="path">Path of the file.</param>
+/// <returns>A file descriptor, or -1 on failure.</returns>
+int audio_source_open_file(const char* path);
@@ -73,6 +73,13 @@ void update_device_twin_bool(const char* propertyName, bool propertyValue);
 /// <param name="propertyValue">the IoT Hub Device Twin property value</param>
 void update_device_twin_int(const char* propertyName, int propertyValue);
 
+/// <summary>
+///     Sends an update to the device twin.
+/// </summary>
+/// <param name="propertyName">the IoT Hub Device Twin property name</param>
+/// <param name="propertyValue">the IoT Hub Device Twin property value, without JSON escapes</param>
+void update_device_twin_string(const char* propertyName, const char* propertyValue);
+
 /// <summary>
 ///		Allows querying for the current authentication status.
 /// </summary>
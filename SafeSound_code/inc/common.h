@@ -1,53 +1,341 @@
 #pragma once
 
+#include <stdalign.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <signal.h>
+#include <time.h>
 
-#define AUDIO_FRAME_SIZE 512
+// Sample rate profile. 16000 classifies 16 kHz audio in 512-sample frames. 8000 classifies
+// 8 kHz audio in 256-sample frames, the same 32 ms, which roughly halves the work after
+// capture; it needs a featurizer and classifier built for 256-sample input. Audio is always
+// captured at AUDIO_CAPTURE_RATE and brought down to AUDIO_SAMPLE_RATE by a decimating
+// anti-alias filter. May also be set on the compiler command line, as the host build does to
+// benchmark both profiles.
+#ifndef AUDIO_RATE_PROFILE
+#define AUDIO_RATE_PROFILE 16000
+#endif
+#define AUDIO_CAPTURE_RATE 16000  // samples/sec delivered by the audio sources
+#if AUDIO_RATE_PROFILE == 8000
+#define AUDIO_SAMPLE_RATE 8000  // samples/sec
+#define AUDIO_FRAME_SIZE 256
+#elif AUDIO_RATE_PROFILE == 16000
 #define AUDIO_SAMPLE_RATE 16000  // samples/sec
+#define AUDIO_FRAME_SIZE 512
+#else
+#error AUDIO_RATE_PROFILE must be 8000 or 16000
+#endif
+#define AUDIO_DECIMATION (AUDIO_CAPTURE_RATE / AUDIO_SAMPLE_RATE)  // captured samples per sample
+#define AUDIO_CAPTURE_FRAME_SIZE (AUDIO_FRAME_SIZE * AUDIO_DECIMATION)  // captured samples per frame
+// Samples between the starts of consecutive frames. Below AUDIO_FRAME_SIZE the frames overlap,
+// so a transient that straddles one frame boundary lies whole in the next frame. Every hop is
+// classified, so the classification load grows by AUDIO_FRAME_SIZE / AUDIO_HOP_SIZE.
+// Must be a power of two no larger than AUDIO_FRAME_SIZE, e.g. 512, 256 or 128. May also be set
+// on the compiler command line, as the host build does to test the ring at each hop size.
+#ifndef AUDIO_HOP_SIZE
+#define AUDIO_HOP_SIZE AUDIO_FRAME_SIZE
+#endif
+#define AUDIO_FRAME_HOPS (AUDIO_FRAME_SIZE / AUDIO_HOP_SIZE)  // hops in one frame
+// Number of samples collected at AUDIO_CAPTURE_RATE on each capture wakeup, 16 wakes the capture
+// thread once per millisecond. Sources which take each reading when they are polled, like the
+// ADC, limit it with their max_block and are read once per sample period; their readings are
+// still timestamped, filtered and stored in blocks of this size.
+#define AUDIO_CAPTURE_BLOCK_SIZE 16
+// Samples lost to late capture wakeups are replaced by interpolating between the samples on
+// either side of the gap (1), or by repeating the last captured sample (0).
+#define AUDIO_GAP_FILL_INTERPOLATE 1
+// Resample captured audio from its measured rate to exactly AUDIO_SAMPLE_RATE (1), or store
+// samples as captured (0). Only live sources which buffer their samples on their own clock are
+// resampled; the ADC is sampled on the capture timer and is always stored as captured.
+#define AUDIO_DRIFT_CORRECTION 1
+// Skip the featurizer and classifier on frames the ActivityDetector finds quiet (1), or
+// classify every frame (0).
+#define AUDIO_ACTIVITY_GATE 1
+// Featurize frames with the portable log-mel featurizer in log_mel.c (1), or with the prebuilt
+// ELL featurizer in lib/featurizer.o (0). Both are linked, and with AUDIO_FEATURIZER_SELF_TEST
+// check_predict_setup compares them on the prerecorded clip.
+#define AUDIO_NATIVE_FEATURIZER 1
+// Featurize 16-bit samples with the fixed-point path of the native featurizer (1), or convert
+// them to float first (0). With 1 and AUDIO_FEATURIZER_SELF_TEST, check_predict_setup compares
+// the two paths on the prerecorded clip.
+#define AUDIO_FIXED_POINT_FEATURIZER 0
+#if AUDIO_FIXED_POINT_FEATURIZER && !AUDIO_NATIVE_FEATURIZER
+#error AUDIO_FIXED_POINT_FEATURIZER needs AUDIO_NATIVE_FEATURIZER
+#endif
+// Run the featurizer self-test in check_predict_setup at startup (1): featurize the prerecorded
+// clip and compare the featurizers named above with each other and with the precomputed
+// features. 0 leaves only the cheap size checks. The host build sets it to 1, so the host tests
+// run it; set it for a device build after changing a featurizer or the model.
+#ifndef AUDIO_FEATURIZER_SELF_TEST
+#define AUDIO_FEATURIZER_SELF_TEST 0
+#endif
+// Run the capture thread in real-time mode (1): SCHED_FIFO at AUDIO_CAPTURE_PRIORITY, pinned to
+// AUDIO_CAPTURE_CPU, with all current memory locked and its stack prefaulted. Each step that the
+// platform refuses is logged and skipped. 0 keeps the default scheduling.
+#define AUDIO_CAPTURE_REALTIME 0
+#define AUDIO_CAPTURE_PRIORITY 50  // SCHED_FIFO priority (1 - 99)
+#define AUDIO_CAPTURE_CPU 0
+#define AUDIO_CAPTURE_STACK_PREFAULT (16 * 1024)  // bytes of capture thread stack to touch up front
+// Number of buckets in the capture wake lateness histogram. Bucket 0 counts wakeups less than
+// 1 us late, bucket i counts [2^(i-1), 2^i) us and the last bucket also counts anything later.
+#define CAPTURE_LATENCY_BUCKETS 16
 
-#define MAX_BUFFERS 10
+// Frames each AudioBuffer queues for the main loop before its overload policy applies. Both
+// can be changed at run time with set_audio_buffer_depth and set_audio_buffer_policy.
+#define AUDIO_QUEUE_DEPTH 10
+// Samples each AudioBuffer needs for AUDIO_QUEUE_DEPTH frames plus the hop being written
+#define AUDIO_RING_MIN_SAMPLES (AUDIO_QUEUE_DEPTH * AUDIO_HOP_SIZE + AUDIO_FRAME_SIZE)
+// Samples held by each AudioBuffer: AUDIO_RING_MIN_SAMPLES rounded up to a power of two, so the
+// hop counts wrap consistently, and to at least 2048, a whole 4 KB page for the mirror mapping.
+// 8192 (16 KB per microphone) at 16 kHz with hops of 512, 4096 at 8 kHz or with hops of 256.
+#define AUDIO_RING_SAMPLES (AUDIO_RING_MIN_SAMPLES <= 2048 ? 2048 \
+	: AUDIO_RING_MIN_SAMPLES <= 4096 ? 4096 \
+	: AUDIO_RING_MIN_SAMPLES <= 8192 ? 8192 \
+	: AUDIO_RING_MIN_SAMPLES <= 16384 ? 16384 : 32768)
+#define AUDIO_RING_HOPS (AUDIO_RING_SAMPLES / AUDIO_HOP_SIZE)
+#define AUDIO_MAX_QUEUE_DEPTH (AUDIO_RING_HOPS - AUDIO_FRAME_HOPS + 1)  // frames the ring can hold
+// Map each AudioBuffer ring twice in a row (1), so a frame that wraps around the end of the
+// ring is still contiguous. With 0, or if the platform refuses the mapping, the start of the
+// ring is copied past its end instead.
+#define AUDIO_RING_MIRROR 1
+#define AUDIO_OVERLOAD_POLICY AudioOverload_DropOldest
+// Most frames of one microphone the main loop classifies per wakeup. A wakeup drains the
+// backlog up to this budget, then yields to the other events before it continues, so a
+// backlog after a stall is worked off quickly without starving buttons and the IoT Hub.
+// 1 classifies one frame per wakeup.
+#define AUDIO_DRAIN_BUDGET 8
+// Cache line size of the Cortex-A7. The AudioBuffer indices sit on separate lines, so the
+// producer and consumer do not invalidate each other's line on every update.
+#define AUDIO_CACHE_LINE_SIZE 64
+// Most microphones recorded at once. Each one gets its own AudioBuffer.
+#define MAX_AUDIO_CHANNELS 4
 
 // signal which controls when the application ends
 extern volatile sig_atomic_t terminationRequired;
 
 /// <summary>
-/// Contains up to MAX_BUFFERS audio data chunks of AUDIO_FRAME_SIZE.
-/// Use read_audio_buffer and write_audio_buffer functions to manipulate these structs.
+/// Running totals kept by the capture thread for all channels together. The counters only ever increase,
+/// so readers should take the difference between two snapshots.
+/// </summary>
+typedef struct CaptureStats {
+	int block_size;  // samples per channel read on each wakeup
+	unsigned int wakeups;
+	unsigned int samples;
+	unsigned int lost_samples;  // capture sample periods missed by late wakeups, filled in or dropped
+	long long cpu_ns;  // CPU time used by the capture thread
+	long long resample_ns;  // time spent in the drift-correcting resampler
+	float input_rate;  // latest estimate of the captured sample rate in samples/sec
+	// timed wakeups by how late they were for the first timer expiration they handled: the
+	// wakeup which completes each block, and every wakeup which missed an expiration
+	unsigned int wake_latency[CAPTURE_LATENCY_BUCKETS];
+	long long max_wake_latency_ns;  // latest wakeup since the thread started
+	bool realtime;  // true if the thread got real-time scheduling
+} CaptureStats;
+
+/// <summary>
+/// Describes where a frame of audio came from.
+/// </summary>
+typedef struct FrameInfo {
+	// Hops since capture started. Every hop gets a number, including hops that were dropped,
+	// so a jump in the sequence shows where audio was lost. A frame is numbered by its first hop.
+	unsigned long long sequence;
+	struct timespec capture_time;  // CLOCK_MONOTONIC time the first sample was captured
+	struct timespec capture_realtime;  // CLOCK_REALTIME time the first sample was captured
+	unsigned short gap_samples;  // number of filled-in samples in the frame
+} FrameInfo;
+
+/// <summary>
+/// What an AudioBuffer does when the main loop falls more than the queue depth behind.
+/// </summary>
+typedef enum AudioOverloadPolicy {
+	AudioOverload_DropOldest,  // skip the oldest queued frames, keeping the latest audio
+	AudioOverload_DropNewest,  // discard new audio until the main loop catches up
+	AudioOverload_Decimate,  // classify every other active frame until the queue drains
+	AudioOverload_Count
+} AudioOverloadPolicy;
+
+/// <summary>
+/// Lock-free single-producer, single-consumer ring of AUDIO_RING_SAMPLES 16-bit PCM samples.
+/// The producer appends AUDIO_HOP_SIZE samples at a time, filling a slot in place between
+/// acquire_write_slot and commit_write_slot. Each committed hop completes a frame of the last
+/// AUDIO_FRAME_SIZE samples, which the consumer reads in place between acquire_read_slot and
+/// release_read_slot. Exactly one thread may use each side.
+/// Only AudioOverload_DropNewest makes the producer stop at the queue depth, and with it or
+/// AudioOverload_Decimate the producer drops new hops once the ring is full. With
+/// AudioOverload_DropOldest the producer takes the oldest queued frame back from the consumer
+/// instead, unless the consumer is reading that frame right now.
+/// Any number of AudioReaders can observe the same frames in place besides the consumer.
+/// The producer does not wait for them.
 /// </summary>
 typedef struct AudioBuffer {
-	float buffers[MAX_BUFFERS][AUDIO_FRAME_SIZE];
-	short read_index;
-	short write_index;
-	short buffer_size;
-	int dataAvailableFd;
-	unsigned int dropped_frames;
+	// AUDIO_RING_SAMPLES samples followed by a mirror of the start of the ring, so that every
+	// frame is contiguous. The mirror is a second mapping of the same memory, or a copy.
+	short* samples;
+	bool mirrored;  // true if the mirror is a second mapping
+	FrameInfo info[AUDIO_RING_HOPS];  // origin of each hop
+	FrameInfo frame_info;  // origin of the frame returned by acquire_read_slot
+	int priming_hops;  // hops the producer still has to commit before the first frame is complete
+	// Hops committed and frames released since initialization. Frame n starts at hop n.
+	// write_count is only written by the producer, which publishes with release ordering.
+	// read_count is advanced by the consumer, and with AudioOverload_DropOldest also by the
+	// producer when it takes back a frame, so both compare-and-swap it. AUDIO_RING_HOPS is a
+	// power of two, so the counts stay consistent with the ring when they wrap.
+	alignas(AUDIO_CACHE_LINE_SIZE) atomic_uint write_count;
+	alignas(AUDIO_CACHE_LINE_SIZE) atomic_uint read_count;
+	atomic_uint held;  // frame the consumer is reading while holding is set
+	atomic_bool holding;
+	alignas(AUDIO_CACHE_LINE_SIZE) int dataAvailableFd;
+	atomic_uint depth;  // frames queued before the overload policy applies
+	atomic_int policy;  // AudioOverloadPolicy
+	// Written by the producer and cleared by the consumer, so both sides update them atomically.
+	atomic_uint dropped_frames;  // hops lost, each of which also loses a frame
+	atomic_uint gap_samples_total;  // filled-in samples since the counter was last cleared
+	// frames each policy dropped or decimated since the counters were last cleared
+	atomic_uint overload_frames[AudioOverload_Count];
 } AudioBuffer;
 
 /// <summary>
-///     Sets read_index to MAX_BUFFERS - 1, write_index to 0,
-///     buffer_size to AUDIO_FRAME_SIZE, dropped_frames to 0,
-///     and initializes dataAvailableFd.
+/// Cursor of a secondary consumer of an AudioBuffer, e.g. a clip recorder or level meter.
+/// It sees the same frames as the consumer without copies, but the producer only waits for the
+/// consumer. A reader at or ahead of the consumer reads frames the producer cannot touch; a
+/// reader that lags further behind may skip frames. Each reader belongs to one thread.
+/// Use the audio_reader_init, acquire_reader_slot and release_reader_slot functions to
+/// manipulate this struct.
+/// </summary>
+typedef struct AudioReader {
+	unsigned int read_count;  // frames this reader has moved past, see AudioBuffer
+	FrameInfo frame_info;  // origin of the frame returned by acquire_reader_slot
+	unsigned int skipped_frames;  // frames overwritten before this reader finished them
+} AudioReader;
+
+/// <summary>
+///     Allocates and empties the ring, sets dropped_frames, gap and overload counters to 0,
+///     applies AUDIO_QUEUE_DEPTH and AUDIO_OVERLOAD_POLICY, and initializes dataAvailableFd.
 /// </summary>
 /// <param name="buf">AudioBuffer to initialize.</param>
 /// <returns>True if successful, false otherwise.</returns>
 bool initialize_audio_buffer(AudioBuffer* buf);
 
 /// <summary>
-///     Copies the data in srcData into the write buffer in buf.
+///     Releases the ring memory. Neither side may use the buffer afterwards. dataAvailableFd
+///     is left for the caller to close.
+/// </summary>
+/// <param name="buf">AudioBuffer to release.</param>
+void free_audio_buffer(AudioBuffer* buf);
+
+/// <summary>
+///     Sets the number of frames queued for the consumer before the overload policy applies.
+///     Safe to call from any thread while the buffer is in use.
 /// </summary>
 /// <param name="buf">AudioBuffer to use.</param>
-/// <param name="srcData">Data to copy into the write buffer.</param>
-/// <param name="srcSize">Length of srcData.</param>
-/// <returns>True if successful, false otherwise.</returns>
-bool write_audio_buffer(AudioBuffer* buf, float* srcData, unsigned short srcSize);
+/// <param name="depth">Queue depth in frames, 1 to AUDIO_MAX_QUEUE_DEPTH.</param>
+/// <returns>True if successful, false if depth is out of range.</returns>
+bool set_audio_buffer_depth(AudioBuffer* buf, unsigned int depth);
+
+/// <summary>
+///     Selects what happens when the consumer falls more than the queue depth behind.
+///     Safe to call from any thread while the buffer is in use.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <param name="policy">Overload policy.</param>
+void set_audio_buffer_policy(AudioBuffer* buf, AudioOverloadPolicy policy);
+
+/// <summary>
+///     Producer side: returns the next free hop to fill in place. Calling it again before
+///     commit_write_slot returns the same hop.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <param name="info">Receives the FrameInfo of the hop, to be filled in with the samples.</param>
+/// <returns>
+///		AUDIO_HOP_SIZE samples to fill, or NULL if the ring is full or the overload policy drops
+///		the hop.
+///	</returns>
+short* acquire_write_slot(AudioBuffer* buf, FrameInfo** info);
+
+/// <summary>
+///     Producer side: publishes the hop returned by acquire_write_slot, and with it the frame
+///     that ends with the hop once AUDIO_FRAME_HOPS hops have been committed.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <returns>True if a frame was completed, false while the first frame is still filling.</returns>
+bool commit_write_slot(AudioBuffer* buf);
 
 /// <summary>
-///     Increments read_index and copies the next data frame into destBuf.
+///     Producer side: counts a hop that was discarded because acquire_write_slot found no room.
 /// </summary>
 /// <param name="buf">AudioBuffer to use.</param>
-///	<param name="destBuf">Plain float array to write the next frame into.</param>
-/// <param name="destSize">Size of destBuf in bytes.</param>
-/// <returns>Pointer to read buffer.</returns>
-bool read_audio_buffer(AudioBuffer* buf, float* destBuf, unsigned short destSize);
+void drop_write_slot(AudioBuffer* buf);
+
+/// <summary>
+///     Consumer side: returns the oldest unreleased frame without copying it. The frame stays
+///     valid until release_read_slot. With AudioOverload_DropOldest, the oldest frames beyond
+///     the queue depth are skipped first, and frames the producer took back while the ring was
+///     full are gone.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <param name="info">
+///		Optional. Receives the origin of the frame: the sequence number and capture times of its
+///		first hop and the filled-in samples of all its hops.
+///	</param>
+/// <returns>AUDIO_FRAME_SIZE samples, or NULL if there is no new frame.</returns>
+const short* acquire_read_slot(AudioBuffer* buf, const FrameInfo** info);
+
+/// <summary>
+///     Consumer side: releases the frame returned by acquire_read_slot. Its first hop goes back
+///     to the producer, the others stay in the following frames.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+void release_read_slot(AudioBuffer* buf);
+
+/// <summary>
+///     Starts a reader at the oldest frame the consumer has not released. Call it from the
+///     reader's thread.
+/// </summary>
+/// <param name="buf">AudioBuffer to observe.</param>
+/// <param name="reader">AudioReader to initialize.</param>
+void audio_reader_init(AudioBuffer* buf, AudioReader* reader);
+
+/// <summary>
+///     Reader side: returns the next frame for the reader without copying it. A reader that
+///     the producer has lapped skips ahead to the newest frame and counts the frames it missed.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <param name="reader">AudioReader to advance.</param>
+/// <param name="info">Optional. Receives the origin of the frame, as for acquire_read_slot.</param>
+/// <returns>AUDIO_FRAME_SIZE samples, or NULL if there is no new frame for the reader.</returns>
+const short* acquire_reader_slot(AudioBuffer* buf, AudioReader* reader, const FrameInfo** info);
+
+/// <summary>
+///     Reader side: moves past the frame returned by acquire_reader_slot and checks that the
+///     producer did not overwrite it while it was being read.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <param name="reader">AudioReader to advance.</param>
+/// <returns>
+///		True if the frame was intact, false if whatever was read from it must be discarded,
+///		which is counted in skipped_frames.
+///	</returns>
+bool release_reader_slot(AudioBuffer* buf, AudioReader* reader);
+
+/// <summary>
+///     Consumer side: returns the number of complete frames waiting to be read, including
+///     any beyond the queue depth.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <returns>Queued frames.</returns>
+unsigned int audio_buffer_queued_frames(AudioBuffer* buf);
+
+/// <summary>
+///     Consumer side: whether more frames than the queue depth are waiting, counting the one
+///     returned by acquire_read_slot.
+/// </summary>
+/// <param name="buf">AudioBuffer to use.</param>
+/// <returns>True if the consumer is falling behind.</returns>
+bool audio_buffer_overloaded(AudioBuffer* buf);
+
+/// <summary>
+///     Fraction of a frame (0 - 1) that was actually captured rather than filled in.
+/// </summary>
+/// <param name="info">Origin of the frame.</param>
+float frame_integrity(const FrameInfo* info);
 
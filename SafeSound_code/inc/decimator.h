@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Length of the half-band anti-alias filter, 4k+3 so that its outermost taps are not zero.
+// Every other tap except the center one is zero, so each output takes (DECIMATOR_TAPS + 1) / 4
+// multiplies.
+#define DECIMATOR_TAPS 31
+
+/// <summary>
+/// Streaming decimator which halves the sample rate of 16-bit PCM audio. A half-band low-pass
+/// filter removes everything above half the output rate before every other sample is dropped.
+/// Use the decimator_* functions to manipulate this struct.
+/// </summary>
+typedef struct Decimator {
+	short delay[2 * DECIMATOR_TAPS];  // latest input, stored twice so every window is contiguous
+	int position;  // index in delay of the oldest sample of the window
+	bool output_due;  // the next input sample completes an output sample
+} Decimator;
+
+/// <summary>
+///     Precomputes the filter taps (once) and fills the filter with silence.
+/// </summary>
+/// <param name="decimator">Decimator to initialize.</param>
+void decimator_init(Decimator* decimator);
+
+/// <summary>
+///     Filters and decimates a block of samples. Consecutive blocks are treated as one stream,
+///     so a block may have an odd number of samples.
+/// </summary>
+/// <param name="decimator">Decimator to use.</param>
+/// <param name="input">Input samples (16-bit PCM).</param>
+/// <param name="inputCount">Number of input samples.</param>
+/// <param name="output">Receives up to (inputCount + 1) / 2 samples (16-bit PCM). May be input.</param>
+/// <returns>Number of samples written to output.</returns>
+int decimator_process(Decimator* decimator, const short* input, int inputCount, short* output);
@@ -81,6 +81,16 @@ int SetTimerFdToSingleExpiry(int timerFd, const struct timespec *expiry);
 /// <returns>0 on success, or -1 on failure</returns>
 int ConsumeTimerFdEvent(int timerFd);
 
+/// <summary>
+///     Consumes an event by reading from the timer file descriptor, and reports how many
+///     times the timer expired since it was last read.
+/// </summary>
+/// <param name="timerFd">Timer file descriptor</param>
+/// <param name="expirations">Receives the number of expirations; more than 1 means the
+/// reader fell behind the timer period.</param>
+/// <returns>0 on success, or -1 on failure</returns>
+int ConsumeTimerFdEventCount(int timerFd, uint64_t *expirations);
+
 /// <summary>
 ///     Creates a timerfd and adds it to an epoll instance.
 /// </summary>
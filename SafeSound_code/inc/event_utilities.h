@@ -2,6 +2,9 @@
 
 #include <stdbool.h>
 #include <stdio.h>
+#include <time.h>
+
+#include "level_meter.h"
 
 // Added to the beginning of the history message
 static const char HISTORY_FORMAT_BEGIN[] = "{\"eventHistory\":{";
@@ -10,11 +13,17 @@ static const char HISTORY_FORMAT_END[] = "}}";
 
 #define EVENT_HISTORY_SIZE 3  // number of events to keep
 // Size of buffer needed for the event string
-#define EVENT_STRING_SIZE 85
+#define EVENT_STRING_SIZE 100
 // Size of buffer needed for the event history string
 // Add 5 to each event row to account for key index (i.e. "0":) and comma at end of line
 #define EVENT_HISTORY_BYTE_SIZE (EVENT_STRING_SIZE + 5) * EVENT_HISTORY_SIZE \
 								+ sizeof(HISTORY_FORMAT_BEGIN) + sizeof(HISTORY_FORMAT_END)
+// Clip bytes carried by each clip chunk message, before base64 encoding
+#define CLIP_CHUNK_BYTES 3072
+// Size of buffer needed for a clip chunk message: the base64 data plus the other properties
+#define CLIP_MESSAGE_SIZE (4 * ((CLIP_CHUNK_BYTES + 2) / 3) + 256)
+// Size of buffer needed for a sound level message
+#define LEVEL_MESSAGE_SIZE 256
 
 ///	<summary>
 ///		Initializes the event history arrays.
@@ -33,10 +42,11 @@ void save_event(const char* event_string);
 
 /// <summary>
 ///		Creates a formatted string representing the event as a JSON object.
-///		The generated JSON object consists of three key-value properties:
+///		The generated JSON object consists of four key-value properties:
 ///			"eventType": specifies a string with the event category
 ///			"confidence": a value from 0 - 1 representing the prediction confidence
 ///			"eventTime": the time the event occurred represented using seconds since epoch
+///			"eventTimeMs": milliseconds to add to eventTime
 ///		The stringified JSON is then stored in buffer.
 ///	</summary>
 /// <param name="buffer">Array that the event string is stored in.</param>
@@ -46,9 +56,13 @@ void save_event(const char* event_string);
 ///	</param>
 /// <param name="event_type">String of event category.</param>
 ///	<param name="confidence">Confidence in event prediction (0 - 1).</param>
+///	<param name="event_time">
+///		CLOCK_REALTIME time the sound started, or NULL to use the current time.
+///	</param>
 /// <returns>True on success, false on failure.</returns>
 bool construct_event_message(
-	char* buffer, size_t buf_size, const char* event_type, float confidence
+	char* buffer, size_t buf_size, const char* event_type, float confidence,
+	const struct timespec* event_time
 );
 
 /// <summary>
@@ -64,4 +78,61 @@ bool construct_event_message(
 ///		This should be at least EVENT_HISTORY_BYTE_SIZE large.
 ///	</param>
 ///	<returns>True on success, false on failure.</returns>
-bool construct_history_message(char* buffer, size_t buf_size);
\ No newline at end of file
+bool construct_history_message(char* buffer, size_t buf_size);
+
+/// <summary>
+///		Creates a formatted string carrying one chunk of an event clip as a JSON object.
+///		The generated JSON object consists of these key-value properties:
+///			"clipId": number shared by all chunks of the clip
+///			"eventType", "eventTime", "eventTimeMs": the event, as in construct_event_message
+///			"microphone": microphone the clip was recorded from
+///			"chunk": index of this chunk, from 0
+///			"chunks": number of chunks in the clip
+///			"data": the chunk bytes in base64
+///		The chunks concatenated in order form a mono IMA ADPCM WAV file.
+///	</summary>
+/// <param name="buffer">Array that the message is stored in.</param>
+/// <param name="buf_size">
+///		Byte size of the buffer parameter.
+///		This should be at least CLIP_MESSAGE_SIZE large.
+///	</param>
+/// <param name="clip_id">Number of the clip.</param>
+/// <param name="event_type">String of event category.</param>
+///	<param name="event_time">CLOCK_REALTIME time the sound started.</param>
+///	<param name="microphone">Microphone the clip was recorded from.</param>
+///	<param name="chunk">Index of the chunk.</param>
+///	<param name="chunk_count">Number of chunks in the clip.</param>
+///	<param name="data">Chunk bytes.</param>
+///	<param name="size">Number of chunk bytes, at most CLIP_CHUNK_BYTES.</param>
+/// <returns>True on success, false on failure.</returns>
+bool construct_clip_chunk_message(
+	char* buffer, size_t buf_size, unsigned int clip_id, const char* event_type,
+	const struct timespec* event_time, int microphone, unsigned int chunk,
+	unsigned int chunk_count, const unsigned char* data, size_t size
+);
+
+/// <summary>
+///		Creates a formatted string summarizing the sound levels of one microphone over a
+///		report period as a JSON object.
+///		The generated JSON object consists of these key-value properties:
+///			"microphone": microphone the levels were measured on
+///			"periodEnd": the end of the period represented using seconds since epoch
+///			"periodSeconds": length of the period
+///			"minDb", "leqDb", "maxDb": quietest block, energy average and loudest block in dBFS
+///			"peakDb": largest sample in dBFS
+///			"p10Db", "p50Db", "p90Db": percentiles of the block levels in dBFS
+///	</summary>
+/// <param name="buffer">Array that the message is stored in.</param>
+/// <param name="buf_size">
+///		Byte size of the buffer parameter.
+///		This should be at least LEVEL_MESSAGE_SIZE large.
+///	</param>
+///	<param name="microphone">Microphone the levels were measured on.</param>
+///	<param name="period_end">CLOCK_REALTIME time the period ended.</param>
+///	<param name="period_seconds">Length of the period.</param>
+///	<param name="summary">Levels from level_meter_summarize.</param>
+/// <returns>True on success, false on failure.</returns>
+bool construct_level_message(
+	char* buffer, size_t buf_size, int microphone, const struct timespec* period_end,
+	int period_seconds, const LevelSummary* summary
+);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+
+#define LEVEL_REPORT_SECONDS 60  // period summarized by each level report
+#define LEVEL_FLOOR_DB -100  // levels below this are counted as this level
+#define LEVEL_BINS (-LEVEL_FLOOR_DB)  // 1 dB bins from LEVEL_FLOOR_DB up to 0 dBFS
+
+/// <summary>
+/// Sound levels of one microphone over a report period. All levels are in dBFS, where 0 is
+/// the RMS level of a full-scale square wave.
+/// </summary>
+typedef struct LevelSummary {
+	unsigned int blocks;  // blocks measured
+	float min_db;  // quietest block
+	float leq_db;  // energy average of the whole period
+	float max_db;  // loudest block
+	float peak_db;  // largest single sample
+	// Block levels which 10%, 50% and 90% of the blocks stayed below, to the nearest dB.
+	// p90_db - p10_db shows how steady the background is.
+	float p10_db;
+	float p50_db;
+	float p90_db;
+} LevelSummary;
+
+/// <summary>
+/// Streaming sound level meter. Measures the RMS level and peak of each block of samples and
+/// collects them into a summary of the report period.
+/// Use the level_meter_* functions to manipulate this struct.
+/// </summary>
+typedef struct LevelMeter {
+	unsigned long long energy;  // sum of the squared samples in the period
+	unsigned long long samples;  // samples in the period
+	int peak;  // largest absolute sample in the period
+	float min_db;
+	float max_db;
+	unsigned int blocks;  // blocks in the period
+	unsigned int histogram[LEVEL_BINS];  // blocks by level, bin i counts [LEVEL_FLOOR_DB + i, +1) dB
+} LevelMeter;
+
+/// <summary>
+///     Starts an empty report period.
+/// </summary>
+/// <param name="meter">LevelMeter to initialize.</param>
+void level_meter_init(LevelMeter* meter);
+
+/// <summary>
+///     Measures a block of samples and adds it to the current period.
+/// </summary>
+/// <param name="meter">LevelMeter to use.</param>
+/// <param name="samples">16-bit PCM samples.</param>
+/// <param name="count">Number of samples.</param>
+/// <returns>RMS level of the block in dBFS.</returns>
+float level_meter_process(LevelMeter* meter, const short* samples, int count);
+
+/// <summary>
+///     Summarizes the current period and starts the next one.
+/// </summary>
+/// <param name="meter">LevelMeter to use.</param>
+/// <param name="summary">Receives the levels of the period.</param>
+/// <returns>True if the period had audio, false if summary was not filled in.</returns>
+bool level_meter_summarize(LevelMeter* meter, LevelSummary* summary);
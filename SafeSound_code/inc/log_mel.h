@@ -0,0 +1,35 @@
+#pragma once
+
+#include "common.h"
+
+// Parameters of the log-mel featurizer, which must match the ones the classifier was trained
+// with. The tables in log_mel_tables.h are generated for them by
+// tools/generate_log_mel_tables.py, for any power-of-two FFT size and number of filters.
+#define LOG_MEL_FFT_SIZE AUDIO_FRAME_SIZE  // samples per frame, a power of two
+#define LOG_MEL_BINS (LOG_MEL_FFT_SIZE / 2 + 1)  // spectrum bins from 0 Hz up to half the sample rate
+#define LOG_MEL_FILTERS 80  // triangular mel filters from 0 Hz up to half the sample rate
+#define LOG_MEL_OFFSET 1.0f  // added to each filter output before the log
+// Largest difference from the prebuilt ELL featurizer that check_predict_setup accepts
+#define LOG_MEL_TOLERANCE 1e-3f
+// Largest difference of log_mel_filter_pcm from log_mel_filter. The tables and the rounding of
+// the fixed-point path add up to a few 1e-5, and 5e-5 was measured from silence to full scale.
+#define LOG_MEL_FIXED_TOLERANCE 1e-4f
+
+/// <summary>
+///     Computes the log-mel features of one frame, the same features as mfcc_Filter of the
+///     prebuilt ELL featurizer: the magnitude spectrum of the unwindowed frame goes through
+///     LOG_MEL_FILTERS triangular filters spaced evenly on the mel scale, and each output is
+///     log(LOG_MEL_OFFSET + filter output).
+/// </summary>
+/// <param name="input">LOG_MEL_FFT_SIZE samples.</param>
+/// <param name="output">Receives LOG_MEL_FILTERS features.</param>
+void log_mel_filter(const float* input, float* output);
+
+/// <summary>
+///     Fixed-point version of log_mel_filter which starts from 16-bit PCM. The FFT runs in Q15
+///     with block floating point, the filters accumulate in integers and the log comes from a
+///     table. The features are within LOG_MEL_FIXED_TOLERANCE of those of log_mel_filter.
+/// </summary>
+/// <param name="input">LOG_MEL_FFT_SIZE samples of 16-bit PCM audio.</param>
+/// <param name="output">Receives LOG_MEL_FILTERS features.</param>
+void log_mel_filter_pcm(const short* input, float* output);
@@ -0,0 +1,706 @@
+// Generated by tools/generate_log_mel_tables.py, do not edit.
+#pragma once
+
+#include <stdint.h>
+
+#include "log_mel.h"
+
+// Non-zero weights of one triangular mel filter, which covers bins first_bin to
+// first_bin + length - 1
+typedef struct MelFilter {
+	unsigned short first_bin;
+	unsigned short length;
+	unsigned short offset;  // index of the weight of first_bin in filterWeights
+} MelFilter;
+
+// sqrt(64 + i) for i <= 192 in Q27, the roots of the top bits of normalized squares
+static const uint32_t sqrtTable[193] = {
+	1073741824, 1082097918, 1090389977, 1098619452, 1106787739, 1114896182, 1122946079, 1130938678,
+	1138875187, 1146756771, 1154584553, 1162359621, 1170083026, 1177755783, 1185378878, 1192953261,
+	1200479854, 1207959552, 1215393219, 1222781696, 1230125796, 1237426310, 1244684005, 1251899625,
+	1259073893, 1266207514, 1273301169, 1280355523, 1287371222, 1294348895, 1301289153, 1308192592,
+	1315059792, 1321891318, 1328687719, 1335449532, 1342177280, 1348871473, 1355532607, 1362161168,
+	1368757628, 1375322451, 1381856086, 1388358974, 1394831545, 1401274219, 1407687407, 1414071510,
+	1420426919, 1426754019, 1433053185, 1439324782, 1445569171, 1451786701, 1457977717, 1464142555,
+	1470281545, 1476395008, 1482483261, 1488546612, 1494585366, 1500599818, 1506590260, 1512556978,
+	1518500250, 1524420351, 1530317551, 1536192112, 1542044294, 1547874349, 1553682529, 1559469076,
+	1565234231, 1570978229, 1576701302, 1582403676, 1588085574, 1593747216, 1599388817, 1605010588,
+	1610612736, 1616195466, 1621758978, 1627303469, 1632829134, 1638336161, 1643824740, 1649295054,
+	1654747284, 1660181608, 1665598202, 1670997238, 1676378885, 1681743312, 1687090681, 1692421154,
+	1697734891, 1703032049, 1708312781, 1713577240, 1718825574, 1724057932, 1729274458, 1734475296,
+	1739660585, 1744830464, 1749985070, 1755124538, 1760249000, 1765358587, 1770453428, 1775533649,
+	1780599376, 1785650732, 1790687838, 1795710816, 1800719782, 1805714853, 1810696145, 1815663770,
+	1820617842, 1825558469, 1830485761, 1835399826, 1840300769, 1845188694, 1850063706, 1854925906,
+	1859775393, 1864612269, 1869436629, 1874248572, 1879048192, 1883835584, 1888610840, 1893374053,
+	1898125312, 1902864709, 1907592330, 1912308264, 1917012597, 1921705413, 1926386797, 1931056833,
+	1935715602, 1940363185, 1944999662, 1949625114, 1954239618, 1958843251, 1963436090, 1968018211,
+	1972589688, 1977150595, 1981701005, 1986240991, 1990770623, 1995289972, 1999799107, 2004298098,
+	2008787014, 2013265920, 2017734884, 2022193972, 2026643249, 2031082780, 2035512628, 2039932856,
+	2044343526, 2048744702, 2053136442, 2057518809, 2061891861, 2066255659, 2070610259, 2074955721,
+	2079292101, 2083619457, 2087937844, 2092247318, 2096547933, 2100839745, 2105122807, 2109397173,
+	2113662894, 2117920024, 2122168614, 2126408716, 2130640379, 2134863654, 2139078592, 2143285240,
+	2147483648,
+};
+
+// log2(1 + i / 256) for i <= 256 in Q16
+static const int32_t log2Table[257] = {
+	0, 369, 736, 1102, 1466, 1829, 2190, 2551,
+	2909, 3267, 3623, 3978, 4331, 4683, 5034, 5384,
+	5732, 6079, 6425, 6769, 7112, 7454, 7795, 8134,
+	8473, 8810, 9146, 9480, 9814, 10146, 10477, 10807,
+	11136, 11464, 11791, 12116, 12440, 12764, 13086, 13407,
+	13727, 14046, 14363, 14680, 14996, 15310, 15624, 15937,
+	16248, 16559, 16868, 17177, 17484, 17791, 18096, 18401,
+	18704, 19007, 19308, 19609, 19909, 20207, 20505, 20802,
+	21098, 21393, 21687, 21980, 22272, 22564, 22854, 23144,
+	23433, 23720, 24007, 24293, 24579, 24863, 25146, 25429,
+	25711, 25992, 26272, 26551, 26830, 27108, 27384, 27660,
+	27936, 28210, 28484, 28757, 29029, 29300, 29571, 29840,
+	30109, 30378, 30645, 30912, 31178, 31443, 31707, 31971,
+	32234, 32496, 32758, 33019, 33279, 33538, 33797, 34055,
+	34312, 34569, 34825, 35080, 35334, 35588, 35841, 36094,
+	36346, 36597, 36847, 37097, 37346, 37595, 37842, 38090,
+	38336, 38582, 38827, 39072, 39316, 39559, 39802, 40044,
+	40286, 40527, 40767, 41006, 41246, 41484, 41722, 41959,
+	42196, 42432, 42667, 42902, 43137, 43370, 43603, 43836,
+	44068, 44300, 44530, 44761, 44990, 45220, 45448, 45676,
+	45904, 46131, 46357, 46583, 46809, 47034, 47258, 47482,
+	47705, 47928, 48150, 48372, 48593, 48813, 49034, 49253,
+	49472, 49691, 49909, 50127, 50344, 50560, 50776, 50992,
+	51207, 51422, 51636, 51850, 52063, 52276, 52488, 52700,
+	52911, 53122, 53332, 53542, 53751, 53960, 54169, 54377,
+	54584, 54791, 54998, 55204, 55410, 55615, 55820, 56025,
+	56229, 56432, 56635, 56838, 57040, 57242, 57443, 57644,
+	57845, 58045, 58245, 58444, 58643, 58841, 59039, 59237,
+	59434, 59631, 59827, 60023, 60219, 60414, 60609, 60803,
+	60997, 61190, 61384, 61576, 61769, 61961, 62152, 62343,
+	62534, 62725, 62915, 63104, 63294, 63483, 63671, 63859,
+	64047, 64234, 64421, 64608, 64794, 64980, 65166, 65351,
+	65536,
+};
+
+#if AUDIO_SAMPLE_RATE == 16000 && LOG_MEL_FFT_SIZE == 512 && LOG_MEL_FILTERS == 80
+
+// Twiddles of all stages of the half-size FFT, e^(-2 pi i k / (2 * span)) for k < span at
+// index span - 1 + k, so each stage reads its twiddles in order
+static const float twiddleRe[255] = {
+	1.0f, 1.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 6.12323426e-17f, -0.707106769f, 1.0f,
+	0.923879504f, 0.707106769f, 0.382683426f, 6.12323426e-17f, -0.382683426f, -0.707106769f, -0.923879504f, 1.0f,
+	0.980785251f, 0.923879504f, 0.831469595f, 0.707106769f, 0.555570245f, 0.382683426f, 0.195090324f, 6.12323426e-17f,
+	-0.195090324f, -0.382683426f, -0.555570245f, -0.707106769f, -0.831469595f, -0.923879504f, -0.980785251f, 1.0f,
+	0.99518472f, 0.980785251f, 0.956940353f, 0.923879504f, 0.881921291f, 0.831469595f, 0.773010433f, 0.707106769f,
+	0.634393275f, 0.555570245f, 0.471396744f, 0.382683426f, 0.290284663f, 0.195090324f, 0.0980171412f, 6.12323426e-17f,
+	-0.0980171412f, -0.195090324f, -0.290284663f, -0.382683426f, -0.471396744f, -0.555570245f, -0.634393275f, -0.707106769f,
+	-0.773010433f, -0.831469595f, -0.881921291f, -0.923879504f, -0.956940353f, -0.980785251f, -0.99518472f, 1.0f,
+	0.99879545f, 0.99518472f, 0.989176512f, 0.980785251f, 0.970031261f, 0.956940353f, 0.941544056f, 0.923879504f,
+	0.903989315f, 0.881921291f, 0.857728601f, 0.831469595f, 0.803207517f, 0.773010433f, 0.740951121f, 0.707106769f,
+	0.671558976f, 0.634393275f, 0.59569931f, 0.555570245f, 0.514102757f, 0.471396744f, 0.427555084f, 0.382683426f,
+	0.336889863f, 0.290284663f, 0.242980182f, 0.195090324f, 0.146730468f, 0.0980171412f, 0.0490676761f, 6.12323426e-17f,
+	-0.0490676761f, -0.0980171412f, -0.146730468f, -0.195090324f, -0.242980182f, -0.290284663f, -0.336889863f, -0.382683426f,
+	-0.427555084f, -0.471396744f, -0.514102757f, -0.555570245f, -0.59569931f, -0.634393275f, -0.671558976f, -0.707106769f,
+	-0.740951121f, -0.773010433f, -0.803207517f, -0.831469595f, -0.857728601f, -0.881921291f, -0.903989315f, -0.923879504f,
+	-0.941544056f, -0.956940353f, -0.970031261f, -0.980785251f, -0.989176512f, -0.99518472f, -0.99879545f, 1.0f,
+	0.999698818f, 0.99879545f, 0.997290432f, 0.99518472f, 0.992479563f, 0.989176512f, 0.985277653f, 0.980785251f,
+	0.975702107f, 0.970031261f, 0.963776052f, 0.956940353f, 0.949528158f, 0.941544056f, 0.932992816f, 0.923879504f,
+	0.914209783f, 0.903989315f, 0.893224299f, 0.881921291f, 0.870086968f, 0.857728601f, 0.84485358f, 0.831469595f,
+	0.817584813f, 0.803207517f, 0.78834641f, 0.773010433f, 0.757208824f, 0.740951121f, 0.724247098f, 0.707106769f,
+	0.689540565f, 0.671558976f, 0.653172851f, 0.634393275f, 0.615231574f, 0.59569931f, 0.575808167f, 0.555570245f,
+	0.534997642f, 0.514102757f, 0.492898196f, 0.471396744f, 0.449611336f, 0.427555084f, 0.405241311f, 0.382683426f,
+	0.359895051f, 0.336889863f, 0.313681751f, 0.290284663f, 0.266712755f, 0.242980182f, 0.219101235f, 0.195090324f,
+	0.170961887f, 0.146730468f, 0.122410677f, 0.0980171412f, 0.0735645667f, 0.0490676761f, 0.024541229f, 6.12323426e-17f,
+	-0.024541229f, -0.0490676761f, -0.0735645667f, -0.0980171412f, -0.122410677f, -0.146730468f, -0.170961887f, -0.195090324f,
+	-0.219101235f, -0.242980182f, -0.266712755f, -0.290284663f, -0.313681751f, -0.336889863f, -0.359895051f, -0.382683426f,
+	-0.405241311f, -0.427555084f, -0.449611336f, -0.471396744f, -0.492898196f, -0.514102757f, -0.534997642f, -0.555570245f,
+	-0.575808167f, -0.59569931f, -0.615231574f, -0.634393275f, -0.653172851f, -0.671558976f, -0.689540565f, -0.707106769f,
+	-0.724247098f, -0.740951121f, -0.757208824f, -0.773010433f, -0.78834641f, -0.803207517f, -0.817584813f, -0.831469595f,
+	-0.84485358f, -0.857728601f, -0.870086968f, -0.881921291f, -0.893224299f, -0.903989315f, -0.914209783f, -0.923879504f,
+	-0.932992816f, -0.941544056f, -0.949528158f, -0.956940353f, -0.963776052f, -0.970031261f, -0.975702107f, -0.980785251f,
+	-0.985277653f, -0.989176512f, -0.992479563f, -0.99518472f, -0.997290432f, -0.99879545f, -0.999698818f,
+};
+
+// Imaginary parts of twiddleRe
+static const float twiddleIm[255] = {
+	-0.0f, -0.0f, -1.0f, -0.0f, -0.707106769f, -1.0f, -0.707106769f, -0.0f,
+	-0.382683426f, -0.707106769f, -0.923879504f, -1.0f, -0.923879504f, -0.707106769f, -0.382683426f, -0.0f,
+	-0.195090324f, -0.382683426f, -0.555570245f, -0.707106769f, -0.831469595f, -0.923879504f, -0.980785251f, -1.0f,
+	-0.980785251f, -0.923879504f, -0.831469595f, -0.707106769f, -0.555570245f, -0.382683426f, -0.195090324f, -0.0f,
+	-0.0980171412f, -0.195090324f, -0.290284663f, -0.382683426f, -0.471396744f, -0.555570245f, -0.634393275f, -0.707106769f,
+	-0.773010433f, -0.831469595f, -0.881921291f, -0.923879504f, -0.956940353f, -0.980785251f, -0.99518472f, -1.0f,
+	-0.99518472f, -0.980785251f, -0.956940353f, -0.923879504f, -0.881921291f, -0.831469595f, -0.773010433f, -0.707106769f,
+	-0.634393275f, -0.555570245f, -0.471396744f, -0.382683426f, -0.290284663f, -0.195090324f, -0.0980171412f, -0.0f,
+	-0.0490676761f, -0.0980171412f, -0.146730468f, -0.195090324f, -0.242980182f, -0.290284663f, -0.336889863f, -0.382683426f,
+	-0.427555084f, -0.471396744f, -0.514102757f, -0.555570245f, -0.59569931f, -0.634393275f, -0.671558976f, -0.707106769f,
+	-0.740951121f, -0.773010433f, -0.803207517f, -0.831469595f, -0.857728601f, -0.881921291f, -0.903989315f, -0.923879504f,
+	-0.941544056f, -0.956940353f, -0.970031261f, -0.980785251f, -0.989176512f, -0.99518472f, -0.99879545f, -1.0f,
+	-0.99879545f, -0.99518472f, -0.989176512f, -0.980785251f, -0.970031261f, -0.956940353f, -0.941544056f, -0.923879504f,
+	-0.903989315f, -0.881921291f, -0.857728601f, -0.831469595f, -0.803207517f, -0.773010433f, -0.740951121f, -0.707106769f,
+	-0.671558976f, -0.634393275f, -0.59569931f, -0.555570245f, -0.514102757f, -0.471396744f, -0.427555084f, -0.382683426f,
+	-0.336889863f, -0.290284663f, -0.242980182f, -0.195090324f, -0.146730468f, -0.0980171412f, -0.0490676761f, -0.0f,
+	-0.024541229f, -0.0490676761f, -0.0735645667f, -0.0980171412f, -0.122410677f, -0.146730468f, -0.170961887f, -0.195090324f,
+	-0.219101235f, -0.242980182f, -0.266712755f, -0.290284663f, -0.313681751f, -0.336889863f, -0.359895051f, -0.382683426f,
+	-0.405241311f, -0.427555084f, -0.449611336f, -0.471396744f, -0.492898196f, -0.514102757f, -0.534997642f, -0.555570245f,
+	-0.575808167f, -0.59569931f, -0.615231574f, -0.634393275f, -0.653172851f, -0.671558976f, -0.689540565f, -0.707106769f,
+	-0.724247098f, -0.740951121f, -0.757208824f, -0.773010433f, -0.78834641f, -0.803207517f, -0.817584813f, -0.831469595f,
+	-0.84485358f, -0.857728601f, -0.870086968f, -0.881921291f, -0.893224299f, -0.903989315f, -0.914209783f, -0.923879504f,
+	-0.932992816f, -0.941544056f, -0.949528158f, -0.956940353f, -0.963776052f, -0.970031261f, -0.975702107f, -0.980785251f,
+	-0.985277653f, -0.989176512f, -0.992479563f, -0.99518472f, -0.997290432f, -0.99879545f, -0.999698818f, -1.0f,
+	-0.999698818f, -0.99879545f, -0.997290432f, -0.99518472f, -0.992479563f, -0.989176512f, -0.985277653f, -0.980785251f,
+	-0.975702107f, -0.970031261f, -0.963776052f, -0.956940353f, -0.949528158f, -0.941544056f, -0.932992816f, -0.923879504f,
+	-0.914209783f, -0.903989315f, -0.893224299f, -0.881921291f, -0.870086968f, -0.857728601f, -0.84485358f, -0.831469595f,
+	-0.817584813f, -0.803207517f, -0.78834641f, -0.773010433f, -0.757208824f, -0.740951121f, -0.724247098f, -0.707106769f,
+	-0.689540565f, -0.671558976f, -0.653172851f, -0.634393275f, -0.615231574f, -0.59569931f, -0.575808167f, -0.555570245f,
+	-0.534997642f, -0.514102757f, -0.492898196f, -0.471396744f, -0.449611336f, -0.427555084f, -0.405241311f, -0.382683426f,
+	-0.359895051f, -0.336889863f, -0.313681751f, -0.290284663f, -0.266712755f, -0.242980182f, -0.219101235f, -0.195090324f,
+	-0.170961887f, -0.146730468f, -0.122410677f, -0.0980171412f, -0.0735645667f, -0.0490676761f, -0.024541229f,
+};
+
+// Bit-reversed index of each sample of the half-size FFT
+static const unsigned short bitReverse[256] = {
+	0, 128, 64, 192, 32, 160, 96, 224,
+	16, 144, 80, 208, 48, 176, 112, 240,
+	8, 136, 72, 200, 40, 168, 104, 232,
+	24, 152, 88, 216, 56, 184, 120, 248,
+	4, 132, 68, 196, 36, 164, 100, 228,
+	20, 148, 84, 212, 52, 180, 116, 244,
+	12, 140, 76, 204, 44, 172, 108, 236,
+	28, 156, 92, 220, 60, 188, 124, 252,
+	2, 130, 66, 194, 34, 162, 98, 226,
+	18, 146, 82, 210, 50, 178, 114, 242,
+	10, 138, 74, 202, 42, 170, 106, 234,
+	26, 154, 90, 218, 58, 186, 122, 250,
+	6, 134, 70, 198, 38, 166, 102, 230,
+	22, 150, 86, 214, 54, 182, 118, 246,
+	14, 142, 78, 206, 46, 174, 110, 238,
+	30, 158, 94, 222, 62, 190, 126, 254,
+	1, 129, 65, 193, 33, 161, 97, 225,
+	17, 145, 81, 209, 49, 177, 113, 241,
+	9, 137, 73, 201, 41, 169, 105, 233,
+	25, 153, 89, 217, 57, 185, 121, 249,
+	5, 133, 69, 197, 37, 165, 101, 229,
+	21, 149, 85, 213, 53, 181, 117, 245,
+	13, 141, 77, 205, 45, 173, 109, 237,
+	29, 157, 93, 221, 61, 189, 125, 253,
+	3, 131, 67, 195, 35, 163, 99, 227,
+	19, 147, 83, 211, 51, 179, 115, 243,
+	11, 139, 75, 203, 43, 171, 107, 235,
+	27, 155, 91, 219, 59, 187, 123, 251,
+	7, 135, 71, 199, 39, 167, 103, 231,
+	23, 151, 87, 215, 55, 183, 119, 247,
+	15, 143, 79, 207, 47, 175, 111, 239,
+	31, 159, 95, 223, 63, 191, 127, 255,
+};
+
+// Twiddles of the split, e^(-2 pi i k / LOG_MEL_FFT_SIZE) for k <= HALF_SIZE / 2
+static const float splitRe[129] = {
+	1.0f, 0.999924719f, 0.999698818f, 0.999322355f, 0.99879545f, 0.998118103f, 0.997290432f, 0.996312618f,
+	0.99518472f, 0.993906975f, 0.992479563f, 0.990902662f, 0.989176512f, 0.987301409f, 0.985277653f, 0.983105481f,
+	0.980785251f, 0.97831738f, 0.975702107f, 0.972939968f, 0.970031261f, 0.966976464f, 0.963776052f, 0.960430503f,
+	0.956940353f, 0.953306019f, 0.949528158f, 0.945607305f, 0.941544056f, 0.937339008f, 0.932992816f, 0.928506076f,
+	0.923879504f, 0.919113874f, 0.914209783f, 0.909168005f, 0.903989315f, 0.898674488f, 0.893224299f, 0.887639642f,
+	0.881921291f, 0.876070082f, 0.870086968f, 0.863972843f, 0.857728601f, 0.851355195f, 0.84485358f, 0.838224709f,
+	0.831469595f, 0.824589312f, 0.817584813f, 0.81045717f, 0.803207517f, 0.795836926f, 0.78834641f, 0.780737221f,
+	0.773010433f, 0.765167236f, 0.757208824f, 0.749136388f, 0.740951121f, 0.732654274f, 0.724247098f, 0.715730846f,
+	0.707106769f, 0.698376238f, 0.689540565f, 0.680601001f, 0.671558976f, 0.662415802f, 0.653172851f, 0.643831551f,
+	0.634393275f, 0.624859512f, 0.615231574f, 0.605511069f, 0.59569931f, 0.585797846f, 0.575808167f, 0.565731823f,
+	0.555570245f, 0.545324981f, 0.534997642f, 0.524589658f, 0.514102757f, 0.50353837f, 0.492898196f, 0.482183784f,
+	0.471396744f, 0.460538715f, 0.449611336f, 0.438616246f, 0.427555084f, 0.416429549f, 0.405241311f, 0.393992037f,
+	0.382683426f, 0.371317208f, 0.359895051f, 0.348418683f, 0.336889863f, 0.32531029f, 0.313681751f, 0.302005947f,
+	0.290284663f, 0.27851969f, 0.266712755f, 0.254865646f, 0.242980182f, 0.231058106f, 0.219101235f, 0.207111374f,
+	0.195090324f, 0.183039889f, 0.170961887f, 0.15885815f, 0.146730468f, 0.134580702f, 0.122410677f, 0.110222206f,
+	0.0980171412f, 0.0857973099f, 0.0735645667f, 0.061320737f, 0.0490676761f, 0.0368072242f, 0.024541229f, 0.0122715384f,
+	6.12323426e-17f,
+};
+
+// Imaginary parts of splitRe
+static const float splitIm[129] = {
+	-0.0f, -0.0122715384f, -0.024541229f, -0.0368072242f, -0.0490676761f, -0.061320737f, -0.0735645667f, -0.0857973099f,
+	-0.0980171412f, -0.110222206f, -0.122410677f, -0.134580702f, -0.146730468f, -0.15885815f, -0.170961887f, -0.183039889f,
+	-0.195090324f, -0.207111374f, -0.219101235f, -0.231058106f, -0.242980182f, -0.254865646f, -0.266712755f, -0.27851969f,
+	-0.290284663f, -0.302005947f, -0.313681751f, -0.32531029f, -0.336889863f, -0.348418683f, -0.359895051f, -0.371317208f,
+	-0.382683426f, -0.393992037f, -0.405241311f, -0.416429549f, -0.427555084f, -0.438616246f, -0.449611336f, -0.460538715f,
+	-0.471396744f, -0.482183784f, -0.492898196f, -0.50353837f, -0.514102757f, -0.524589658f, -0.534997642f, -0.545324981f,
+	-0.555570245f, -0.565731823f, -0.575808167f, -0.585797846f, -0.59569931f, -0.605511069f, -0.615231574f, -0.624859512f,
+	-0.634393275f, -0.643831551f, -0.653172851f, -0.662415802f, -0.671558976f, -0.680601001f, -0.689540565f, -0.698376238f,
+	-0.707106769f, -0.715730846f, -0.724247098f, -0.732654274f, -0.740951121f, -0.749136388f, -0.757208824f, -0.765167236f,
+	-0.773010433f, -0.780737221f, -0.78834641f, -0.795836926f, -0.803207517f, -0.81045717f, -0.817584813f, -0.824589312f,
+	-0.831469595f, -0.838224709f, -0.84485358f, -0.851355195f, -0.857728601f, -0.863972843f, -0.870086968f, -0.876070082f,
+	-0.881921291f, -0.887639642f, -0.893224299f, -0.898674488f, -0.903989315f, -0.909168005f, -0.914209783f, -0.919113874f,
+	-0.923879504f, -0.928506076f, -0.932992816f, -0.937339008f, -0.941544056f, -0.945607305f, -0.949528158f, -0.953306019f,
+	-0.956940353f, -0.960430503f, -0.963776052f, -0.966976464f, -0.970031261f, -0.972939968f, -0.975702107f, -0.97831738f,
+	-0.980785251f, -0.983105481f, -0.985277653f, -0.987301409f, -0.989176512f, -0.990902662f, -0.992479563f, -0.993906975f,
+	-0.99518472f, -0.996312618f, -0.997290432f, -0.998118103f, -0.99879545f, -0.999322355f, -0.999698818f, -0.999924719f,
+	-1.0f,
+};
+
+// Triangular mel filters
+static const MelFilter filters[80] = {
+	{ 0, 1, 0 }, { 1, 1, 1 }, { 2, 0, 2 }, { 2, 1, 2 }, { 3, 1, 3 }, { 4, 1, 4 }, { 5, 1, 5 }, { 6, 1, 6 },
+	{ 7, 1, 7 }, { 8, 1, 8 }, { 9, 1, 9 }, { 10, 1, 10 }, { 11, 1, 11 }, { 12, 1, 12 }, { 13, 1, 13 }, { 14, 1, 14 },
+	{ 15, 1, 15 }, { 16, 2, 16 }, { 17, 2, 18 }, { 19, 1, 20 }, { 20, 2, 21 }, { 21, 2, 23 }, { 23, 1, 25 }, { 24, 2, 26 },
+	{ 25, 2, 28 }, { 27, 2, 30 }, { 28, 3, 32 }, { 30, 2, 35 }, { 32, 2, 37 }, { 33, 3, 39 }, { 35, 3, 42 }, { 37, 3, 45 },
+	{ 39, 3, 48 }, { 41, 3, 51 }, { 43, 3, 54 }, { 45, 3, 57 }, { 47, 3, 60 }, { 49, 4, 63 }, { 51, 4, 67 }, { 54, 3, 71 },
+	{ 56, 4, 74 }, { 58, 5, 78 }, { 61, 4, 83 }, { 64, 4, 87 }, { 66, 5, 91 }, { 69, 5, 96 }, { 72, 5, 101 }, { 75, 5, 106 },
+	{ 78, 5, 111 }, { 81, 6, 116 }, { 84, 6, 122 }, { 88, 6, 128 }, { 91, 6, 134 }, { 95, 6, 140 }, { 98, 7, 146 }, { 102, 7, 153 },
+	{ 106, 7, 160 }, { 110, 8, 167 }, { 114, 8, 175 }, { 119, 8, 183 }, { 123, 9, 191 }, { 128, 8, 200 }, { 133, 8, 208 }, { 137, 10, 216 },
+	{ 142, 10, 226 }, { 148, 10, 236 }, { 153, 10, 246 }, { 159, 10, 256 }, { 164, 11, 266 }, { 170, 11, 277 }, { 176, 12, 288 }, { 182, 13, 300 },
+	{ 189, 12, 313 }, { 196, 13, 325 }, { 202, 14, 338 }, { 210, 13, 352 }, { 217, 14, 365 }, { 224, 15, 379 }, { 232, 15, 394 }, { 240, 16, 409 },
+};
+
+// Weights of all filters one after the other, fewer than two per bin
+static const float filterWeights[425] = {
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+	1.0f, 0.5f, 0.5f, 1.0f, 1.0f, 1.0f, 0.5f, 0.5f,
+	1.0f, 1.0f, 1.0f, 0.5f, 0.5f, 1.0f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 1.0f, 0.5f, 0.5f,
+	1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f,
+	0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f,
+	1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.5f, 0.5f,
+	1.0f, 0.5f, 0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f,
+	1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.5f, 0.5f,
+	1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f,
+	0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f,
+	0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f,
+	0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.75f,
+	0.5f, 0.25f, 0.25f, 0.5f, 0.75f, 1.0f, 0.666666687f, 0.333333343f,
+	0.333333343f, 0.666666687f, 1.0f, 0.75f, 0.5f, 0.25f, 0.25f, 0.5f,
+	0.75f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.75f,
+	0.5f, 0.25f, 0.25f, 0.5f, 0.75f, 1.0f, 0.75f, 0.5f,
+	0.25f, 0.25f, 0.5f, 0.75f, 1.0f, 0.75f, 0.5f, 0.25f,
+	0.25f, 0.5f, 0.75f, 1.0f, 0.75f, 0.5f, 0.25f, 0.25f,
+	0.5f, 0.75f, 1.0f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f, 0.200000003f,
+	0.400000006f, 0.600000024f, 0.800000012f, 1.0f, 0.75f, 0.5f, 0.25f, 0.25f,
+	0.5f, 0.75f, 1.0f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f, 0.200000003f,
+	0.400000006f, 0.600000024f, 0.800000012f, 1.0f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f,
+	0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f, 1.0f, 0.75f, 0.5f, 0.25f,
+	0.25f, 0.5f, 0.75f, 1.0f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f,
+	0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f, 1.0f, 0.833333313f, 0.666666687f, 0.5f,
+	0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f, 0.5f, 0.666666687f, 0.833333313f, 1.0f,
+	0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f, 0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f,
+	1.0f, 0.833333313f, 0.666666687f, 0.5f, 0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f,
+	0.5f, 0.666666687f, 0.833333313f, 1.0f, 0.800000012f, 0.600000024f, 0.400000006f, 0.200000003f,
+	0.200000003f, 0.400000006f, 0.600000024f, 0.800000012f, 1.0f, 0.833333313f, 0.666666687f, 0.5f,
+	0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f, 0.5f, 0.666666687f, 0.833333313f, 1.0f,
+	0.833333313f, 0.666666687f, 0.5f, 0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f, 0.5f,
+	0.666666687f, 0.833333313f, 1.0f, 0.833333313f, 0.666666687f, 0.5f, 0.333333343f, 0.166666672f,
+	0.166666672f, 0.333333343f, 0.5f, 0.666666687f, 0.833333313f, 1.0f, 0.857142866f, 0.714285731f,
+	0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f, 0.142857149f, 0.285714298f, 0.428571433f, 0.571428597f,
+	0.714285731f, 0.857142866f, 1.0f, 0.857142866f, 0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f,
+	0.142857149f, 0.142857149f, 0.285714298f, 0.428571433f, 0.571428597f, 0.714285731f, 0.857142866f, 1.0f,
+	0.833333313f, 0.666666687f, 0.5f, 0.333333343f, 0.166666672f, 0.166666672f, 0.333333343f, 0.5f,
+	0.666666687f, 0.833333313f, 1.0f, 0.875f, 0.75f, 0.625f, 0.5f, 0.375f,
+	0.25f, 0.125f, 0.125f, 0.25f, 0.375f, 0.5f, 0.625f, 0.75f,
+	0.875f, 1.0f, 0.857142866f, 0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f,
+	0.142857149f, 0.285714298f, 0.428571433f, 0.571428597f, 0.714285731f, 0.857142866f, 1.0f, 0.857142866f,
+	0.714285731f, 0.571428597f, 0.428571433f, 0.285714298f, 0.142857149f, 0.142857149f, 0.285714298f, 0.428571433f,
+	0.571428597f, 0.714285731f, 0.857142866f, 1.0f, 0.875f, 0.75f, 0.625f, 0.5f,
+	0.375f, 0.25f, 0.125f, 0.125f, 0.25f, 0.375f, 0.5f, 0.625f,
+	0.75f, 0.875f, 1.0f, 0.875f, 0.75f, 0.625f, 0.5f, 0.375f,
+	0.25f, 0.125f, 0.125f, 0.25f, 0.375f, 0.5f, 0.625f, 0.75f,
+	0.875f, 1.0f, 0.875f, 0.75f, 0.625f, 0.5f, 0.375f, 0.25f,
+	0.125f, 0.125f, 0.25f, 0.375f, 0.5f, 0.625f, 0.75f, 0.875f,
+	1.0f, 0.888888896f, 0.777777791f, 0.666666687f, 0.555555582f, 0.444444448f, 0.333333343f, 0.222222224f,
+	0.111111112f,
+};
+
+// Fixed-point copies of the tables for log_mel_filter_pcm. The twiddles are in Q30, which
+// holds 1 exactly, so the trivial twiddles do not leak into the other bins.
+static const int32_t twiddleReQ30[255] = {
+	1073741824, 1073741824, 0, 1073741824, 759250125, 0, -759250125, 1073741824,
+	992008094, 759250125, 410903207, 0, -410903207, -759250125, -992008094, 1073741824,
+	1053110176, 992008094, 892783698, 759250125, 596538995, 410903207, 209476638, 0,
+	-209476638, -410903207, -596538995, -759250125, -892783698, -992008094, -1053110176, 1073741824,
+	1068571464, 1053110176, 1027506862, 992008094, 946955747, 892783698, 830013654, 759250125,
+	681174602, 596538995, 506158392, 410903207, 311690799, 209476638, 105245103, 0,
+	-105245103, -209476638, -311690799, -410903207, -506158392, -596538995, -681174602, -759250125,
+	-830013654, -892783698, -946955747, -992008094, -1027506862, -1053110176, -1068571464, 1073741824,
+	1072448455, 1068571464, 1062120190, 1053110176, 1041563127, 1027506862, 1010975242, 992008094,
+	970651112, 946955747, 920979082, 892783698, 862437520, 830013654, 795590213, 759250125,
+	721080937, 681174602, 639627258, 596538995, 552013618, 506158392, 459083786, 410903207,
+	361732726, 311690799, 260897982, 209476638, 157550647, 105245103, 52686014, 0,
+	-52686014, -105245103, -157550647, -209476638, -260897982, -311690799, -361732726, -410903207,
+	-459083786, -506158392, -552013618, -596538995, -639627258, -681174602, -721080937, -759250125,
+	-795590213, -830013654, -862437520, -892783698, -920979082, -946955747, -970651112, -992008094,
+	-1010975242, -1027506862, -1041563127, -1053110176, -1062120190, -1068571464, -1072448455, 1073741824,
+	1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190, 1057933813, 1053110176,
+	1047652185, 1041563127, 1034846671, 1027506862, 1019548121, 1010975242, 1001793390, 992008094,
+	981625251, 970651112, 959092290, 946955747, 934248793, 920979082, 907154608, 892783698,
+	877875009, 862437520, 846480531, 830013654, 813046808, 795590213, 777654384, 759250125,
+	740388522, 721080937, 701339000, 681174602, 660599890, 639627258, 618269338, 596538995,
+	574449320, 552013618, 529245404, 506158392, 482766489, 459083786, 435124548, 410903207,
+	386434353, 361732726, 336813204, 311690799, 286380643, 260897982, 235258165, 209476638,
+	183568930, 157550647, 131437462, 105245103, 78989349, 52686014, 26350943, 0,
+	-26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930, -209476638,
+	-235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353, -410903207,
+	-435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320, -596538995,
+	-618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522, -759250125,
+	-777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009, -892783698,
+	-907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251, -992008094,
+	-1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185, -1053110176,
+	-1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433,
+};
+
+// Imaginary parts of twiddleReQ30
+static const int32_t twiddleImQ30[255] = {
+	0, 0, -1073741824, 0, -759250125, -1073741824, -759250125, 0,
+	-410903207, -759250125, -992008094, -1073741824, -992008094, -759250125, -410903207, 0,
+	-209476638, -410903207, -596538995, -759250125, -892783698, -992008094, -1053110176, -1073741824,
+	-1053110176, -992008094, -892783698, -759250125, -596538995, -410903207, -209476638, 0,
+	-105245103, -209476638, -311690799, -410903207, -506158392, -596538995, -681174602, -759250125,
+	-830013654, -892783698, -946955747, -992008094, -1027506862, -1053110176, -1068571464, -1073741824,
+	-1068571464, -1053110176, -1027506862, -992008094, -946955747, -892783698, -830013654, -759250125,
+	-681174602, -596538995, -506158392, -410903207, -311690799, -209476638, -105245103, 0,
+	-52686014, -105245103, -157550647, -209476638, -260897982, -311690799, -361732726, -410903207,
+	-459083786, -506158392, -552013618, -596538995, -639627258, -681174602, -721080937, -759250125,
+	-795590213, -830013654, -862437520, -892783698, -920979082, -946955747, -970651112, -992008094,
+	-1010975242, -1027506862, -1041563127, -1053110176, -1062120190, -1068571464, -1072448455, -1073741824,
+	-1072448455, -1068571464, -1062120190, -1053110176, -1041563127, -1027506862, -1010975242, -992008094,
+	-970651112, -946955747, -920979082, -892783698, -862437520, -830013654, -795590213, -759250125,
+	-721080937, -681174602, -639627258, -596538995, -552013618, -506158392, -459083786, -410903207,
+	-361732726, -311690799, -260897982, -209476638, -157550647, -105245103, -52686014, 0,
+	-26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930, -209476638,
+	-235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353, -410903207,
+	-435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320, -596538995,
+	-618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522, -759250125,
+	-777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009, -892783698,
+	-907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251, -992008094,
+	-1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185, -1053110176,
+	-1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433, -1073741824,
+	-1073418433, -1072448455, -1070832474, -1068571464, -1065666786, -1062120190, -1057933813, -1053110176,
+	-1047652185, -1041563127, -1034846671, -1027506862, -1019548121, -1010975242, -1001793390, -992008094,
+	-981625251, -970651112, -959092290, -946955747, -934248793, -920979082, -907154608, -892783698,
+	-877875009, -862437520, -846480531, -830013654, -813046808, -795590213, -777654384, -759250125,
+	-740388522, -721080937, -701339000, -681174602, -660599890, -639627258, -618269338, -596538995,
+	-574449320, -552013618, -529245404, -506158392, -482766489, -459083786, -435124548, -410903207,
+	-386434353, -361732726, -336813204, -311690799, -286380643, -260897982, -235258165, -209476638,
+	-183568930, -157550647, -131437462, -105245103, -78989349, -52686014, -26350943,
+};
+
+// splitRe in Q30
+static const int32_t splitReQ30[129] = {
+	1073741824, 1073660973, 1073418433, 1073014240, 1072448455, 1071721163, 1070832474, 1069782521,
+	1068571464, 1067199483, 1065666786, 1063973603, 1062120190, 1060106826, 1057933813, 1055601479,
+	1053110176, 1050460278, 1047652185, 1044686319, 1041563127, 1038283080, 1034846671, 1031254418,
+	1027506862, 1023604567, 1019548121, 1015338134, 1010975242, 1006460100, 1001793390, 996975812,
+	992008094, 986890984, 981625251, 976211688, 970651112, 964944360, 959092290, 953095785,
+	946955747, 940673101, 934248793, 927683790, 920979082, 914135678, 907154608, 900036924,
+	892783698, 885396022, 877875009, 870221790, 862437520, 854523370, 846480531, 838310216,
+	830013654, 821592095, 813046808, 804379079, 795590213, 786681534, 777654384, 768510122,
+	759250125, 749875788, 740388522, 730789757, 721080937, 711263525, 701339000, 691308855,
+	681174602, 670937767, 660599890, 650162530, 639627258, 628995660, 618269338, 607449906,
+	596538995, 585538248, 574449320, 563273883, 552013618, 540670223, 529245404, 517740883,
+	506158392, 494499676, 482766489, 470960600, 459083786, 447137835, 435124548, 423045732,
+	410903207, 398698801, 386434353, 374111709, 361732726, 349299266, 336813204, 324276419,
+	311690799, 299058239, 286380643, 273659918, 260897982, 248096755, 235258165, 222384147,
+	209476638, 196537583, 183568930, 170572633, 157550647, 144504935, 131437462, 118350194,
+	105245103, 92124163, 78989349, 65842639, 52686014, 39521455, 26350943, 13176464,
+	0,
+};
+
+// splitIm in Q30
+static const int32_t splitImQ30[129] = {
+	0, -13176464, -26350943, -39521455, -52686014, -65842639, -78989349, -92124163,
+	-105245103, -118350194, -131437462, -144504935, -157550647, -170572633, -183568930, -196537583,
+	-209476638, -222384147, -235258165, -248096755, -260897982, -273659918, -286380643, -299058239,
+	-311690799, -324276419, -336813204, -349299266, -361732726, -374111709, -386434353, -398698801,
+	-410903207, -423045732, -435124548, -447137835, -459083786, -470960600, -482766489, -494499676,
+	-506158392, -517740883, -529245404, -540670223, -552013618, -563273883, -574449320, -585538248,
+	-596538995, -607449906, -618269338, -628995660, -639627258, -650162530, -660599890, -670937767,
+	-681174602, -691308855, -701339000, -711263525, -721080937, -730789757, -740388522, -749875788,
+	-759250125, -768510122, -777654384, -786681534, -795590213, -804379079, -813046808, -821592095,
+	-830013654, -838310216, -846480531, -854523370, -862437520, -870221790, -877875009, -885396022,
+	-892783698, -900036924, -907154608, -914135678, -920979082, -927683790, -934248793, -940673101,
+	-946955747, -953095785, -959092290, -964944360, -970651112, -976211688, -981625251, -986890984,
+	-992008094, -996975812, -1001793390, -1006460100, -1010975242, -1015338134, -1019548121, -1023604567,
+	-1027506862, -1031254418, -1034846671, -1038283080, -1041563127, -1044686319, -1047652185, -1050460278,
+	-1053110176, -1055601479, -1057933813, -1060106826, -1062120190, -1063973603, -1065666786, -1067199483,
+	-1068571464, -1069782521, -1070832474, -1071721163, -1072448455, -1073014240, -1073418433, -1073660973,
+	-1073741824,
+};
+
+// filterWeights in Q15, where 32768 is a weight of 1
+static const uint16_t filterWeightsQ15[425] = {
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+	32768, 16384, 16384, 32768, 32768, 32768, 16384, 16384,
+	32768, 32768, 32768, 16384, 16384, 32768, 32768, 16384,
+	16384, 32768, 16384, 16384, 32768, 32768, 16384, 16384,
+	32768, 16384, 16384, 32768, 16384, 16384, 32768, 16384,
+	16384, 32768, 16384, 16384, 32768, 16384, 16384, 32768,
+	16384, 16384, 32768, 16384, 16384, 32768, 16384, 16384,
+	32768, 21845, 10923, 10923, 21845, 32768, 16384, 16384,
+	32768, 16384, 16384, 32768, 21845, 10923, 10923, 21845,
+	32768, 21845, 10923, 10923, 21845, 32768, 16384, 16384,
+	32768, 21845, 10923, 10923, 21845, 32768, 21845, 10923,
+	10923, 21845, 32768, 21845, 10923, 10923, 21845, 32768,
+	21845, 10923, 10923, 21845, 32768, 21845, 10923, 10923,
+	21845, 32768, 21845, 10923, 10923, 21845, 32768, 24576,
+	16384, 8192, 8192, 16384, 24576, 32768, 21845, 10923,
+	10923, 21845, 32768, 24576, 16384, 8192, 8192, 16384,
+	24576, 32768, 21845, 10923, 10923, 21845, 32768, 24576,
+	16384, 8192, 8192, 16384, 24576, 32768, 24576, 16384,
+	8192, 8192, 16384, 24576, 32768, 24576, 16384, 8192,
+	8192, 16384, 24576, 32768, 24576, 16384, 8192, 8192,
+	16384, 24576, 32768, 26214, 19661, 13107, 6554, 6554,
+	13107, 19661, 26214, 32768, 24576, 16384, 8192, 8192,
+	16384, 24576, 32768, 26214, 19661, 13107, 6554, 6554,
+	13107, 19661, 26214, 32768, 26214, 19661, 13107, 6554,
+	6554, 13107, 19661, 26214, 32768, 24576, 16384, 8192,
+	8192, 16384, 24576, 32768, 26214, 19661, 13107, 6554,
+	6554, 13107, 19661, 26214, 32768, 27307, 21845, 16384,
+	10923, 5461, 5461, 10923, 16384, 21845, 27307, 32768,
+	26214, 19661, 13107, 6554, 6554, 13107, 19661, 26214,
+	32768, 27307, 21845, 16384, 10923, 5461, 5461, 10923,
+	16384, 21845, 27307, 32768, 26214, 19661, 13107, 6554,
+	6554, 13107, 19661, 26214, 32768, 27307, 21845, 16384,
+	10923, 5461, 5461, 10923, 16384, 21845, 27307, 32768,
+	27307, 21845, 16384, 10923, 5461, 5461, 10923, 16384,
+	21845, 27307, 32768, 27307, 21845, 16384, 10923, 5461,
+	5461, 10923, 16384, 21845, 27307, 32768, 28087, 23406,
+	18725, 14043, 9362, 4681, 4681, 9362, 14043, 18725,
+	23406, 28087, 32768, 28087, 23406, 18725, 14043, 9362,
+	4681, 4681, 9362, 14043, 18725, 23406, 28087, 32768,
+	27307, 21845, 16384, 10923, 5461, 5461, 10923, 16384,
+	21845, 27307, 32768, 28672, 24576, 20480, 16384, 12288,
+	8192, 4096, 4096, 8192, 12288, 16384, 20480, 24576,
+	28672, 32768, 28087, 23406, 18725, 14043, 9362, 4681,
+	4681, 9362, 14043, 18725, 23406, 28087, 32768, 28087,
+	23406, 18725, 14043, 9362, 4681, 4681, 9362, 14043,
+	18725, 23406, 28087, 32768, 28672, 24576, 20480, 16384,
+	12288, 8192, 4096, 4096, 8192, 12288, 16384, 20480,
+	24576, 28672, 32768, 28672, 24576, 20480, 16384, 12288,
+	8192, 4096, 4096, 8192, 12288, 16384, 20480, 24576,
+	28672, 32768, 28672, 24576, 20480, 16384, 12288, 8192,
+	4096, 4096, 8192, 12288, 16384, 20480, 24576, 28672,
+	32768, 29127, 25486, 21845, 18204, 14564, 10923, 7282,
+	3641,
+};
+
+#elif AUDIO_SAMPLE_RATE == 8000 && LOG_MEL_FFT_SIZE == 256 && LOG_MEL_FILTERS == 80
+
+// Twiddles of all stages of the half-size FFT, e^(-2 pi i k / (2 * span)) for k < span at
+// index span - 1 + k, so each stage reads its twiddles in order
+static const float twiddleRe[127] = {
+	1.0f, 1.0f, 6.12323426e-17f, 1.0f, 0.707106769f, 6.12323426e-17f, -0.707106769f, 1.0f,
+	0.923879504f, 0.707106769f, 0.382683426f, 6.12323426e-17f, -0.382683426f, -0.707106769f, -0.923879504f, 1.0f,
+	0.980785251f, 0.923879504f, 0.831469595f, 0.707106769f, 0.555570245f, 0.382683426f, 0.195090324f, 6.12323426e-17f,
+	-0.195090324f, -0.382683426f, -0.555570245f, -0.707106769f, -0.831469595f, -0.923879504f, -0.980785251f, 1.0f,
+	0.99518472f, 0.980785251f, 0.956940353f, 0.923879504f, 0.881921291f, 0.831469595f, 0.773010433f, 0.707106769f,
+	0.634393275f, 0.555570245f, 0.471396744f, 0.382683426f, 0.290284663f, 0.195090324f, 0.0980171412f, 6.12323426e-17f,
+	-0.0980171412f, -0.195090324f, -0.290284663f, -0.382683426f, -0.471396744f, -0.555570245f, -0.634393275f, -0.707106769f,
+	-0.773010433f, -0.831469595f, -0.881921291f, -0.923879504f, -0.956940353f, -0.980785251f, -0.99518472f, 1.0f,
+	0.99879545f, 0.99518472f, 0.989176512f, 0.980785251f, 0.970031261f, 0.956940353f, 0.941544056f, 0.923879504f,
+	0.903989315f, 0.881921291f, 0.857728601f, 0.831469595f, 0.803207517f, 0.773010433f, 0.740951121f, 0.707106769f,
+	0.671558976f, 0.634393275f, 0.59569931f, 0.555570245f, 0.514102757f, 0.471396744f, 0.427555084f, 0.382683426f,
+	0.336889863f, 0.290284663f, 0.242980182f, 0.195090324f, 0.146730468f, 0.0980171412f, 0.0490676761f, 6.12323426e-17f,
+	-0.0490676761f, -0.0980171412f, -0.146730468f, -0.195090324f, -0.242980182f, -0.290284663f, -0.336889863f, -0.382683426f,
+	-0.427555084f, -0.471396744f, -0.514102757f, -0.555570245f, -0.59569931f, -0.634393275f, -0.671558976f, -0.707106769f,
+	-0.740951121f, -0.773010433f, -0.803207517f, -0.831469595f, -0.857728601f, -0.881921291f, -0.903989315f, -0.923879504f,
+	-0.941544056f, -0.956940353f, -0.970031261f, -0.980785251f, -0.989176512f, -0.99518472f, -0.99879545f,
+};
+
+// Imaginary parts of twiddleRe
+static const float twiddleIm[127] = {
+	-0.0f, -0.0f, -1.0f, -0.0f, -0.707106769f, -1.0f, -0.707106769f, -0.0f,
+	-0.382683426f, -0.707106769f, -0.923879504f, -1.0f, -0.923879504f, -0.707106769f, -0.382683426f, -0.0f,
+	-0.195090324f, -0.382683426f, -0.555570245f, -0.707106769f, -0.831469595f, -0.923879504f, -0.980785251f, -1.0f,
+	-0.980785251f, -0.923879504f, -0.831469595f, -0.707106769f, -0.555570245f, -0.382683426f, -0.195090324f, -0.0f,
+	-0.0980171412f, -0.195090324f, -0.290284663f, -0.382683426f, -0.471396744f, -0.555570245f, -0.634393275f, -0.707106769f,
+	-0.773010433f, -0.831469595f, -0.881921291f, -0.923879504f, -0.956940353f, -0.980785251f, -0.99518472f, -1.0f,
+	-0.99518472f, -0.980785251f, -0.956940353f, -0.923879504f, -0.881921291f, -0.831469595f, -0.773010433f, -0.707106769f,
+	-0.634393275f, -0.555570245f, -0.471396744f, -0.382683426f, -0.290284663f, -0.195090324f, -0.0980171412f, -0.0f,
+	-0.0490676761f, -0.0980171412f, -0.146730468f, -0.195090324f, -0.242980182f, -0.290284663f, -0.336889863f, -0.382683426f,
+	-0.427555084f, -0.471396744f, -0.514102757f, -0.555570245f, -0.59569931f, -0.634393275f, -0.671558976f, -0.707106769f,
+	-0.740951121f, -0.773010433f, -0.803207517f, -0.831469595f, -0.857728601f, -0.881921291f, -0.903989315f, -0.923879504f,
+	-0.941544056f, -0.956940353f, -0.970031261f, -0.980785251f, -0.989176512f, -0.99518472f, -0.99879545f, -1.0f,
+	-0.99879545f, -0.99518472f, -0.989176512f, -0.980785251f, -0.970031261f, -0.956940353f, -0.941544056f, -0.923879504f,
+	-0.903989315f, -0.881921291f, -0.857728601f, -0.831469595f, -0.803207517f, -0.773010433f, -0.740951121f, -0.707106769f,
+	-0.671558976f, -0.634393275f, -0.59569931f, -0.555570245f, -0.514102757f, -0.471396744f, -0.427555084f, -0.382683426f,
+	-0.336889863f, -0.290284663f, -0.242980182f, -0.195090324f, -0.146730468f, -0.0980171412f, -0.0490676761f,
+};
+
+// Bit-reversed index of each sample of the half-size FFT
+static const unsigned short bitReverse[128] = {
+	0, 64, 32, 96, 16, 80, 48, 112,
+	8, 72, 40, 104, 24, 88, 56, 120,
+	4, 68, 36, 100, 20, 84, 52, 116,
+	12, 76, 44, 108, 28, 92, 60, 124,
+	2, 66, 34, 98, 18, 82, 50, 114,
+	10, 74, 42, 106, 26, 90, 58, 122,
+	6, 70, 38, 102, 22, 86, 54, 118,
+	14, 78, 46, 110, 30, 94, 62, 126,
+	1, 65, 33, 97, 17, 81, 49, 113,
+	9, 73, 41, 105, 25, 89, 57, 121,
+	5, 69, 37, 101, 21, 85, 53, 117,
+	13, 77, 45, 109, 29, 93, 61, 125,
+	3, 67, 35, 99, 19, 83, 51, 115,
+	11, 75, 43, 107, 27, 91, 59, 123,
+	7, 71, 39, 103, 23, 87, 55, 119,
+	15, 79, 47, 111, 31, 95, 63, 127,
+};
+
+// Twiddles of the split, e^(-2 pi i k / LOG_MEL_FFT_SIZE) for k <= HALF_SIZE / 2
+static const float splitRe[65] = {
+	1.0f, 0.999698818f, 0.99879545f, 0.997290432f, 0.99518472f, 0.992479563f, 0.989176512f, 0.985277653f,
+	0.980785251f, 0.975702107f, 0.970031261f, 0.963776052f, 0.956940353f, 0.949528158f, 0.941544056f, 0.932992816f,
+	0.923879504f, 0.914209783f, 0.903989315f, 0.893224299f, 0.881921291f, 0.870086968f, 0.857728601f, 0.84485358f,
+	0.831469595f, 0.817584813f, 0.803207517f, 0.78834641f, 0.773010433f, 0.757208824f, 0.740951121f, 0.724247098f,
+	0.707106769f, 0.689540565f, 0.671558976f, 0.653172851f, 0.634393275f, 0.615231574f, 0.59569931f, 0.575808167f,
+	0.555570245f, 0.534997642f, 0.514102757f, 0.492898196f, 0.471396744f, 0.449611336f, 0.427555084f, 0.405241311f,
+	0.382683426f, 0.359895051f, 0.336889863f, 0.313681751f, 0.290284663f, 0.266712755f, 0.242980182f, 0.219101235f,
+	0.195090324f, 0.170961887f, 0.146730468f, 0.122410677f, 0.0980171412f, 0.0735645667f, 0.0490676761f, 0.024541229f,
+	6.12323426e-17f,
+};
+
+// Imaginary parts of splitRe
+static const float splitIm[65] = {
+	-0.0f, -0.024541229f, -0.0490676761f, -0.0735645667f, -0.0980171412f, -0.122410677f, -0.146730468f, -0.170961887f,
+	-0.195090324f, -0.219101235f, -0.242980182f, -0.266712755f, -0.290284663f, -0.313681751f, -0.336889863f, -0.359895051f,
+	-0.382683426f, -0.405241311f, -0.427555084f, -0.449611336f, -0.471396744f, -0.492898196f, -0.514102757f, -0.534997642f,
+	-0.555570245f, -0.575808167f, -0.59569931f, -0.615231574f, -0.634393275f, -0.653172851f, -0.671558976f, -0.689540565f,
+	-0.707106769f, -0.724247098f, -0.740951121f, -0.757208824f, -0.773010433f, -0.78834641f, -0.803207517f, -0.817584813f,
+	-0.831469595f, -0.84485358f, -0.857728601f, -0.870086968f, -0.881921291f, -0.893224299f, -0.903989315f, -0.914209783f,
+	-0.923879504f, -0.932992816f, -0.941544056f, -0.949528158f, -0.956940353f, -0.963776052f, -0.970031261f, -0.975702107f,
+	-0.980785251f, -0.985277653f, -0.989176512f, -0.992479563f, -0.99518472f, -0.997290432f, -0.99879545f, -0.999698818f,
+	-1.0f,
+};
+
+// Triangular mel filters
+static const MelFilter filters[80] = {
+	{ 0, 1, 0 }, { 1, 0, 1 }, { 1, 1, 1 }, { 2, 0, 2 }, { 2, 1, 2 }, { 3, 1, 3 }, { 4, 0, 4 }, { 4, 1, 4 },
+	{ 5, 0, 5 }, { 5, 1, 5 }, { 6, 1, 6 }, { 7, 1, 7 }, { 8, 0, 8 }, { 8, 1, 8 }, { 9, 1, 9 }, { 10, 1, 10 },
+	{ 11, 0, 11 }, { 11, 1, 11 }, { 12, 1, 12 }, { 13, 1, 13 }, { 14, 1, 14 }, { 15, 1, 15 }, { 16, 1, 16 }, { 17, 0, 17 },
+	{ 17, 1, 17 }, { 18, 1, 18 }, { 19, 1, 19 }, { 20, 1, 20 }, { 21, 2, 21 }, { 22, 2, 23 }, { 24, 1, 25 }, { 25, 1, 26 },
+	{ 26, 1, 27 }, { 27, 1, 28 }, { 28, 1, 29 }, { 29, 2, 30 }, { 30, 2, 32 }, { 32, 1, 34 }, { 33, 2, 35 }, { 34, 2, 37 },
+	{ 36, 1, 39 }, { 37, 2, 40 }, { 38, 2, 42 }, { 40, 2, 44 }, { 41, 2, 46 }, { 43, 2, 48 }, { 44, 3, 50 }, { 46, 2, 53 },
+	{ 48, 2, 55 }, { 49, 3, 57 }, { 51, 2, 60 }, { 53, 2, 62 }, { 54, 3, 64 }, { 56, 3, 67 }, { 58, 3, 70 }, { 60, 3, 73 },
+	{ 62, 3, 76 }, { 64, 3, 79 }, { 66, 3, 82 }, { 68, 3, 85 }, { 70, 4, 88 }, { 72, 4, 92 }, { 75, 3, 96 }, { 77, 4, 99 },
+	{ 79, 4, 103 }, { 82, 4, 107 }, { 84, 4, 111 }, { 87, 4, 115 }, { 89, 5, 119 }, { 92, 4, 124 }, { 95, 4, 128 }, { 97, 5, 132 },
+	{ 100, 5, 137 }, { 103, 5, 142 }, { 106, 5, 147 }, { 109, 5, 152 }, { 112, 6, 157 }, { 115, 6, 163 }, { 119, 5, 169 }, { 122, 6, 174 },
+};
+
+// Weights of all filters one after the other, fewer than two per bin
+static const float filterWeights[180] = {
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f,
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.5f, 0.5f,
+	1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.5f,
+	0.5f, 1.0f, 1.0f, 1.0f, 0.5f, 0.5f, 1.0f, 1.0f,
+	1.0f, 0.5f, 0.5f, 1.0f, 1.0f, 0.5f, 0.5f, 1.0f,
+	1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 1.0f,
+	0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f,
+	0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f,
+	1.0f, 0.5f, 0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.5f, 0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f,
+	0.666666687f, 1.0f, 0.5f, 0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f,
+	0.666666687f, 1.0f, 0.5f, 0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f,
+	0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.5f,
+	0.5f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f,
+	0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f,
+	1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f,
+	0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f, 1.0f,
+	0.75f, 0.5f, 0.25f, 0.25f, 0.5f, 0.75f, 1.0f, 0.666666687f,
+	0.333333343f, 0.333333343f, 0.666666687f, 1.0f, 0.666666687f, 0.333333343f, 0.333333343f, 0.666666687f,
+	1.0f, 0.75f, 0.5f, 0.25f,
+};
+
+// Fixed-point copies of the tables for log_mel_filter_pcm. The twiddles are in Q30, which
+// holds 1 exactly, so the trivial twiddles do not leak into the other bins.
+static const int32_t twiddleReQ30[127] = {
+	1073741824, 1073741824, 0, 1073741824, 759250125, 0, -759250125, 1073741824,
+	992008094, 759250125, 410903207, 0, -410903207, -759250125, -992008094, 1073741824,
+	1053110176, 992008094, 892783698, 759250125, 596538995, 410903207, 209476638, 0,
+	-209476638, -410903207, -596538995, -759250125, -892783698, -992008094, -1053110176, 1073741824,
+	1068571464, 1053110176, 1027506862, 992008094, 946955747, 892783698, 830013654, 759250125,
+	681174602, 596538995, 506158392, 410903207, 311690799, 209476638, 105245103, 0,
+	-105245103, -209476638, -311690799, -410903207, -506158392, -596538995, -681174602, -759250125,
+	-830013654, -892783698, -946955747, -992008094, -1027506862, -1053110176, -1068571464, 1073741824,
+	1072448455, 1068571464, 1062120190, 1053110176, 1041563127, 1027506862, 1010975242, 992008094,
+	970651112, 946955747, 920979082, 892783698, 862437520, 830013654, 795590213, 759250125,
+	721080937, 681174602, 639627258, 596538995, 552013618, 506158392, 459083786, 410903207,
+	361732726, 311690799, 260897982, 209476638, 157550647, 105245103, 52686014, 0,
+	-52686014, -105245103, -157550647, -209476638, -260897982, -311690799, -361732726, -410903207,
+	-459083786, -506158392, -552013618, -596538995, -639627258, -681174602, -721080937, -759250125,
+	-795590213, -830013654, -862437520, -892783698, -920979082, -946955747, -970651112, -992008094,
+	-1010975242, -1027506862, -1041563127, -1053110176, -1062120190, -1068571464, -1072448455,
+};
+
+// Imaginary parts of twiddleReQ30
+static const int32_t twiddleImQ30[127] = {
+	0, 0, -1073741824, 0, -759250125, -1073741824, -759250125, 0,
+	-410903207, -759250125, -992008094, -1073741824, -992008094, -759250125, -410903207, 0,
+	-209476638, -410903207, -596538995, -759250125, -892783698, -992008094, -1053110176, -1073741824,
+	-1053110176, -992008094, -892783698, -759250125, -596538995, -410903207, -209476638, 0,
+	-105245103, -209476638, -311690799, -410903207, -506158392, -596538995, -681174602, -759250125,
+	-830013654, -892783698, -946955747, -992008094, -1027506862, -1053110176, -1068571464, -1073741824,
+	-1068571464, -1053110176, -1027506862, -992008094, -946955747, -892783698, -830013654, -759250125,
+	-681174602, -596538995, -506158392, -410903207, -311690799, -209476638, -105245103, 0,
+	-52686014, -105245103, -157550647, -209476638, -260897982, -311690799, -361732726, -410903207,
+	-459083786, -506158392, -552013618, -596538995, -639627258, -681174602, -721080937, -759250125,
+	-795590213, -830013654, -862437520, -892783698, -920979082, -946955747, -970651112, -992008094,
+	-1010975242, -1027506862, -1041563127, -1053110176, -1062120190, -1068571464, -1072448455, -1073741824,
+	-1072448455, -1068571464, -1062120190, -1053110176, -1041563127, -1027506862, -1010975242, -992008094,
+	-970651112, -946955747, -920979082, -892783698, -862437520, -830013654, -795590213, -759250125,
+	-721080937, -681174602, -639627258, -596538995, -552013618, -506158392, -459083786, -410903207,
+	-361732726, -311690799, -260897982, -209476638, -157550647, -105245103, -52686014,
+};
+
+// splitRe in Q30
+static const int32_t splitReQ30[65] = {
+	1073741824, 1073418433, 1072448455, 1070832474, 1068571464, 1065666786, 1062120190, 1057933813,
+	1053110176, 1047652185, 1041563127, 1034846671, 1027506862, 1019548121, 1010975242, 1001793390,
+	992008094, 981625251, 970651112, 959092290, 946955747, 934248793, 920979082, 907154608,
+	892783698, 877875009, 862437520, 846480531, 830013654, 813046808, 795590213, 777654384,
+	759250125, 740388522, 721080937, 701339000, 681174602, 660599890, 639627258, 618269338,
+	596538995, 574449320, 552013618, 529245404, 506158392, 482766489, 459083786, 435124548,
+	410903207, 386434353, 361732726, 336813204, 311690799, 286380643, 260897982, 235258165,
+	209476638, 183568930, 157550647, 131437462, 105245103, 78989349, 52686014, 26350943,
+	0,
+};
+
+// splitIm in Q30
+static const int32_t splitImQ30[65] = {
+	0, -26350943, -52686014, -78989349, -105245103, -131437462, -157550647, -183568930,
+	-209476638, -235258165, -260897982, -286380643, -311690799, -336813204, -361732726, -386434353,
+	-410903207, -435124548, -459083786, -482766489, -506158392, -529245404, -552013618, -574449320,
+	-596538995, -618269338, -639627258, -660599890, -681174602, -701339000, -721080937, -740388522,
+	-759250125, -777654384, -795590213, -813046808, -830013654, -846480531, -862437520, -877875009,
+	-892783698, -907154608, -920979082, -934248793, -946955747, -959092290, -970651112, -981625251,
+	-992008094, -1001793390, -1010975242, -1019548121, -1027506862, -1034846671, -1041563127, -1047652185,
+	-1053110176, -1057933813, -1062120190, -1065666786, -1068571464, -1070832474, -1072448455, -1073418433,
+	-1073741824,
+};
+
+// filterWeights in Q15, where 32768 is a weight of 1
+static const uint16_t filterWeightsQ15[180] = {
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 32768,
+	32768, 32768, 32768, 32768, 32768, 32768, 16384, 16384,
+	32768, 32768, 32768, 32768, 32768, 32768, 32768, 16384,
+	16384, 32768, 32768, 32768, 16384, 16384, 32768, 32768,
+	32768, 16384, 16384, 32768, 32768, 16384, 16384, 32768,
+	32768, 16384, 16384, 32768, 16384, 16384, 32768, 32768,
+	16384, 16384, 32768, 16384, 16384, 32768, 32768, 16384,
+	16384, 32768, 16384, 16384, 32768, 16384, 16384, 32768,
+	16384, 16384, 32768, 16384, 16384, 32768, 16384, 16384,
+	32768, 16384, 16384, 32768, 16384, 16384, 32768, 16384,
+	16384, 32768, 21845, 10923, 10923, 21845, 32768, 16384,
+	16384, 32768, 16384, 16384, 32768, 21845, 10923, 10923,
+	21845, 32768, 16384, 16384, 32768, 21845, 10923, 10923,
+	21845, 32768, 16384, 16384, 32768, 21845, 10923, 10923,
+	21845, 32768, 21845, 10923, 10923, 21845, 32768, 16384,
+	16384, 32768, 21845, 10923, 10923, 21845, 32768, 21845,
+	10923, 10923, 21845, 32768, 21845, 10923, 10923, 21845,
+	32768, 21845, 10923, 10923, 21845, 32768, 21845, 10923,
+	10923, 21845, 32768, 21845, 10923, 10923, 21845, 32768,
+	24576, 16384, 8192, 8192, 16384, 24576, 32768, 21845,
+	10923, 10923, 21845, 32768, 21845, 10923, 10923, 21845,
+	32768, 24576, 16384, 8192,
+};
+
+#else
+#error No log-mel tables for this AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and LOG_MEL_FILTERS, run tools/generate_log_mel_tables.py
+#endif
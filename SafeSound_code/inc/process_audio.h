@@ -2,53 +2,145 @@
 
 #include <stdbool.h>
 
+#include "activity_detector.h"
+
 #define FEATURES_SIZE 80
 #define NUM_CATEGORIES 3
 
 // categories for audio classification
 extern const char* const categories[];
+// number of agreeing frames smooth_prediction needs to exceed before reporting a prediction
+extern const int CONSECUTIVE_PREDICTION_THRESHOLD;
+// Frames a stream classifies before handing the classifier to the next waiting stream
+#define CLASSIFIER_TURN_FRAMES 16
+
+/// <summary>
+/// Smoothing state for one stream of predictions, e.g. one microphone.
+/// Use prediction_state_reset and smooth_prediction to manipulate this struct.
+/// The classifier's recurrent state cannot be saved and restored, so it belongs to one stream
+/// at a time. Active microphones take turns: a stream keeps the classifier for at least
+/// CLASSIFIER_TURN_FRAMES frames, then hands it to the next waiting stream, and the active
+/// frames of the waiting microphones are left out meanwhile. With AUDIO_ACTIVITY_GATE 0 every
+/// microphone is always active, so they all take turns.
+/// </summary>
+typedef struct PredictionState {
+	float overall_inverse_confidence;
+	int last_prediction;
+	unsigned short num_same_prediction;
+	FrameInfo run_start;  // first frame of the current run of agreeing predictions
+	FrameInfo onset;  // first frame of the run behind the latest detection
+	bool decimated;  // the last active frame was left out by decimation
+	unsigned int excluded_frames;  // active frames left out because another stream had the classifier
+	int turn_frames;  // frames classified since the stream last took the classifier
+} PredictionState;
+
+/// <summary>
+///     Clears the agreeing frames counted by smooth_prediction.
+/// </summary>
+/// <param name="state">Smoothing state to reset.</param>
+void prediction_state_reset(PredictionState* state);
 
 /// <summary>
 ///     Smooths predictions by ensuring that the same prediction occurs
 ///     over multiple frames with a confidence exceeding the threshold.
 /// </summary>
+/// <param name="state">Smoothing state of the stream the prediction belongs to.</param>
+/// <param name="frame">Origin of the frame the prediction was made for.</param>
 /// <param name="prediction">Integer representing current prediction.</param>
 /// <param name="confidence">Current confidence in prediction.</param>
-/// <returns>Overall confidence.</returns>
-float smooth_prediction(int prediction, float confidence);
+/// <returns>Overall confidence. If it is above 0, state->onset holds the first agreeing frame.</returns>
+float smooth_prediction(PredictionState* state, const FrameInfo* frame, int prediction,
+	float confidence);
 
 /// <summary>
-///     Checks that everything is setup correction for prediction.
+///     Checks that everything is set up correctly for prediction: that the featurizer, the
+///     classifier and the prerecorded features fit together, and with AUDIO_FEATURIZER_SELF_TEST
+///     that the featurizers agree on the prerecorded clip.
 /// </summary>
 /// <returns>true if successful, false for error.</returns>
 bool check_predict_setup(void);
 
 /// <summary>
-///     Smooths predictions by ensuring that the same prediction occurs
-///     over multiple frames with a confidence exceeding the threshold.
+///     Converts 16-bit PCM samples to floats from -1 to 1.
 /// </summary>
-/// <param name="prediction">Integer representing current prediction.</param>
-/// <param name="confidence">Current confidence in prediction.</param>
-/// <returns>Overall confidence.</returns>
-void predict_single_frame(float* inputData, int* prediction, float* confidence);
+/// <param name="input">16-bit PCM samples.</param>
+/// <param name="output">Receives the converted samples. Must not overlap input.</param>
+/// <param name="count">Number of samples to convert.</param>
+void pcm_to_float(const short* input, float* output, int count);
 
 /// <summary>
-///     Loads the next frame of the prerecorded sample into the featurizer_input_buffer.
+///     Featurizes and classifies a single frame of audio.
 /// </summary>
-/// <param name="featurizer_input_buffer">Buffer for storing next data frame.</param>
+/// <param name="inputData">AUDIO_FRAME_SIZE samples of 16-bit PCM audio.</param>
+/// <param name="prediction">Receives the predicted category.</param>
+/// <param name="confidence">Receives the confidence in the prediction.</param>
+void predict_single_frame(const short* inputData, int* prediction, float* confidence);
+
+/// <summary>
+///     Classifies a frame if the activity detector finds it active, and smooths the prediction.
+///     Quiet frames are skipped. The classifier's recurrent state is stale after skipped frames,
+///     so at an onset the classifier and smoothing state are reset and the pre-roll frames are
+///     classified first. While decimating, every other active frame after the onset is skipped
+///     as well.
+///     An active frame takes the classifier if no other stream has it and no other stream has
+///     waited longer. Otherwise it is counted in state->excluded_frames, skipped, and kept as
+///     pre-roll, and the stream waits its turn. A stream which takes the classifier starts
+///     afresh like at an onset, with the frames it left out last as pre-roll. After
+///     CLASSIFIER_TURN_FRAMES frames, the classifier goes to the next waiting stream, unless
+///     the agreeing frames of a detection are building up or the stream holds it.
+///     A quiet frame gives the classifier up, unless the stream holds it with predict_hold,
+///     and ends the wait of a waiting stream.
+/// </summary>
+/// <param name="detector">Activity detector of the stream the frame belongs to.</param>
+/// <param name="state">Smoothing state of the stream the frame belongs to.</param>
+/// <param name="inputData">AUDIO_FRAME_SIZE samples of 16-bit PCM audio.</param>
+/// <param name="info">Origin of the frame.</param>
+/// <param name="decimate">True to classify only every other active frame.</param>
+/// <param name="prediction">Receives the predicted category of the frame.</param>
+/// <param name="overallConfidence">Receives the result of smooth_prediction, 0 if skipped.</param>
+/// <returns>
+///		Number of frames classified, 0 if the frame was skipped. A skipped frame was decimated if
+///		state->decimated is set.
+///	</returns>
+int predict_active_frame(ActivityDetector* detector, PredictionState* state,
+	const short* inputData, const FrameInfo* info, bool decimate, int* prediction,
+	float* overallConfidence);
+
+/// <summary>
+///     Classifies the next frame of the prerecorded sample from its features, which are
+///     precomputed by tools/generate_prerecorded_features.py into window_break_features.h.
+/// </summary>
+/// <param name="prediction">Receives the predicted category of the frame.</param>
+/// <param name="confidence">Receives the confidence of the prediction.</param>
 /// <returns>True if there is additional data to process, false otherwise.</returns>
-bool prepare_prerecorded(float* featurizer_input_buffer);
+bool predict_prerecorded_frame(int* prediction, float* confidence);
 
 void predict_prerecorded(void);
 
 /// <summary>
-///     Resets the classifier.
+///     Resets the featurizer and classifier. Their recurrent state is shared by every
+///     stream, so smoothing state has to be reset separately.
 /// </summary>
 void predict_reset(void);
 
+/// <summary>
+///     Takes the classifier for a stream which is not gated by an activity detector, e.g. a
+///     replay, until predict_release. A microphone which has the classifier loses it, and no
+///     microphone is classified meanwhile. The classifier and the smoothing state are reset.
+/// </summary>
+/// <param name="state">Smoothing state of the stream.</param>
+/// <returns>True on success, false if another stream already holds the classifier.</returns>
+bool predict_hold(PredictionState* state);
+
+/// <summary>
+///     Gives up the classifier taken with predict_hold, and resets it.
+/// </summary>
+/// <param name="state">Smoothing state the classifier was held for.</param>
+void predict_release(PredictionState* state);
+
 /// <summary>
 ///     Resets the prerecorded data index.
-///     Should be called before using prepare_prerecorded() the first time.
+///     Should be called before using predict_prerecorded_frame() the first time.
 /// </summary>
 void prerecorded_reset(void);
 
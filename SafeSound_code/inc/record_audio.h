@@ -1,9 +1,22 @@
 #pragma once
 
+#include "audio_source.h"
+#include "common.h"
+
+/// <summary>
+/// Arguments for RecordAudioThread. Must stay in memory until the thread exits.
+/// </summary>
+typedef struct RecordAudioContext {
+	AudioBuffer* buffers[MAX_AUDIO_CHANNELS];  // one per channel, receives the frames of that channel
+	int buffer_count;  // number of AudioBuffers in buffers, at least the source's channel count
+	AudioSource* source;  // opened by the caller, which closes it once the thread has exited
+	CaptureStats stats;  // updated by the thread
+} RecordAudioContext;
+
 /// <summary>
-///     Runs an infinite loop which records audio from the microphone in socket 1 and processes it
-///     it to create features that can be input into the classifier.
+///     Runs an infinite loop which records audio from the configured audio source and hands
+///     complete frames of each channel to the main loop through that channel's AudioBuffer.
 /// </summary>
-/// <param name="vargp">Used to pass the AudioBuffer struct.</param>
+/// <param name="vargp">Used to pass the RecordAudioContext struct.</param>
 /// <returns>NULL</returns>
 void* RecordAudioThread(void* vargp);
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdbool.h>
+
+#include "audio_source.h"
+#include "decimator.h"
+#include "process_audio.h"
+
+#define REPLAY_MAX_DETECTIONS 32  // detections kept per replayed source
+// A replay on the device classifies REPLAY_STEP_FRAMES frames every REPLAY_STEP_PERIOD_MS, so
+// other events are served in between. At a hop of 512 samples this is 6 times real time.
+#define REPLAY_STEP_FRAMES 1
+#define REPLAY_STEP_PERIOD_MS 5
+
+/// <summary>
+/// A detection made while replaying audio.
+/// </summary>
+typedef struct ReplayDetection {
+	int prediction;  // predicted category
+	float confidence;  // overall confidence from smooth_prediction (0 - 1)
+	// Positions at AUDIO_SAMPLE_RATE, also for sources that were decimated from AUDIO_CAPTURE_RATE
+	unsigned long long onset_sample;  // first sample of the frames which led to the detection
+	unsigned long long decision_sample;  // sample after the frame which triggered the detection
+} ReplayDetection;
+
+/// <summary>
+/// Results of replaying one audio source through the detection pipeline.
+/// </summary>
+typedef struct ReplayResult {
+	unsigned int frames;  // frames read from the source, one per hop
+	unsigned int skipped_frames;  // frames the activity detector skipped
+	unsigned long long samples;  // samples covered by the frames (whole hops only)
+	float audio_seconds;  // duration of the replayed audio
+	float processing_seconds;  // time spent in replay_step, not counting the pauses between steps
+	float real_time_factor;  // processing_seconds / audio_seconds; below 1 is faster than real time
+	float frames_per_second;  // frames processed per second of processing_seconds
+	int detection_count;  // number of detections, including those not stored in detections
+	ReplayDetection detections[REPLAY_MAX_DETECTIONS];
+} ReplayResult;
+
+/// <summary>
+/// A replay of one audio source through the detection pipeline, a few frames at a time.
+/// Use the replay_* functions to manipulate this struct.
+/// </summary>
+typedef struct Replay {
+	AudioSource* source;
+	bool decimate;  // the source runs at AUDIO_CAPTURE_RATE and goes through decimator
+	Decimator decimator;
+	PredictionState state;  // smoothing of the replayed predictions, private to the replay
+	ActivityDetector detector;
+	short frame[AUDIO_FRAME_SIZE];
+	bool filled;  // frame holds the next frame to classify
+	float threshold;
+	long long processing_ns;  // time spent in replay_step
+	ReplayResult result;
+} Replay;
+
+/// <summary>
+///     Opens an audio source for replaying. The source must be mono and match the active rate
+///     profile: AUDIO_SAMPLE_RATE, or AUDIO_CAPTURE_RATE if the profile decimates, in which
+///     case it goes through the same filter as live audio.
+///     The smoothing state is private to the replay, and the replay holds the classifier with
+///     predict_hold until replay_close, so no microphone is classified meanwhile.
+/// </summary>
+/// <param name="replay">Replay to start.</param>
+/// <param name="source">Audio source to replay. It stays owned by the caller.</param>
+/// <param name="threshold">Overall confidence above which a prediction other than background noise is reported.</param>
+/// <returns>
+///		True if the source was opened, false on failure or if another stream holds the classifier,
+///		in which case the source is closed again.
+///	</returns>
+bool replay_open(Replay* replay, AudioSource* source, float threshold);
+
+/// <summary>
+///     Classifies up to the given number of frames of an open replay, one per hop.
+/// </summary>
+/// <param name="replay">Replay to continue.</param>
+/// <param name="maxFrames">Most frames to classify.</param>
+/// <returns>True if more frames remain, false once the whole source has been replayed.</returns>
+bool replay_step(Replay* replay, int maxFrames);
+
+/// <summary>
+///     Closes the source of a replay, releases the classifier and completes replay->result.
+/// </summary>
+/// <param name="replay">Replay to finish.</param>
+void replay_close(Replay* replay);
+
+/// <summary>
+///     Replays every frame of an audio source as fast as possible, without pacing, see
+///     replay_open.
+/// </summary>
+/// <param name="source">Audio source to replay. It is opened and closed by this function.</param>
+/// <param name="threshold">Overall confidence above which a prediction other than background noise is reported.</param>
+/// <param name="result">Receives the detections and timing.</param>
+/// <returns>True if the whole source was replayed, false on failure.</returns>
+bool replay_audio_source(AudioSource* source, float threshold, ReplayResult* result);
+
+/// <summary>
+///     Replays a 16-bit mono WAV file as fast as possible, see replay_audio_source.
+/// </summary>
+/// <param name="path">Path of the WAV file. Relative paths are opened from the image package.</param>
+/// <param name="threshold">Overall confidence above which a prediction other than background noise is reported.</param>
+/// <param name="result">Receives the detections and timing.</param>
+/// <returns>True if the whole file was replayed, false on failure.</returns>
+bool replay_wav_file(const char* path, float threshold, ReplayResult* result);
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <stdbool.h>
+#include <time.h>
+
+#include "common.h"
+
+#define RESAMPLER_TAPS 8  // input samples contributing to each output sample
+#define RESAMPLER_PHASES 32  // fractional positions with precomputed taps
+// Largest number of input samples that can be passed to resampler_process at once
+#define RESAMPLER_MAX_INPUT (AUDIO_CAPTURE_BLOCK_SIZE + AUDIO_FRAME_SIZE)
+// Largest number of output samples resampler_process can produce from RESAMPLER_MAX_INPUT
+#define RESAMPLER_MAX_OUTPUT (RESAMPLER_MAX_INPUT + RESAMPLER_MAX_INPUT / 16 + 1)
+// Largest correction applied to the input rate, as a fraction of AUDIO_SAMPLE_RATE
+#define RESAMPLER_MAX_DRIFT 0.05
+
+/// <summary>
+/// Streaming fractional resampler which converts audio captured at a measured rate into
+/// exactly AUDIO_SAMPLE_RATE samples per second.
+/// Use the resampler_* functions to manipulate this struct.
+/// </summary>
+typedef struct Resampler {
+	short history[RESAMPLER_TAPS + RESAMPLER_MAX_INPUT];
+	int history_length;  // number of valid samples in history
+	double position;  // position of the next output sample in history, in input samples
+	double step;  // input samples per output sample
+	double input_rate;  // estimated input rate in samples/sec
+	struct timespec window_start;  // start of the current rate measurement window
+	double window_samples;  // input sample periods elapsed in the current window
+	bool window_started;
+} Resampler;
+
+/// <summary>
+///     Precomputes the filter taps (once) and resets rs to a 1:1 ratio.
+/// </summary>
+/// <param name="rs">Resampler to initialize.</param>
+void resampler_init(Resampler* rs);
+
+/// <summary>
+///     Updates the input rate estimate with the sample periods of the input's clock that
+///     elapsed by a given time.
+/// </summary>
+/// <param name="rs">Resampler to update.</param>
+/// <param name="samples">
+///		Input sample periods since the previous call: samples received, and samples the source
+///		produced but that were lost. Samples invented to fill a shortfall do not count.
+///	</param>
+/// <param name="timestamp">CLOCK_MONOTONIC time at which the last of the samples was taken.</param>
+void resampler_update_rate(Resampler* rs, double samples, const struct timespec* timestamp);
+
+/// <summary>
+///     Resamples a block of input samples. At a step of exactly 1.0 from a whole input sample
+///     the samples pass through unfiltered.
+/// </summary>
+/// <param name="rs">Resampler to use.</param>
+/// <param name="input">Input samples (16-bit PCM).</param>
+/// <param name="inputCount">Number of input samples, at most RESAMPLER_MAX_INPUT.</param>
+/// <param name="output">Buffer which receives the output samples (16-bit PCM).</param>
+/// <param name="outputSize">Length of output, at least RESAMPLER_MAX_OUTPUT.</param>
+/// <returns>Number of samples written to output.</returns>
+int resampler_process(Resampler* rs, const short* input, int inputCount,
+	short* output, int outputSize);
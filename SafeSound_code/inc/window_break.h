@@ -1,4 +1,4 @@
-short sample_wav_data[][AUDIO_FRAME_SIZE] = {
+short sample_wav_data[][AUDIO_CAPTURE_FRAME_SIZE] = {
 {-28.0, -29.0, -28.0, -26.0, -21.0, -15.0, -11.0, -5.0, 0.0, 6.0, 7.0, 9.0, 10.0, 7.0, 4.0, 2.0, -3.0, -3.0, -9.0, -16.0, -22.0, -28.0, -21.0, -16.0, -12.0, -9.0, -4.0, 0.0, 5.0, 16.0, 24.0, 30.0, 26.0, 22.0, 16.0, 8.0, 0.0, -3.0, -5.0, -6.0, -4.0, 0.0, 5.0, 8.0, 8.0, 8.0, 11.0, 19.0, 20.0, 21.0, 22.0, 20.0, 17.0, 14.0, 15.0, 12.0, 12.0, 16.0, 18.0, 21.0, 22.0, 20.0, 22.0, 21.0, 20.0, 23.0, 23.0, 22.0, 16.0, 11.0, 6.0, -1.0, -7.0, -10.0, -7.0, -1.0, 6.0, 8.0, 8.0, 10.0, 11.0, 12.0, 7.0, 2.0, -3.0, -7.0, -12.0, -14.0, -11.0, -9.0, -6.0, 1.0, 6.0, 8.0, 12.0, 13.0, 10.0, 5.0, 2.0, 2.0, 6.0, 12.0, 12.0, 15.0, 15.0, 15.0, 17.0, 13.0, 10.0, 9.0, 10.0, 10.0, 7.0, 9.0, 5.0, 1.0, 1.0, 4.0, 8.0, 11.0, 17.0, 23.0, 24.0, 28.0, 35.0, 34.0, 35.0, 32.0, 28.0, 25.0, 20.0, 19.0, 23.0, 29.0, 33.0, 34.0, 40.0, 43.0, 42.0, 41.0, 39.0, 36.0, 29.0, 24.0, 21.0, 17.0, 14.0, 11.0, 13.0, 14.0, 12.0, 10.0, 5.0, 1.0, 3.0, 8.0, 17.0, 26.0, 30.0, 30.0, 23.0, 14.0, 5.0, 0.0, 1.0, 3.0, 8.0, 14.0, 18.0, 17.0, 11.0, 9.0, 8.0, 6.0, 6.0, 7.0, 4.0, 1.0, -1.0, -4.0, -7.0, -10.0, -12.0, -10.0, -12.0, -6.0, 3.0, 8.0, 13.0, 16.0, 18.0, 17.0, 9.0, -2.0, -8.0, -12.0, -9.0, -11.0, -17.0, -18.0, -19.0, -19.0, -14.0, -7.0, 2.0, 5.0, 7.0, 10.0, 5.0, -8.0, -22.0, -34.0, -45.0, -48.0, -45.0, -45.0, -42.0, -42.0, -40.0, -32.0, -30.0, -25.0, -19.0, -15.0, -14.0, -14.0, -15.0, -21.0, -18.0, -15.0, -15.0, -16.0, -15.0, -12.0, -13.0, -20.0, -25.0, -29.0, -29.0, -27.0, -23.0, -14.0, -9.0, -5.0, -3.0, 0.0, -4.0, -7.0, -6.0, -9.0, -16.0, -21.0, -19.0, -21.0, -22.0, -26.0, -25.0, -23.0, -18.0, -8.0, -1.0, 5.0, 6.0, 6.0, 0.0, -12.0, -20.0, -29.0, -34.0, -31.0, -27.0, -21.0, -16.0, -12.0, -9.0, -10.0, -5.0, 2.0, 3.0, 0.0, -4.0, -6.0, -13.0, -16.0, -18.0, -22.0, -21.0, -17.0, -17.0, -18.0, -13.0, -9.0, -8.0, -7.0, -7.0, -4.0, -3.0, -5.0, -7.0, -10.0, -10.0, -10.0, -8.0, -3.0, 3.0, 4.0, 1.0, -3.0, -6.0, -8.0, -5.0, 4.0, 11.0, 18.0, 20.0, 19.0, 17.0, 16.0, 12.0, 10.0, 10.0, 11.0, 14.0, 19.0, 25.0, 32.0, 33.0, 34.0, 35.0, 34.0, 33.0, 35.0, 36.0, 35.0, 32.0, 30.0, 28.0, 24.0, 20.0, 17.0, 16.0, 18.0, 19.0, 23.0, 30.0, 36.0, 39.0, 43.0, 40.0, 32.0, 29.0, 22.0, 13.0, 11.0, 14.0, 18.0, 26.0, 28.0, 30.0, 32.0, 29.0, 27.0, 23.0, 19.0, 14.0, 16.0, 16.0, 15.0, 15.0, 16.0, 17.0, 16.0, 18.0, 19.0, 17.0, 16.0, 15.0, 16.0, 11.0, 9.0, 10.0, 7.0, 3.0, 1.0, 5.0, 3.0, 4.0, 3.0, 1.0, 3.0, 4.0, 6.0, 1.0, -1.0, -1.0, 0.0, 1.0, 2.0, 7.0, 6.0, 8.0, 0.0, -6.0, -6.0, -12.0, -15.0, -17.0, -16.0, -13.0, -10.0, -8.0, -5.0, 1.0, 7.0, 6.0, 1.0, 0.0, 4.0, 2.0, -1.0, -7.0, -12.0, -8.0, -4.0, -4.0, -7.0, -13.0, -14.0, -17.0, -17.0, -15.0, -15.0, -15.0, -15.0, -9.0, -8.0, -12.0, -17.0, -15.0, -16.0, -14.0, -11.0, -15.0, -19.0, -24.0, -22.0, -21.0, -23.0, -23.0, -22.0, -21.0, -21.0, -18.0, -17.0, -17.0, -18.0, -16.0, -16.0, -17.0, -19.0, -22.0, -21.0, -18.0, -15.0, -16.0, -19.0, -16.0, -10.0, -6.0, -7.0, -9.0, -15.0, -18.0, -21.0, -22.0, -22.0, -16.0, -11.0, -10.0, -4.0, -3.0, 0.0, 1.0, 0.0, -2.0, -4.0, -9.0, -15.0, -20.0, -24.0, -23.0, -23.0, -17.0, -12.0, -6.0, -7.0, -7.0, -3.0, 5.0, 13.0, 17.0, 19.0, 16.0, 9.0, 2.0, -4.0, -5.0, -8.0, -2.0, 8.0, 17.0, 21.0, },
 {25.0, 25.0, 22.0, 24.0, 20.0, 19.0, 18.0, 16.0, 16.0, 13.0, 11.0, 6.0, 5.0, 1.0, -2.0, -2.0, 2.0, 7.0, 13.0, 22.0, 30.0, 31.0, 29.0, 26.0, 16.0, 4.0, -3.0, -7.0, -6.0, -3.0, 5.0, 15.0, 17.0, 19.0, 21.0, 18.0, 20.0, 21.0, 21.0, 24.0, 20.0, 15.0, 12.0, 9.0, 4.0, 1.0, -1.0, -1.0, 0.0, 1.0, 1.0, 1.0, 5.0, 9.0, 9.0, 7.0, -2.0, -7.0, -2.0, 3.0, 9.0, 9.0, 11.0, 13.0, 13.0, 13.0, 9.0, 2.0, -3.0, -5.0, -2.0, 6.0, 11.0, 18.0, 19.0, 17.0, 10.0, 5.0, 2.0, -2.0, -1.0, -2.0, 0.0, 5.0, 8.0, 7.0, 6.0, 7.0, 2.0, -8.0, -16.0, -16.0, -13.0, -10.0, -1.0, 9.0, 10.0, 13.0, 12.0, 10.0, 3.0, -4.0, -4.0, -9.0, -11.0, -16.0, -15.0, -13.0, -13.0, -12.0, -14.0, -16.0, -17.0, -14.0, -13.0, -11.0, -8.0, -7.0, -17.0, -22.0, -29.0, -38.0, -45.0, -47.0, -49.0, -50.0, -49.0, -45.0, -39.0, -36.0, -35.0, -33.0, -33.0, -36.0, -39.0, -47.0, -51.0, -51.0, -48.0, -48.0, -45.0, -39.0, -38.0, -37.0, -33.0, -23.0, -15.0, -5.0, 0.0, -1.0, 0.0, 2.0, -2.0, -14.0, -19.0, -18.0, -12.0, -7.0, -8.0, -7.0, -4.0, -5.0, -13.0, -18.0, -19.0, -22.0, -24.0, -19.0, -17.0, -11.0, -12.0, -15.0, -14.0, -13.0, -20.0, -27.0, -32.0, -46.0, -48.0, -44.0, -44.0, -44.0, -35.0, -27.0, -26.0, -22.0, -18.0, -14.0, -10.0, -8.0, -9.0, -10.0, -5.0, -3.0, -3.0, -3.0, -8.0, -9.0, -12.0, -13.0, -11.0, -8.0, -6.0, -4.0, 1.0, 7.0, 10.0, 11.0, 10.0, 16.0, 19.0, 18.0, 22.0, 26.0, 25.0, 22.0, 24.0, 24.0, 21.0, 17.0, 18.0, 17.0, 16.0, 16.0, 15.0, 15.0, 13.0, 15.0, 12.0, 16.0, 17.0, 21.0, 23.0, 21.0, 18.0, 13.0, 6.0, -4.0, -5.0, -10.0, -9.0, -8.0, -10.0, -5.0, 1.0, 4.0, 5.0, 1.0, 1.0, 6.0, 6.0, 3.0, 0.0, -3.0, -5.0, -8.0, -5.0, -5.0, -1.0, 3.0, 10.0, 13.0, 12.0, 9.0, 6.0, 5.0, 3.0, 5.0, 6.0, 0.0, -3.0, -4.0, -3.0, 1.0, 0.0, 0.0, 0.0, 6.0, 11.0, 8.0, -2.0, 2.0, 4.0, 5.0, 11.0, 7.0, 1.0, 1.0, 0.0, 1.0, -5.0, -3.0, 3.0, 1.0, -4.0, -3.0, -2.0, -2.0, 5.0, 6.0, 6.0, 3.0, -9.0, -16.0, -16.0, -22.0, -19.0, -17.0, -10.0, 1.0, 1.0, 4.0, 8.0, 13.0, 19.0, 13.0, 1.0, -13.0, -25.0, -31.0, -40.0, -38.0, -39.0, -37.0, -26.0, -16.0, -8.0, 4.0, 16.0, 16.0, 16.0, 16.0, 10.0, 8.0, 9.0, 0.0, -4.0, -11.0, -16.0, -12.0, -3.0, 4.0, 5.0, 8.0, 15.0, 9.0, 8.0, 8.0, 9.0, 11.0, 3.0, -2.0, -19.0, -24.0, -34.0, -35.0, -30.0, -27.0, -20.0, -4.0, 4.0, 15.0, 22.0, 18.0, 20.0, 12.0, 4.0, -4.0, -22.0, -32.0, -36.0, -42.0, -39.0, -41.0, -36.0, -44.0, -45.0, -36.0, -36.0, -32.0, -38.0, -40.0, -42.0, -43.0, -44.0, -45.0, -42.0, -32.0, -30.0, -34.0, -28.0, -19.0, -8.0, -4.0, -4.0, -4.0, -9.0, -16.0, -21.0, -24.0, -26.0, -21.0, -20.0, -15.0, -7.0, -2.0, -3.0, 0.0, 0.0, 3.0, 5.0, 10.0, 13.0, 9.0, 5.0, 1.0, 3.0, 10.0, 13.0, 15.0, 16.0, 14.0, 15.0, 13.0, 11.0, 10.0, 13.0, 13.0, 8.0, 6.0, 9.0, 6.0, -3.0, -8.0, -10.0, -14.0, -12.0, -6.0, -3.0, 4.0, 15.0, 14.0, 10.0, 7.0, 8.0, 17.0, 15.0, 19.0, 17.0, 14.0, 12.0, 9.0, 12.0, 14.0, 15.0, 15.0, 17.0, 28.0, 31.0, 38.0, 41.0, 44.0, 48.0, 45.0, 42.0, 33.0, 29.0, 29.0, 28.0, 32.0, 29.0, 31.0, 35.0, 32.0, 26.0, 26.0, 32.0, 28.0, 26.0, 25.0, 24.0, 32.0, 29.0, 24.0, 18.0, 11.0, 8.0, 8.0, 9.0, 8.0, 10.0, 9.0, 12.0, 15.0, 18.0, 22.0, 26.0, 32.0, 35.0, 26.0, 17.0, 12.0, 3.0, 0.0, 1.0, 1.0, 3.0, 1.0, 2.0, 4.0, 7.0, 9.0, },
 {10.0, 10.0, 13.0, 14.0, 10.0, 10.0, 12.0, 15.0, 18.0, 13.0, 17.0, 14.0, 16.0, 20.0, 19.0, 19.0, 23.0, 21.0, 19.0, 17.0, 15.0, 17.0, 19.0, 16.0, 12.0, 8.0, 3.0, -1.0, -5.0, -6.0, -8.0, -7.0, -3.0, 1.0, 4.0, 0.0, 1.0, 2.0, 2.0, -4.0, -6.0, -5.0, -9.0, -12.0, -11.0, -5.0, 4.0, 5.0, 4.0, 0.0, -2.0, -1.0, -3.0, -8.0, -9.0, -15.0, -14.0, -7.0, -6.0, -1.0, 2.0, -2.0, -6.0, -8.0, -12.0, -14.0, -17.0, -14.0, -9.0, -14.0, -12.0, -10.0, -6.0, -2.0, -2.0, 4.0, 7.0, 10.0, 13.0, 11.0, 14.0, 17.0, 17.0, 15.0, 12.0, 7.0, 6.0, 5.0, -1.0, -4.0, -6.0, -3.0, -1.0, 4.0, 2.0, 3.0, 1.0, -2.0, -1.0, -5.0, -3.0, -4.0, -4.0, 2.0, -1.0, 0.0, 3.0, 6.0, 14.0, 19.0, 23.0, 25.0, 21.0, 26.0, 23.0, 24.0, 21.0, 15.0, 12.0, 10.0, 10.0, 16.0, 21.0, 25.0, 32.0, 29.0, 27.0, 25.0, 21.0, 20.0, 18.0, 18.0, 16.0, 14.0, 11.0, 8.0, 11.0, 12.0, 12.0, 11.0, 10.0, 16.0, 26.0, 32.0, 38.0, 41.0, 37.0, 36.0, 33.0, 31.0, 28.0, 22.0, 20.0, 17.0, 18.0, 21.0, 30.0, 38.0, 38.0, 43.0, 47.0, 46.0, 46.0, 43.0, 38.0, 34.0, 27.0, 25.0, 20.0, 16.0, 15.0, 14.0, 15.0, 19.0, 19.0, 20.0, 23.0, 30.0, 38.0, 41.0, 42.0, 42.0, 38.0, 35.0, 34.0, 32.0, 32.0, 29.0, 26.0, 26.0, 24.0, 24.0, 23.0, 18.0, 12.0, 8.0, 4.0, 5.0, 11.0, 19.0, 28.0, 30.0, 30.0, 25.0, 20.0, 17.0, 13.0, 10.0, 12.0, 16.0, 13.0, 8.0, 9.0, 8.0, 9.0, 6.0, 5.0, 4.0, 6.0, 13.0, 14.0, 17.0, 17.0, 19.0, 14.0, 8.0, 3.0, -7.0, -15.0, -18.0, -13.0, -9.0, -5.0, -2.0, 3.0, 4.0, -1.0, 0.0, -2.0, -5.0, -8.0, -9.0, -11.0, -12.0, -13.0, -17.0, -21.0, -23.0, -21.0, -19.0, -18.0, -18.0, -16.0, -11.0, -8.0, -5.0, -4.0, -7.0, -10.0, -15.0, -19.0, -19.0, -18.0, -17.0, -20.0, -20.0, -20.0, -21.0, -21.0, -19.0, -15.0, -9.0, -8.0, -7.0, -7.0, -9.0, -10.0, -10.0, -11.0, -10.0, -12.0, -17.0, -18.0, -19.0, -21.0, -25.0, -25.0, -22.0, -19.0, -16.0, -15.0, -15.0, -14.0, -11.0, -8.0, -5.0, -4.0, -1.0, -3.0, -6.0, -4.0, -5.0, -10.0, -8.0, -7.0, -9.0, -13.0, -14.0, -10.0, -6.0, -3.0, -1.0, 0.0, 2.0, 1.0, -6.0, -6.0, 0.0, 10.0, 19.0, 23.0, 23.0, 22.0, 22.0, 20.0, 19.0, 21.0, 21.0, 21.0, 20.0, 23.0, 24.0, 25.0, 29.0, 31.0, 35.0, 33.0, 32.0, 30.0, 31.0, 33.0, 34.0, 33.0, 31.0, 28.0, 26.0, 26.0, 27.0, 30.0, 34.0, 35.0, 27.0, 14.0, 8.0, 0.0, 1.0, 10.0, 16.0, 27.0, 39.0, 47.0, 54.0, 58.0, 57.0, 53.0, 50.0, 40.0, 30.0, 21.0, 16.0, 14.0, 11.0, 5.0, 1.0, -2.0, 0.0, 6.0, 11.0, 17.0, 25.0, 35.0, 39.0, 38.0, 33.0, 26.0, 10.0, 1.0, -3.0, -8.0, -10.0, -12.0, -14.0, -12.0, -7.0, -3.0, 3.0, 7.0, 12.0, 15.0, 17.0, 20.0, 15.0, 10.0, 4.0, 0.0, -4.0, -10.0, -17.0, -20.0, -22.0, -21.0, -21.0, -16.0, -7.0, 3.0, 11.0, 19.0, 23.0, 24.0, 23.0, 15.0, 9.0, 4.0, -2.0, -4.0, -8.0, -11.0, -12.0, -10.0, -5.0, -4.0, -2.0, 5.0, 17.0, 22.0, 23.0, 21.0, 17.0, 13.0, 8.0, 6.0, 6.0, 4.0, 1.0, 1.0, 7.0, 4.0, 1.0, -4.0, -9.0, -9.0, -11.0, -10.0, -8.0, -6.0, 1.0, 6.0, 11.0, 13.0, 18.0, 20.0, 19.0, 17.0, 16.0, 18.0, 18.0, 18.0, 18.0, 14.0, 10.0, 12.0, 13.0, 15.0, 15.0, 16.0, 15.0, 14.0, 14.0, 9.0, 9.0, 12.0, 18.0, 18.0, 19.0, 16.0, 13.0, 12.0, 13.0, 13.0, 15.0, 19.0, 21.0, 22.0, 25.0, 18.0, 10.0, 10.0, 11.0, 10.0, 13.0, 13.0, 12.0, 18.0, 19.0, 18.0, 15.0, 10.0, 6.0, 3.0, -2.0, -9.0, -12.0, },
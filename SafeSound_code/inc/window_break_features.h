@@ -0,0 +1,85 @@
+// Generated by tools/generate_prerecorded_features.py from window_break.h, do not edit.
+#pragma once
+
+#include "log_mel.h"
+
+// Log-mel features of each row of sample_wav_data at AUDIO_SAMPLE_RATE
+#if AUDIO_SAMPLE_RATE == 16000 && LOG_MEL_FFT_SIZE == 512 && LOG_MEL_FILTERS == 80
+static const float sample_wav_features[35][LOG_MEL_FILTERS] = {
+	{ 0.0178751722f, 0.0221893229f, 0.0f, 0.123447679f, 0.0689212009f, 0.00815275591f, 0.036648009f, 0.0234274585f, 0.0344200954f, 0.0218760427f, 0.00574764982f, 0.00524783088f, 0.0175137538f, 0.00775509467f, 0.00142015936f, 0.015967397f, 0.018757144f, 0.0182828736f, 0.0120067364f, 0.00459616538f, 0.0113411015f, 0.0129969865f, 0.0197774209f, 0.0317056999f, 0.0226429179f, 0.0222461391f, 0.0584451184f, 0.0282081012f, 0.0299082324f, 0.026401842f, 0.0307019409f, 0.0210413616f, 0.0100297462f, 0.0124817379f, 0.0165718142f, 0.0157654397f, 0.0249706171f, 0.0182777569f, 0.0150012923f, 0.0163025521f, 0.018593099f, 0.0241259299f, 0.0152447969f, 0.00952445995f, 0.00914252829f, 0.00773042068f, 0.00799829792f, 0.00833948795f, 0.0102202697f, 0.00945564825f, 0.00813911855f, 0.00963606965f, 0.00900775846f, 0.00900404993f, 0.00709617743f, 0.0092865238f, 0.00764318835f, 0.00791146606f, 0.00669479603f, 0.00682228059f, 0.00915909745f, 0.00662479782f, 0.00653089909f, 0.00844027102f, 0.00769550772f, 0.00616981601f, 0.00606207177f, 0.00628126645f, 0.00633720448f, 0.00611949759f, 0.00568181789f, 0.00701885438f, 0.00783389062f, 0.00767656928f, 0.00713385269f, 0.00720339455f, 0.00860108994f, 0.00506433332f, 0.00675476762f, 0.00643287878f },
+	{ 0.015323882f, 0.0710953027f, 0.0f, 0.118706778f, 0.0316344276f, 0.0633271709f, 0.0157640781f, 0.0139299277f, 0.00834814832f, 0.0707141086f, 0.0134022841f, 0.0401946008f, 0.00592729216f, 0.0181403514f, 0.0167636573f, 0.0138693471f, 0.0111239199f, 0.0183022078f, 0.022280369f, 0.0228302926f, 0.0253951326f, 0.0132892961f, 0.00872878358f, 0.0151815722f, 0.0227226354f, 0.0449854173f, 0.0335257612f, 0.059246622f, 0.0368507728f, 0.026638817f, 0.0257979073f, 0.0145106101f, 0.0272336304f, 0.0189532395f, 0.0114536723f, 0.0228738748f, 0.028538458f, 0.0134463394f, 0.00940008927f, 0.00983212236f, 0.00898817554f, 0.017160695f, 0.00815149862f, 0.00953651685f, 0.0111216372f, 0.0134184845f, 0.00866983738f, 0.00793733168f, 0.00722538354f, 0.00583110284f, 0.00784279127f, 0.00845258962f, 0.00797235314f, 0.00884868205f, 0.00751695037f, 0.00770708313f, 0.00757624302f, 0.0096635716f, 0.00869409833f, 0.00407109968f, 0.00764209265f, 0.00561195193f, 0.00660678791f, 0.00785218179f, 0.00725223962f, 0.00683462573f, 0.00722247502f, 0.00761181489f, 0.00700109638f, 0.00522196339f, 0.00840887334f, 0.0078970287f, 0.00666787289f, 0.00844533555f, 0.00825768337f, 0.00759404153f, 0.00609122496f, 0.00595592381f, 0.00677646743f, 0.00483576488f },
+	{ 0.125888124f, 0.0174102671f, 0.0f, 0.0790064037f, 0.105847828f, 0.0354328156f, 0.0160705894f, 0.0194049943f, 0.00250995089f, 0.0109542664f, 0.00757242134f, 0.0228613932f, 0.00354279112f, 0.00631091883f, 0.00643986464f, 0.0150461653f, 0.0256624818f, 0.0245954134f, 0.0121187549f, 0.0038819646f, 0.0164700076f, 0.0173317902f, 0.006729885f, 0.0316417627f, 0.0491828434f, 0.0293184277f, 0.0572043732f, 0.0197546668f, 0.0305482596f, 0.016953662f, 0.0224687662f, 0.0140077583f, 0.0124273496f, 0.0141362865f, 0.0131110018f, 0.0226786025f, 0.0194407087f, 0.0140298204f, 0.0185186639f, 0.00719503919f, 0.00522106094f, 0.00636523589f, 0.0077852672f, 0.0132483589f, 0.0107761519f, 0.00936566293f, 0.00932161417f, 0.0058143069f, 0.00722055649f, 0.00530680874f, 0.00590530084f, 0.00722147478f, 0.00418154476f, 0.00881051831f, 0.0093706781f, 0.0043166331f, 0.0040045632f, 0.00613886258f, 0.00627718261f, 0.00492007611f, 0.00539994705f, 0.00336182746f, 0.00536813634f, 0.00385111803f, 0.0053708558f, 0.00425904756f, 0.00596443703f, 0.00623199577f, 0.00433385652f, 0.00475766137f, 0.00407797191f, 0.0071191052f, 0.00716834096f, 0.00732863555f, 0.00576870888f, 0.00575875863f, 0.00537550915f, 0.00423931144f, 0.00396402273f, 0.00497856829f },
+	{ 0.0453721732f, 0.0273885094f, 0.0f, 0.0802880749f, 0.0653706267f, 0.110441305f, 0.0152922943f, 0.0376256295f, 0.0161868166f, 0.0142882559f, 0.00756801944f, 0.00690142578f, 0.00555198966f, 0.00801456627f, 0.0103143267f, 0.0214415062f, 0.0205333419f, 0.0161370207f, 0.0111232642f, 0.0102044446f, 0.0118211256f, 0.0192056093f, 0.00914069917f, 0.0220255833f, 0.0468725562f, 0.0384098701f, 0.0325942375f, 0.0250447337f, 0.0261324439f, 0.0192043483f, 0.0147212651f, 0.00639966968f, 0.00965826865f, 0.0200005919f, 0.0131689655f, 0.0156317428f, 0.0121347541f, 0.0108025661f, 0.011950626f, 0.0107531985f, 0.00869444292f, 0.00614761887f, 0.00594702922f, 0.00757497502f, 0.00708034961f, 0.00954858121f, 0.00669327471f, 0.00650188467f, 0.00474654138f, 0.00490257423f, 0.00640190206f, 0.00536463922f, 0.00451396685f, 0.00547121931f, 0.00395367481f, 0.0034561865f, 0.00296419812f, 0.00500496477f, 0.00404089922f, 0.00474913372f, 0.00465050945f, 0.00294664223f, 0.00361913f, 0.00444158679f, 0.00565123884f, 0.00465389481f, 0.00469959062f, 0.00375475269f, 0.00321648107f, 0.00448884629f, 0.00446142722f, 0.00344039034f, 0.00340501545f, 0.00352372718f, 0.00361312227f, 0.00456166966f, 0.00416309666f, 0.00344580226f, 0.00270314026f, 0.00276792352f },
+	{ 0.132752895f, 0.0271373875f, 0.0f, 0.122552916f, 0.0826501325f, 0.042214226f, 0.0414658152f, 0.0215879027f, 0.0274813883f, 0.0160409361f, 0.00187357294f, 0.0106699253f, 0.00664413208f, 0.0150901638f, 0.00956517551f, 0.0322198346f, 0.0117004793f, 0.0169910248f, 0.0240533315f, 0.00407639286f, 0.00959285907f, 0.0125473663f, 0.00485838298f, 0.0267105196f, 0.0295073967f, 0.0566766076f, 0.0493962243f, 0.0494733043f, 0.0259698741f, 0.0193258636f, 0.0305911265f, 0.0227196012f, 0.0173579175f, 0.0134761538f, 0.0115481792f, 0.0184103306f, 0.018483026f, 0.0166595578f, 0.00888615567f, 0.00498017715f, 0.00474394858f, 0.011550528f, 0.00571717042f, 0.00806859136f, 0.00969479419f, 0.0147183007f, 0.00628286274f, 0.00380254956f, 0.00661797123f, 0.0092939632f, 0.00731288036f, 0.0048480588f, 0.00428753998f, 0.005488961f, 0.00594443828f, 0.00721699046f, 0.00486231688f, 0.00612708647f, 0.00485972082f, 0.00504449382f, 0.00570964534f, 0.00552153634f, 0.00559165794f, 0.00633340422f, 0.00605959352f, 0.00496392604f, 0.00454497943f, 0.00569236744f, 0.00473450171f, 0.00707110437f, 0.00557944551f, 0.00633137021f, 0.00654831203f, 0.00694597187f, 0.00655630417f, 0.00672112172f, 0.00700640259f, 0.00578766456f, 0.00571452407f, 0.00527840247f },
+	{ 0.173185706f, 0.0550247319f, 0.0f, 0.119949378f, 0.151782051f, 0.0970301107f, 0.0302842148f, 0.0446908437f, 0.0172619373f, 0.0140010072f, 0.00410710182f, 0.00422405265f, 0.0129987244f, 0.00321601774f, 0.000449456187f, 0.0150175421f, 0.00941633619f, 0.0207356792f, 0.0146598388f, 0.00965075474f, 0.0263141114f, 0.0132486001f, 0.00502456399f, 0.02528622f, 0.0204658676f, 0.0382548645f, 0.0366453938f, 0.0228100456f, 0.0316354409f, 0.0279597528f, 0.0305150039f, 0.00937025342f, 0.015885124f, 0.013946522f, 0.0098093031f, 0.022024855f, 0.0138075193f, 0.0155193135f, 0.0150756761f, 0.0100864321f, 0.00790708419f, 0.0162058864f, 0.0123573523f, 0.0125571089f, 0.0128720887f, 0.0047126743f, 0.00961850584f, 0.00853484124f, 0.00589033915f, 0.00789140724f, 0.00582446111f, 0.00408735732f, 0.00481725391f, 0.00494436733f, 0.0055774725f, 0.00641231239f, 0.00714060012f, 0.0101674963f, 0.00792632438f, 0.0083707599f, 0.00613769749f, 0.00491207605f, 0.00498524122f, 0.00508070318f, 0.00788164418f, 0.00675452966f, 0.00693684444f, 0.00666441489f, 0.00626162533f, 0.00667986367f, 0.00838142354f, 0.0102663739f, 0.00885285158f, 0.00666747661f, 0.00863060262f, 0.00601543626f, 0.00638331333f, 0.00577515829f, 0.00581802428f, 0.00480034202f },
+	{ 0.0958981663f, 0.114071272f, 0.0f, 0.0890336409f, 0.0367142148f, 0.135370493f, 0.0151632931f, 0.0482850857f, 0.0164282769f, 0.0131379366f, 0.0181087591f, 0.0162119959f, 0.0227791388f, 0.0153572774f, 0.0176052377f, 0.0213233195f, 0.0114387516f, 0.0248981509f, 0.0228054393f, 0.00809638109f, 0.0348607264f, 0.0315325744f, 0.00426822156f, 0.0370492414f, 0.0433436185f, 0.018741427f, 0.0579890907f, 0.0379396416f, 0.0270990729f, 0.0263325777f, 0.0252109803f, 0.0285663623f, 0.0136899874f, 0.0333678536f, 0.0168217942f, 0.017606819f, 0.0493097901f, 0.039309185f, 0.028148476f, 0.0266586766f, 0.0524806641f, 0.0331788324f, 0.0174021199f, 0.0151045285f, 0.0168401282f, 0.0243694428f, 0.036579717f, 0.013944746f, 0.0174517203f, 0.0137884859f, 0.0131417345f, 0.0208944697f, 0.0177069139f, 0.0339701995f, 0.0401695222f, 0.0233743563f, 0.0334489346f, 0.052512221f, 0.0478569493f, 0.0391693451f, 0.0397537909f, 0.035860382f, 0.0239815451f, 0.0338184685f, 0.0510499217f, 0.0384752154f, 0.0292685702f, 0.0308518633f, 0.0347102284f, 0.034187872f, 0.0400064327f, 0.0505179688f, 0.085257493f, 0.0531716496f, 0.0501952283f, 0.045955658f, 0.0514899269f, 0.0345404968f, 0.0275175553f, 0.0211112481f },
+	{ 0.121438459f, 0.0772506073f, 0.0f, 0.135198638f, 0.0759654194f, 0.15036951f, 0.0715453103f, 0.0320740119f, 0.0438052006f, 0.0102098687f, 0.0239416379f, 0.0471879281f, 0.0286617819f, 0.00599217322f, 0.0378687419f, 0.00483558001f, 0.0155002167f, 0.0444438644f, 0.0228133872f, 0.0257777479f, 0.0255179666f, 0.032324288f, 0.0147146164f, 0.0119910482f, 0.0151949674f, 0.030581763f, 0.0351809412f, 0.0249653794f, 0.0202464443f, 0.0283066556f, 0.028546568f, 0.0202926956f, 0.0292509887f, 0.0159610938f, 0.00867102016f, 0.0162278414f, 0.015001134f, 0.040717233f, 0.0339746587f, 0.0150728561f, 0.015190539f, 0.0228447504f, 0.0165132936f, 0.0186404344f, 0.0227444451f, 0.0236008633f, 0.0216729138f, 0.00878363196f, 0.0138010457f, 0.0204616226f, 0.0186289791f, 0.0180732962f, 0.0173929669f, 0.0201329961f, 0.015877381f, 0.0111041293f, 0.0185445976f, 0.0283160545f, 0.0207806844f, 0.0185831655f, 0.0204476956f, 0.0304784682f, 0.0162270032f, 0.0231871698f, 0.0244992748f, 0.0246145613f, 0.0198670421f, 0.0160683412f, 0.0165964104f, 0.0155499829f, 0.0316566192f, 0.032929074f, 0.0254149809f, 0.0277563781f, 0.0336310975f, 0.0188512523f, 0.0229388084f, 0.025598377f, 0.0172505043f, 0.012180428f },
+	{ 0.206452295f, 0.0441806689f, 0.0f, 0.0376001f, 0.199419662f, 0.131077662f, 0.0940863565f, 0.0298123099f, 0.0333748795f, 0.0155989388f, 0.0160506237f, 0.0173689686f, 0.0108163971f, 0.0174303874f, 0.0125495289f, 0.0208594892f, 0.0127910478f, 0.0229071546f, 0.0236302149f, 0.00793631002f, 0.0139419362f, 0.0357098728f, 0.0235739145f, 0.0282579996f, 0.02193515f, 0.0286746789f, 0.0312570482f, 0.029369358f, 0.0301149637f, 0.0243517067f, 0.0173304286f, 0.0152585013f, 0.0183216166f, 0.0164994337f, 0.00903005619f, 0.0208266973f, 0.0155978296f, 0.0234640371f, 0.0145321097f, 0.0190869328f, 0.0104505336f, 0.0192709416f, 0.0131155457f, 0.0215735938f, 0.0117493439f, 0.0195298474f, 0.0105447536f, 0.00823933166f, 0.00375244138f, 0.0120233689f, 0.0178539697f, 0.0135416323f, 0.0128045846f, 0.0141381733f, 0.0144181885f, 0.0114010582f, 0.0107257431f, 0.0168411639f, 0.0147116529f, 0.012788496f, 0.0161003731f, 0.00837692246f, 0.0103838975f, 0.0159449745f, 0.0159545019f, 0.0124692693f, 0.0152878268f, 0.0123540927f, 0.015520989f, 0.0151820527f, 0.0166976638f, 0.0117076645f, 0.0115925092f, 0.012376396f, 0.0140283685f, 0.0150150629f, 0.0186864622f, 0.0151514374f, 0.0135393674f, 0.013562521f },
+	{ 2.54211473f, 4.03496456f, 0.0f, 4.08907795f, 3.12997174f, 3.52876234f, 2.05579948f, 2.34704518f, 2.43871045f, 2.71508384f, 2.45754051f, 2.79194164f, 1.77442288f, 2.10059214f, 1.70984149f, 1.81102586f, 2.22131014f, 2.68172812f, 2.53981352f, 1.21201611f, 1.67966568f, 2.07554102f, 2.00714517f, 2.00697017f, 1.37953484f, 1.19225681f, 1.75674033f, 1.13952219f, 1.20443428f, 1.58817589f, 1.69679832f, 1.4902637f, 1.3204751f, 1.09700656f, 1.1773448f, 1.60411668f, 1.67408788f, 1.89589036f, 1.83869183f, 1.50089467f, 1.48166144f, 1.50250816f, 1.35486376f, 1.26798022f, 1.73962522f, 1.59688854f, 1.95892704f, 1.430112f, 1.53855979f, 1.25181496f, 1.50208569f, 1.69665563f, 1.73651409f, 1.59298277f, 1.83618438f, 1.82729816f, 1.61453724f, 1.56275988f, 1.70752454f, 1.77185321f, 2.05810952f, 1.98927891f, 1.43600059f, 1.78433931f, 1.96170473f, 1.80306983f, 2.12977934f, 1.98422301f, 1.72136748f, 1.7753768f, 2.06286716f, 2.24294066f, 1.93249547f, 1.88349581f, 1.7427578f, 2.09203243f, 2.27844286f, 2.44446087f, 2.25940037f, 1.72449732f },
+	{ 3.72974515f, 3.1774931f, 0.0f, 4.3243165f, 2.76821685f, 3.61632013f, 2.31865954f, 2.40702772f, 1.65520477f, 2.59416699f, 2.73922658f, 1.89409328f, 1.3940202f, 2.02851963f, 2.10314131f, 1.4121294f, 1.5753696f, 1.83694816f, 1.86465919f, 1.98307693f, 1.99190068f, 1.95576978f, 1.2332443f, 1.86265814f, 2.037467f, 1.89699233f, 2.16962028f, 2.02692676f, 1.88832426f, 2.05357003f, 2.09469581f, 1.76145589f, 1.89320612f, 1.96458042f, 1.86159241f, 2.02238727f, 2.01336145f, 2.15544987f, 1.62989318f, 1.37954342f, 1.92806947f, 2.20224643f, 1.48819005f, 1.30372071f, 1.80696297f, 1.88246036f, 1.86225677f, 1.75128961f, 1.7609905f, 1.73461771f, 1.57297325f, 1.7596612f, 1.5531857f, 1.57151878f, 1.69540823f, 1.65903962f, 2.03494716f, 2.02321672f, 2.17703247f, 2.07773185f, 2.18479943f, 2.06039739f, 2.22570992f, 2.24360418f, 2.07474732f, 1.97503173f, 1.99365997f, 2.31613326f, 2.27324557f, 2.23286533f, 2.58030963f, 2.54818821f, 1.90323699f, 2.27043962f, 2.41881752f, 2.31090403f, 2.30013514f, 2.18176031f, 1.58522475f, 1.5488776f },
+	{ 3.37547779f, 2.88158298f, 0.0f, 2.97860646f, 2.36476564f, 1.43550849f, 2.42050338f, 1.13935387f, 1.89908707f, 1.97758257f, 0.978724062f, 1.08878374f, 1.98914647f, 1.63843095f, 1.20227981f, 0.570612431f, 0.522907853f, 1.9489603f, 1.99439263f, 2.17444348f, 2.33287334f, 1.66429079f, 1.19766605f, 1.34901774f, 1.17921937f, 1.61180639f, 1.45389593f, 1.24721289f, 1.34197521f, 2.1357553f, 1.78334212f, 1.64820218f, 1.41916788f, 1.68478572f, 1.86102414f, 2.04204893f, 1.76174819f, 1.72282875f, 1.70016253f, 1.28841329f, 1.2418164f, 1.07595038f, 1.42888665f, 1.6242317f, 1.58333945f, 1.4696455f, 1.67114604f, 1.96281064f, 1.98807502f, 2.24334145f, 1.89611232f, 1.83632243f, 1.86406207f, 1.56052899f, 1.5870074f, 1.72787762f, 1.94475615f, 1.73295605f, 1.73778462f, 1.49493253f, 1.76648855f, 2.01047301f, 2.07827592f, 2.14280534f, 1.79081142f, 1.95100725f, 2.25075841f, 2.0384202f, 2.17917752f, 2.72166252f, 2.15323448f, 2.0617249f, 2.47138786f, 2.94727159f, 2.66290045f, 1.96326816f, 2.23052955f, 2.28355312f, 1.96946263f, 2.14579105f },
+	{ 1.57197106f, 2.01159358f, 0.0f, 2.24970865f, 1.50851274f, 1.57139063f, 1.07578146f, 2.07747674f, 0.573405623f, 0.680653393f, 0.687129319f, 1.28315783f, 1.0113337f, 0.666926146f, 0.858870625f, 0.658143461f, 0.818024814f, 1.43179739f, 1.49733961f, 0.418825656f, 0.855033696f, 1.14842546f, 0.835931063f, 0.848866105f, 1.30577981f, 1.39234281f, 1.53668928f, 1.07892728f, 0.879720092f, 1.32410741f, 0.925873458f, 1.14323568f, 1.22141802f, 1.29679585f, 1.05332768f, 0.985537767f, 0.805135965f, 1.01742768f, 1.22609675f, 1.05112135f, 1.05875766f, 1.3252449f, 1.28793526f, 1.72043824f, 1.88646042f, 1.54365492f, 1.38699377f, 1.83511889f, 1.39494622f, 0.992423892f, 1.42161441f, 2.23860955f, 2.3849771f, 1.50736582f, 1.23267472f, 0.973846495f, 1.91832912f, 1.64263284f, 1.29152238f, 1.50688303f, 1.30879343f, 1.42514396f, 1.31820714f, 2.10707903f, 1.62805271f, 1.71691108f, 2.18010521f, 1.79915655f, 1.64356494f, 2.53420305f, 2.48074985f, 1.93023682f, 2.07859659f, 2.15825653f, 1.97822893f, 2.27487779f, 1.92414069f, 2.31101704f, 3.0001235f, 1.90570831f },
+	{ 2.43181491f, 0.921230555f, 0.0f, 2.03279829f, 1.90654683f, 2.2613008f, 1.72550619f, 1.89922261f, 1.87924266f, 1.57338071f, 1.20321202f, 1.48193169f, 1.03212464f, 0.809340656f, 0.409481436f, 0.677319109f, 0.824307621f, 0.99211067f, 0.444474101f, 0.46900171f, 0.584769726f, 0.479215384f, 0.720413804f, 0.365331233f, 0.36969763f, 0.79202342f, 0.595430672f, 0.422505856f, 0.467484474f, 0.795902729f, 0.59640348f, 0.566470027f, 0.585960925f, 0.53043282f, 0.775999188f, 0.699228823f, 0.753659427f, 1.12876046f, 0.721845925f, 0.496160716f, 0.617195666f, 1.04939604f, 0.820400715f, 1.59831738f, 1.42149889f, 0.854290366f, 0.98130399f, 2.09000158f, 1.62051904f, 1.23285711f, 1.52253771f, 1.78539491f, 1.77884889f, 0.984664261f, 1.16984606f, 1.33520651f, 1.75425267f, 1.50918067f, 1.46893334f, 1.40446031f, 0.947647691f, 1.05688453f, 1.28772128f, 2.34579158f, 1.55630374f, 2.20953751f, 2.26420546f, 1.33118236f, 1.76661897f, 2.63567996f, 3.09277797f, 1.64354718f, 1.75024867f, 1.84962606f, 2.15083361f, 1.32720292f, 1.52617633f, 1.90431213f, 2.74701715f, 1.92878747f },
+	{ 2.35413837f, 0.397946417f, 0.0f, 2.71881127f, 2.27250934f, 2.50039768f, 1.76902914f, 0.503512025f, 2.05225348f, 1.44418347f, 1.32188427f, 1.46310151f, 0.406687081f, 1.1252625f, 0.445446759f, 0.415734082f, 0.22454676f, 0.510214925f, 0.594355047f, 0.944782913f, 1.43996489f, 1.03147352f, 0.480266571f, 0.555711687f, 0.509399891f, 0.630882204f, 0.726665378f, 0.969399989f, 0.5562675f, 0.571056724f, 0.554052114f, 0.596895695f, 0.358424306f, 0.824482322f, 0.481873095f, 0.467760801f, 0.60349828f, 0.842499316f, 0.76112771f, 0.679846585f, 0.905522346f, 1.37831581f, 0.698653817f, 1.20883501f, 1.33850467f, 0.572334707f, 1.29554856f, 2.67206597f, 2.10917354f, 1.50857627f, 1.56450713f, 1.45082712f, 1.45255339f, 0.887451947f, 1.0718745f, 1.20191467f, 1.26086676f, 1.07051551f, 1.31549287f, 1.19500554f, 1.13988674f, 0.826919675f, 0.980925202f, 1.56308913f, 1.42365849f, 2.34647679f, 2.01016974f, 1.1331172f, 1.28290582f, 2.40178823f, 2.37114286f, 1.47773397f, 1.89992392f, 1.95504057f, 1.77014065f, 1.47601473f, 1.4195255f, 1.78969061f, 1.74954116f, 1.75371063f },
+	{ 2.07267046f, 1.27709389f, 0.0f, 1.67132425f, 1.16868865f, 1.61549509f, 0.673443317f, 1.28730369f, 1.31927812f, 1.37520075f, 1.41335106f, 1.23111761f, 0.805639803f, 0.583535373f, 0.405167401f, 0.0342767946f, 0.523666024f, 0.331409484f, 0.291193813f, 0.693152189f, 0.916226864f, 0.817658067f, 0.422062904f, 0.299015164f, 0.307973295f, 0.356389284f, 0.694314301f, 0.77798301f, 0.44667235f, 0.417475283f, 0.461265206f, 0.374915302f, 0.365710109f, 0.351665407f, 0.250722051f, 0.166382819f, 0.255802184f, 0.762570977f, 0.567336917f, 0.622389853f, 0.470447361f, 0.887170374f, 0.703281343f, 0.850618362f, 1.19527841f, 0.829004645f, 1.23691273f, 2.19590998f, 1.66727865f, 1.23914039f, 0.894673705f, 1.31353664f, 1.49766147f, 1.18276751f, 0.970100701f, 0.996921897f, 1.00424385f, 2.06273079f, 1.92297506f, 1.31444275f, 0.914499402f, 1.15888309f, 0.885343909f, 1.45786345f, 1.33265495f, 1.67514563f, 2.07059503f, 1.82770717f, 1.39627528f, 2.54170346f, 2.32697582f, 1.67603493f, 2.03514838f, 1.80027974f, 1.84004474f, 2.05184078f, 2.17985916f, 1.94361985f, 1.90194571f, 1.40198421f },
+	{ 2.33923435f, 0.492486238f, 0.0f, 1.17498314f, 0.801493764f, 0.993959844f, 0.570499539f, 0.283209056f, 0.400073141f, 0.671114087f, 0.42056784f, 0.419056445f, 0.338405192f, 0.349589288f, 0.205425486f, 0.064315185f, 0.157166824f, 0.409451634f, 0.209889054f, 0.190318167f, 0.30417642f, 0.347725779f, 0.271606475f, 0.146713912f, 0.240138695f, 0.651983857f, 0.555392623f, 0.346736014f, 0.483963132f, 0.544318855f, 0.426591277f, 0.626614273f, 0.639891982f, 0.416934699f, 0.465516746f, 0.618147135f, 0.35959515f, 0.594034135f, 0.666748643f, 0.598353505f, 0.812292218f, 1.21582329f, 0.579315245f, 0.929478824f, 1.62246799f, 0.854677498f, 1.04344904f, 1.51958001f, 1.10524511f, 1.19806886f, 0.984800994f, 1.21891022f, 1.08616614f, 1.04675221f, 1.06247056f, 1.00625622f, 1.06091642f, 2.00325727f, 1.57614803f, 1.10528421f, 0.830944002f, 1.39541578f, 1.22033381f, 1.52181971f, 1.48040354f, 1.66730547f, 2.1316669f, 2.18281841f, 1.94132113f, 2.45246911f, 2.03202796f, 2.28325582f, 2.01829696f, 1.71722353f, 1.8539319f, 1.80998898f, 2.0184536f, 1.7487303f, 1.45411599f, 1.54111242f },
+	{ 2.63855577f, 0.649163842f, 0.0f, 2.16481781f, 1.5901953f, 1.45884216f, 0.918527365f, 0.768520415f, 0.658198059f, 0.500411868f, 0.567037344f, 0.30022642f, 0.287763119f, 0.2324747f, 0.0789184645f, 0.273400187f, 0.184943631f, 0.233532369f, 0.235707492f, 0.122859269f, 0.427746892f, 0.486960828f, 0.332630366f, 0.228219211f, 0.297809094f, 0.302062571f, 0.396242738f, 0.489534616f, 0.0360063091f, 0.341508627f, 0.440679044f, 0.243160993f, 0.211128563f, 0.500737607f, 0.510660529f, 0.278993815f, 0.465789855f, 0.690124393f, 0.482244939f, 0.626970887f, 0.635410249f, 0.802827895f, 0.60869956f, 1.49209964f, 1.69379556f, 0.734035611f, 0.534858406f, 1.20414805f, 1.08259928f, 0.972719491f, 0.926347792f, 0.739510298f, 0.756097257f, 0.835667908f, 1.02203476f, 1.35030866f, 0.916896701f, 1.98564482f, 1.703197f, 1.10691619f, 0.933183968f, 1.02240944f, 1.27887392f, 1.48148942f, 1.75641048f, 2.01984406f, 2.42780375f, 2.15615487f, 2.24276829f, 2.72135401f, 2.21229219f, 2.03624249f, 2.11731672f, 2.11403656f, 2.01866627f, 1.21462178f, 1.69587827f, 1.67849267f, 1.68223679f, 1.33625364f },
+	{ 2.29213643f, 0.542671263f, 0.0f, 0.553603351f, 0.975147665f, 0.777384698f, 0.453115165f, 0.450675845f, 0.434383333f, 0.399170399f, 0.1062259f, 0.311411411f, 0.274849802f, 0.233313948f, 0.274824679f, 0.180595219f, 0.0730413869f, 0.194785237f, 0.359879792f, 0.205900401f, 0.204067737f, 0.270758837f, 0.130313441f, 0.402727395f, 0.32971707f, 0.175564483f, 0.417695254f, 0.419603348f, 0.281422377f, 0.355658054f, 0.14964211f, 0.203185871f, 0.393281221f, 0.258386195f, 0.299741507f, 0.451113343f, 0.515122533f, 1.06321228f, 0.836652339f, 0.539047956f, 0.363668323f, 0.578553557f, 0.444271773f, 1.12143302f, 1.2038703f, 0.595466495f, 0.562221229f, 1.39479113f, 0.906954587f, 0.539751351f, 0.620796859f, 0.835860074f, 0.963855267f, 0.759470284f, 0.855830073f, 1.62125492f, 0.993664563f, 1.81152487f, 1.37701154f, 0.765440643f, 0.781074822f, 1.28055274f, 0.964015722f, 1.66730475f, 1.0104847f, 1.29859364f, 1.43131328f, 1.21959293f, 1.70692039f, 2.1803565f, 1.23588669f, 1.80178225f, 1.15398228f, 1.34984529f, 1.66352248f, 1.43170941f, 1.84782195f, 1.82158446f, 1.27890909f, 1.32009006f },
+	{ 1.97231793f, 0.769481242f, 0.0f, 0.22893092f, 0.533890545f, 0.312613159f, 0.668442547f, 0.0832511932f, 0.235858649f, 0.374341667f, 0.383664608f, 0.394127756f, 0.395021856f, 0.427811354f, 0.299602926f, 0.367817938f, 0.244567484f, 0.302118242f, 0.342312157f, 0.279767334f, 0.451944679f, 0.613455474f, 0.324754834f, 0.562693655f, 0.934822083f, 1.07510614f, 0.869418085f, 0.461918533f, 0.392209798f, 0.631096005f, 0.409257948f, 0.905391812f, 0.946251452f, 1.02980673f, 0.955631733f, 0.85625881f, 0.765802741f, 1.13574946f, 0.730826259f, 0.468927473f, 1.10583889f, 1.35784686f, 0.885413349f, 1.49760115f, 1.92785132f, 1.39341426f, 0.850493133f, 1.28579903f, 1.26152086f, 1.18083394f, 1.05114245f, 0.901598752f, 0.8545506f, 1.06205916f, 1.16011572f, 1.38211977f, 0.809924841f, 1.61914837f, 1.46069646f, 1.02342343f, 1.45903218f, 1.55309379f, 1.2002815f, 1.89615047f, 1.64211512f, 1.42848313f, 1.56063342f, 1.62692308f, 1.60176992f, 1.95093894f, 1.43665707f, 1.56505859f, 2.22039199f, 1.87259269f, 1.73351657f, 1.73831952f, 1.74492931f, 1.70742154f, 1.52582967f, 1.33585179f },
+	{ 2.83979607f, 0.584736168f, 0.0f, 2.14031363f, 1.46025705f, 1.3450222f, 1.2461257f, 1.16575861f, 1.3561219f, 1.1968987f, 0.755102575f, 1.35573471f, 1.47706926f, 1.56969118f, 1.33488977f, 1.74555933f, 1.42333055f, 1.88071907f, 1.32805455f, 0.849895239f, 0.837592721f, 1.2398026f, 1.56775141f, 1.4435811f, 1.3751874f, 1.49962199f, 2.27356005f, 2.5550909f, 2.63505507f, 2.72069073f, 2.25247717f, 1.99092793f, 1.66399133f, 2.26662421f, 2.47144604f, 2.80637383f, 2.81143427f, 2.70513344f, 2.49637794f, 1.80916309f, 1.86093283f, 2.1653583f, 2.29204607f, 2.01941538f, 2.104774f, 2.12226462f, 2.24350023f, 2.12216759f, 2.28226924f, 2.10456276f, 2.23711348f, 2.06244397f, 1.83528686f, 1.9713583f, 1.48413241f, 1.25528944f, 1.30135942f, 1.85941446f, 1.76769543f, 1.7889086f, 1.72053552f, 1.90055513f, 1.80427504f, 1.96597552f, 1.88152492f, 1.74354875f, 1.62629795f, 1.54166925f, 1.87231505f, 1.95951664f, 1.90007055f, 2.29918146f, 2.37416935f, 2.06593871f, 2.46942997f, 2.3067801f, 1.9517132f, 2.02609229f, 1.73900092f, 1.93612635f },
+	{ 2.5708406f, 2.34261084f, 0.0f, 2.79890847f, 1.95188665f, 0.684035599f, 0.706445873f, 1.22086966f, 1.28173864f, 0.943139255f, 1.3699249f, 0.388636321f, 0.560436845f, 1.36401844f, 0.631382108f, 1.01626015f, 1.02418637f, 0.74454385f, 0.94991374f, 0.976837277f, 0.620561421f, 0.759970427f, 1.33786786f, 0.974720001f, 0.646514952f, 1.14271867f, 1.46926045f, 1.60910165f, 1.50889933f, 1.41432869f, 1.2549057f, 1.43104315f, 1.20229816f, 1.47977138f, 1.95880973f, 1.78934813f, 1.76912689f, 1.64617085f, 1.78490829f, 1.9084388f, 2.23405862f, 2.06142426f, 2.06802607f, 1.94578254f, 2.29800844f, 1.89511049f, 1.89577472f, 1.5124476f, 1.96364665f, 2.36933589f, 2.26998711f, 2.10518122f, 1.34314418f, 1.47563958f, 1.44839585f, 1.4954474f, 2.50276542f, 2.15269899f, 1.78897345f, 1.67710125f, 1.42226017f, 1.68589628f, 2.21579099f, 2.77285528f, 1.85346568f, 2.58853436f, 2.57575035f, 2.20508623f, 2.5560956f, 2.85564804f, 2.35126925f, 2.28942847f, 2.49719977f, 3.27045321f, 2.63312197f, 3.10742569f, 2.66147113f, 2.02597308f, 2.04876304f, 2.67643332f },
+	{ 1.81479728f, 0.95605129f, 0.0f, 2.68756747f, 2.34508801f, 2.38426828f, 1.46609175f, 1.95545733f, 0.506228089f, 1.87371469f, 1.11209726f, 1.05463743f, 1.41484559f, 1.3743552f, 1.2243073f, 0.852181733f, 0.921756983f, 2.40179992f, 1.76592445f, 1.1381948f, 1.2363317f, 0.776148617f, 1.23556519f, 1.26456845f, 0.839174509f, 0.745552659f, 1.31574821f, 1.79103005f, 1.14682341f, 1.60882306f, 1.52751839f, 0.891050339f, 1.76965451f, 1.72763646f, 1.87173152f, 1.69252527f, 1.74727964f, 1.90939677f, 1.79065514f, 1.58593106f, 1.65611935f, 2.26499939f, 2.44487071f, 2.24619699f, 1.99587131f, 2.17283726f, 2.00279999f, 2.16144848f, 1.92324317f, 2.16188025f, 2.13911176f, 2.12256217f, 2.24379635f, 1.85672617f, 2.14919209f, 1.89234936f, 2.29416704f, 2.2559514f, 1.98876834f, 1.57407117f, 1.68390667f, 2.18152881f, 2.22638345f, 2.93317699f, 2.27412677f, 2.34658003f, 1.92698133f, 1.83453918f, 2.55787039f, 2.92510509f, 3.02729249f, 2.30418968f, 2.19823384f, 2.9692142f, 3.26149607f, 2.53828263f, 2.54343867f, 2.72736406f, 2.32515264f, 2.65639186f },
+	{ 2.21904898f, 1.25750995f, 0.0f, 2.03427887f, 2.06034803f, 1.89077187f, 1.03271782f, 1.42780876f, 0.750398636f, 0.336764842f, 0.516289234f, 0.678360224f, 0.664241433f, 1.03338397f, 0.949248791f, 0.793051839f, 0.949937999f, 1.26139665f, 0.818963826f, 0.437938184f, 0.693705261f, 0.608519793f, 1.0669173f, 0.968915582f, 0.999630272f, 0.670165837f, 1.29086804f, 1.3666563f, 1.01880145f, 1.90903592f, 0.895980597f, 1.89176929f, 1.45740688f, 1.38107121f, 2.21313119f, 2.31081891f, 2.12234521f, 2.74839783f, 2.15609074f, 2.12378359f, 2.32208586f, 2.77921724f, 2.26260662f, 2.37577963f, 1.70672381f, 2.06162453f, 2.28791785f, 2.35416365f, 2.098351f, 2.34815478f, 2.44145751f, 2.26905704f, 1.66045213f, 1.63965476f, 2.28297544f, 2.05502152f, 2.15991879f, 2.15269995f, 1.85642254f, 1.8427422f, 1.80810034f, 1.79810822f, 1.98488295f, 2.30960369f, 2.3067522f, 1.99724627f, 2.27277279f, 1.87664056f, 2.07395673f, 2.56269145f, 2.8409164f, 2.34623647f, 2.65209699f, 2.83181334f, 2.54094839f, 2.53597975f, 2.4457171f, 2.2982924f, 2.51488757f, 2.34882307f },
+	{ 0.880539596f, 1.57578599f, 0.0f, 1.85938525f, 2.16571784f, 1.00639713f, 0.869079649f, 1.2901144f, 1.15995014f, 1.31051338f, 1.31809151f, 1.01567578f, 0.667465091f, 0.644306004f, 0.298117459f, 0.447149277f, 0.577453077f, 0.845985413f, 1.27211905f, 0.119491003f, 0.863310158f, 1.09591675f, 0.340445757f, 1.31758618f, 1.26371801f, 0.438131511f, 0.832804322f, 0.867086887f, 1.08740914f, 1.65347922f, 1.04909337f, 2.06083751f, 2.34989142f, 1.95742023f, 1.97583723f, 1.05012727f, 1.79294562f, 1.71993506f, 2.09300137f, 1.88911343f, 2.00136614f, 1.91184676f, 1.79480362f, 2.34456372f, 2.39037347f, 2.42237043f, 1.74187124f, 2.19989109f, 2.03197885f, 1.95942605f, 1.90000212f, 1.89897978f, 1.60285127f, 1.65579808f, 1.86579013f, 2.02811193f, 2.6143229f, 2.47192383f, 1.84112823f, 1.77721798f, 2.23511672f, 1.85888922f, 1.75104249f, 1.77739227f, 1.81635892f, 1.90458f, 2.34040427f, 2.17376757f, 2.16954255f, 2.16705799f, 2.44596338f, 2.34198785f, 3.34015584f, 2.77753139f, 2.23876286f, 2.45383358f, 2.12156057f, 2.15334582f, 2.1912365f, 2.85736179f },
+	{ 1.03308582f, 0.782924056f, 0.0f, 2.05605078f, 1.83802938f, 1.21652484f, 0.585580945f, 0.4975833f, 0.618485332f, 1.13791621f, 0.412091941f, 0.670862854f, 0.172253966f, 0.788862526f, 0.295627952f, 0.347616494f, 0.812250018f, 1.185305f, 1.06276286f, 0.782100201f, 0.768025815f, 0.866399288f, 1.09223783f, 1.17329443f, 0.593356431f, 0.729348481f, 0.989003539f, 1.48665667f, 1.53317952f, 1.60690916f, 1.60248363f, 1.66005242f, 1.46327806f, 1.74258995f, 1.60406315f, 1.53828788f, 1.77060163f, 1.64395106f, 1.34450853f, 1.62531245f, 1.83733153f, 2.05778003f, 1.74778914f, 2.11628771f, 2.48743105f, 2.181602f, 2.55005765f, 2.34082961f, 1.84584451f, 1.86657226f, 1.93956983f, 2.26026917f, 2.20671082f, 1.83845961f, 1.9226253f, 1.62898839f, 1.67421854f, 1.54968643f, 2.00010252f, 1.79025602f, 1.8496207f, 1.82821167f, 1.60628116f, 1.74065471f, 2.03902984f, 2.03736401f, 2.48954487f, 2.05497694f, 1.73559189f, 2.31533623f, 2.5284822f, 2.39368105f, 2.98633456f, 2.93044758f, 2.18426371f, 2.36255908f, 2.1410799f, 2.455024f, 2.85231924f, 2.20991302f },
+	{ 0.252896696f, 0.859275639f, 0.0f, 1.3472265f, 1.75757849f, 2.0359304f, 1.57359219f, 1.47645652f, 1.70337427f, 1.24261081f, 1.04291236f, 0.69566834f, 1.44865692f, 1.1948719f, 0.889942467f, 0.74783057f, 1.78678501f, 1.66741216f, 1.54659522f, 0.93557322f, 0.746265292f, 1.40880215f, 1.52276206f, 1.61103392f, 1.13597405f, 1.01359713f, 1.28460932f, 1.09438336f, 1.66363585f, 1.5778991f, 1.69304466f, 1.66373503f, 2.18592763f, 1.23981106f, 1.88671756f, 2.44286108f, 1.39068151f, 1.86979973f, 1.78773522f, 1.58889079f, 2.26362395f, 2.27344751f, 1.57735133f, 1.81210101f, 2.10509539f, 2.11682796f, 2.14886308f, 2.42020488f, 1.85033178f, 2.00202894f, 2.13919687f, 2.17396808f, 1.41808772f, 2.07355881f, 2.19700003f, 1.43470371f, 1.96261334f, 2.21123743f, 1.83805096f, 1.41744447f, 1.96707523f, 1.66160381f, 1.67349911f, 1.59151149f, 1.95762026f, 2.21299839f, 2.30421042f, 1.86690688f, 1.76719749f, 1.78722501f, 1.98058391f, 1.88381326f, 2.5133357f, 2.65204692f, 2.16793132f, 1.71124613f, 1.54354692f, 2.27518129f, 2.26924109f, 2.21011591f },
+	{ 1.18512249f, 0.526262403f, 0.0f, 0.514212191f, 0.836012423f, 1.80501473f, 0.503953397f, 1.33918285f, 1.21568763f, 1.13622332f, 0.867374897f, 0.698077142f, 0.54806143f, 0.949174464f, 0.660052478f, 0.306805968f, 0.798371911f, 0.925341606f, 0.95698452f, 0.863251984f, 1.11358225f, 1.18896568f, 1.0193305f, 1.18512321f, 1.21410227f, 1.44488621f, 1.27222037f, 0.977883041f, 1.03901494f, 1.54103267f, 1.37726736f, 1.50954127f, 1.70915592f, 1.43908203f, 1.6335057f, 1.34149969f, 1.48086715f, 1.68638384f, 1.52556932f, 1.69241726f, 1.6844635f, 1.51193643f, 2.05470872f, 1.86922228f, 1.99309087f, 1.90131104f, 2.24010324f, 2.45743465f, 1.89957392f, 1.94383132f, 1.86063933f, 2.3647058f, 1.94914126f, 1.81296611f, 1.96379232f, 1.88058388f, 2.0579772f, 2.11567259f, 2.07854772f, 2.14916873f, 2.31615067f, 2.0584693f, 1.90554667f, 1.92374098f, 2.24123502f, 2.17921996f, 2.30917668f, 2.02513766f, 2.08869433f, 1.91979384f, 1.89409256f, 2.04184604f, 2.19169712f, 2.78406906f, 2.3852458f, 1.9697597f, 2.15182281f, 2.28805947f, 2.26351833f, 2.6549449f },
+	{ 0.670648634f, 1.09755921f, 0.0f, 0.558218658f, 1.55279171f, 1.00902975f, 1.07468629f, 0.972648561f, 0.373805046f, 0.750664711f, 0.334079444f, 0.345018119f, 0.650862098f, 0.627747059f, 0.721204042f, 0.265239805f, 0.576812685f, 0.674879789f, 1.24422395f, 1.17674041f, 0.676071048f, 1.12978709f, 0.99850893f, 1.20041406f, 1.36132634f, 1.14243209f, 1.35728621f, 1.20833731f, 1.19181752f, 1.48394525f, 0.915301859f, 1.71508539f, 1.89185834f, 1.70416033f, 1.41427791f, 1.8065269f, 1.5867058f, 1.68664169f, 1.85998309f, 1.71982777f, 1.46856833f, 2.27596927f, 2.35186911f, 2.14130616f, 2.00054789f, 2.24047256f, 2.01981473f, 2.31082869f, 2.08528113f, 2.41757011f, 1.91907215f, 2.07660222f, 1.96471727f, 2.15425658f, 1.77489388f, 1.84999549f, 2.05724239f, 2.06467414f, 2.03217053f, 2.17407703f, 2.23058057f, 1.83534682f, 1.69647455f, 1.98466587f, 1.84154463f, 1.80857027f, 2.27075839f, 2.01440811f, 2.05122209f, 2.19860601f, 2.01645708f, 1.94865894f, 2.29836392f, 1.98897147f, 2.12192249f, 1.98349738f, 2.41453409f, 2.81358504f, 1.87467289f, 2.39798069f },
+	{ 1.18364739f, 1.00831175f, 0.0f, 2.49526286f, 1.85383081f, 1.11311209f, 0.894278884f, 0.909250438f, 0.617163837f, 0.59153074f, 0.513200819f, 1.03437686f, 1.17457747f, 1.01565635f, 0.850702643f, 0.69723022f, 0.788353264f, 0.872953713f, 0.837109983f, 0.496328264f, 0.293186247f, 0.329592496f, 1.16316903f, 0.861843407f, 0.923327506f, 1.48036039f, 1.29383755f, 1.42935014f, 1.25956059f, 1.64784098f, 1.58291256f, 2.58524609f, 2.27097058f, 2.15933824f, 1.79148459f, 1.71049535f, 1.71940386f, 2.04428506f, 2.01203465f, 1.77908659f, 1.93079066f, 1.96338665f, 1.92286432f, 2.46663046f, 2.41739488f, 2.08481455f, 2.22157717f, 2.36537242f, 2.34382033f, 2.24114037f, 1.90776134f, 1.66486931f, 1.96035826f, 2.04725027f, 1.99905479f, 1.89480972f, 2.53290987f, 2.05576563f, 2.18714523f, 2.20953512f, 2.34584856f, 2.42512441f, 2.02823448f, 2.01288176f, 1.86208308f, 2.00865149f, 2.41287017f, 1.89641917f, 1.82935405f, 2.00713348f, 2.31654859f, 2.1254375f, 2.00733232f, 3.09121418f, 2.18473125f, 1.73916054f, 2.00927353f, 2.4644897f, 2.15263176f, 1.86749387f },
+	{ 0.973370492f, 1.39233398f, 0.0f, 1.11398911f, 1.06403553f, 1.18157601f, 0.447984517f, 0.903335094f, 0.649745822f, 0.304373026f, 0.466317803f, 0.277007073f, 0.529264271f, 0.14704445f, 0.648641229f, 0.219841972f, 0.920914173f, 0.65437752f, 0.309911489f, 1.01935124f, 0.851199746f, 1.00189292f, 1.304914f, 1.16934741f, 1.13165081f, 1.19295251f, 1.49136734f, 1.7046752f, 1.43550551f, 1.72027993f, 1.61658251f, 1.94586861f, 2.23079634f, 1.93258119f, 1.65402031f, 1.66759741f, 1.63714147f, 2.07448816f, 2.09828329f, 1.60062325f, 1.55331635f, 1.92564261f, 1.53998184f, 1.77297032f, 2.06035161f, 1.90150547f, 2.11905432f, 2.61308408f, 1.86850274f, 2.33915234f, 2.03906679f, 2.12985897f, 2.00055742f, 1.79504979f, 1.885221f, 1.89970636f, 2.69277859f, 1.98940027f, 1.91512489f, 2.0048542f, 1.894153f, 2.01340747f, 2.12045622f, 2.64630532f, 2.2810483f, 2.14843965f, 2.15892053f, 2.067029f, 2.1562562f, 1.7490741f, 2.01847816f, 2.50320005f, 2.57767034f, 2.9651103f, 2.11541557f, 1.83740246f, 2.03212881f, 2.29837012f, 2.38864326f, 2.02277255f },
+	{ 0.0851098523f, 0.876266062f, 0.0f, 1.9027915f, 1.36927938f, 1.20801091f, 0.5382514f, 0.582990885f, 0.688977242f, 0.568072677f, 0.487467974f, 0.811405659f, 0.182897821f, 0.289038658f, 0.243880332f, 0.550097823f, 0.867996454f, 1.393206f, 0.972361326f, 0.757099748f, 0.824376523f, 0.644289613f, 0.91495806f, 1.36015606f, 1.35039318f, 1.03642786f, 1.47818744f, 1.06050539f, 0.484846145f, 0.762289703f, 1.13132334f, 1.28841078f, 1.50723898f, 1.74902689f, 1.31499791f, 1.45372438f, 1.30349541f, 1.68485439f, 1.46888542f, 1.20471787f, 1.80873108f, 1.7955637f, 2.10564351f, 1.63362968f, 1.77782214f, 1.37475359f, 1.965343f, 2.27288365f, 1.62029254f, 1.93247962f, 1.68703401f, 2.21956563f, 1.79109097f, 1.42461848f, 1.83247328f, 1.81703126f, 1.87315476f, 1.91269994f, 1.87467337f, 1.81722224f, 1.79006839f, 1.64847016f, 2.14765024f, 1.99534166f, 1.88968694f, 2.02964735f, 2.05646253f, 2.20499229f, 2.8602469f, 2.7121253f, 1.99329841f, 1.89587259f, 1.91655481f, 2.44431877f, 1.75604177f, 2.16161227f, 1.88978946f, 2.00892234f, 1.92183757f, 2.01747513f },
+	{ 0.82001698f, 1.27389228f, 0.0f, 1.1542635f, 1.33389091f, 0.837806761f, 0.837693155f, 0.59489274f, 0.605963707f, 0.581938148f, 0.609502435f, 0.760940909f, 0.441423744f, 0.835547388f, 0.109154426f, 0.523723781f, 0.0353593268f, 0.898815334f, 0.635969043f, 0.472846061f, 0.774633408f, 0.820489645f, 1.31933117f, 1.25356936f, 1.2558322f, 1.34242296f, 1.71467113f, 0.651606977f, 0.964915514f, 1.34159684f, 1.25683773f, 1.77347839f, 1.7397579f, 1.04432571f, 1.41946256f, 1.91518402f, 1.54379094f, 1.79929554f, 1.61139512f, 1.81223261f, 1.85355914f, 2.00737119f, 1.43554533f, 1.24325824f, 1.58648562f, 1.2984308f, 1.75875735f, 1.71138811f, 1.46123445f, 2.11183882f, 2.27961349f, 1.62930727f, 1.41613352f, 1.5748347f, 1.91771412f, 2.19237638f, 2.18096924f, 1.8032409f, 2.06372619f, 1.84143889f, 2.22122788f, 1.75119936f, 1.99828255f, 2.26206183f, 1.8656863f, 1.64639926f, 2.08413219f, 1.53648114f, 2.14919257f, 1.86259651f, 1.81845677f, 1.86796749f, 2.01182055f, 2.09743261f, 2.01846194f, 1.87731409f, 2.0150547f, 1.84310436f, 1.77709413f, 1.73291588f },
+	{ 0.979703307f, 0.519863725f, 0.0f, 1.28478098f, 1.29100931f, 1.12243271f, 0.600960255f, 1.11807024f, 0.5873034f, 0.657102168f, 0.358558863f, 0.380496651f, 0.115339607f, 0.356195003f, 0.372093588f, 0.822183251f, 0.216346413f, 0.78891629f, 0.356761813f, 1.00162506f, 1.11811149f, 0.965736032f, 1.51947916f, 1.3215487f, 1.94990098f, 1.64801216f, 1.69764328f, 1.35800707f, 1.35353363f, 1.89995122f, 2.07614136f, 2.38128424f, 1.85661876f, 1.94002366f, 2.06242561f, 1.54740167f, 1.47853947f, 1.77149999f, 2.23106933f, 2.21260238f, 1.76679134f, 1.51710105f, 1.51301754f, 1.31159985f, 1.8520267f, 1.93281937f, 1.42075861f, 1.68594408f, 1.87402272f, 1.91120553f, 2.08972764f, 1.73746181f, 1.29409134f, 1.64694285f, 2.08802938f, 1.63526964f, 1.57282603f, 1.91337729f, 1.64086831f, 1.35495782f, 1.66753507f, 1.67779505f, 1.66642094f, 1.64213336f, 1.58012509f, 1.71885145f, 1.75835872f, 1.68828106f, 1.89282489f, 1.58740342f, 1.88159001f, 1.65044892f, 1.51952684f, 1.80940723f, 1.96544421f, 1.58808208f, 1.55976129f, 1.71172559f, 1.54556668f, 1.38636792f },
+	{ 1.43227875f, 1.47724855f, 0.0f, 1.67471468f, 0.394091994f, 0.871677697f, 0.809695363f, 0.118642971f, 0.670420468f, 0.600697339f, 0.0908178538f, 0.744163275f, 0.522406697f, 0.630541325f, 0.645880222f, 0.379543692f, 0.914166868f, 0.998512745f, 0.900504291f, 0.594209552f, 0.759306967f, 0.902726531f, 0.962543309f, 1.08341944f, 1.21218562f, 1.5058763f, 1.25830901f, 0.636969209f, 1.18010402f, 1.45297825f, 1.23570001f, 1.94693053f, 2.15204668f, 1.8608346f, 1.5933032f, 1.68275785f, 1.91345453f, 2.24284863f, 1.62602115f, 1.81320846f, 1.918383f, 2.05219007f, 1.74460554f, 1.84441602f, 2.08518863f, 2.01383018f, 1.54863918f, 1.83714855f, 1.47163272f, 1.89104247f, 1.86308193f, 2.01180863f, 1.80519521f, 2.22033596f, 2.33546638f, 2.01122642f, 2.62609148f, 2.01819015f, 1.93883383f, 2.16255879f, 2.2941494f, 2.01606727f, 1.51916587f, 1.68123198f, 1.69196928f, 2.01636052f, 2.7007525f, 2.08065224f, 1.56600022f, 1.58281374f, 1.73558474f, 2.01488757f, 2.0023818f, 2.39068031f, 2.47587252f, 2.24213457f, 1.94582653f, 1.95676911f, 1.7760576f, 1.4754622f },
+};
+#elif AUDIO_SAMPLE_RATE == 8000 && LOG_MEL_FFT_SIZE == 256 && LOG_MEL_FILTERS == 80
+static const float sample_wav_features[35][LOG_MEL_FILTERS] = {
+	{ 0.00741870236f, 0.0f, 0.0108798966f, 0.0f, 0.0647474676f, 0.0336055234f, 0.0f, 0.00294986134f, 0.0f, 0.0199949443f, 0.0108366432f, 0.0170635488f, 0.0f, 0.00946934987f, 0.00414294144f, 0.0018222942f, 0.0f, 0.0086290529f, 0.00356787397f, 0.00145437429f, 0.00735263433f, 0.0083498368f, 0.0081688799f, 0.0f, 0.00307668373f, 0.00342590408f, 0.00225708401f, 0.00157744577f, 0.00909514353f, 0.0104250927f, 0.0142254094f, 0.00230546575f, 0.00940776058f, 0.0063133412f, 0.0101679191f, 0.0249072202f, 0.0146492263f, 0.00871066842f, 0.0147342542f, 0.00590651529f, 0.00606768252f, 0.0163584501f, 0.00385236368f, 0.0046415329f, 0.00592346583f, 0.00699299667f, 0.00595325418f, 0.00475156819f, 0.0106804175f, 0.00597355096f, 0.00339676696f, 0.00489158276f, 0.00805103779f, 0.00567849353f, 0.00686379289f, 0.00495011732f, 0.00537362415f, 0.0032576255f, 0.00274917786f, 0.00188961194f, 0.00264673657f, 0.00235917349f, 0.00180360931f, 0.00371900271f, 0.00404893048f, 0.00263732136f, 0.00235529034f, 0.00260743685f, 0.00400876114f, 0.00247827196f, 0.00233981269f, 0.00168793742f, 0.000835738319f, 0.00283737318f, 0.00232436648f, 0.00209655822f, 0.00262937183f, 0.00166576402f, 0.0013544932f, 0.00229477417f },
+	{ 0.00869015791f, 0.0f, 0.0350781791f, 0.0f, 0.0602735281f, 0.0168211255f, 0.0f, 0.0322095901f, 0.0f, 0.00907840393f, 0.00634274445f, 0.00365168182f, 0.0f, 0.0367539711f, 0.00690457551f, 0.0211349372f, 0.0f, 0.00295391004f, 0.00801325031f, 0.00815450866f, 0.00836715661f, 0.00406668708f, 0.00415514316f, 0.0f, 0.0105444696f, 0.00719045801f, 0.0101545732f, 0.00860095304f, 0.00914685521f, 0.00570698176f, 0.00562889548f, 0.00439508352f, 0.00990368705f, 0.0138024818f, 0.014932231f, 0.00956563931f, 0.0289129037f, 0.0115165338f, 0.0171777345f, 0.00657589687f, 0.00821157731f, 0.00658080773f, 0.00749673042f, 0.00938172545f, 0.00723900134f, 0.00456462242f, 0.00597930187f, 0.00791936275f, 0.0144977774f, 0.00880833156f, 0.00488306768f, 0.00121813046f, 0.00409177132f, 0.00486978702f, 0.00486871973f, 0.00479879603f, 0.00483558234f, 0.0042885202f, 0.00315598166f, 0.00474719843f, 0.00440430688f, 0.0055020107f, 0.00199647294f, 0.00324588548f, 0.00350437546f, 0.0024790233f, 0.00451129675f, 0.00337571884f, 0.00361209572f, 0.00378917786f, 0.00248800381f, 0.00408186158f, 0.0023969363f, 0.00280925538f, 0.00346924528f, 0.0029424224f, 0.00409560092f, 0.00329131423f, 0.00174346776f, 0.00209488044f },
+	{ 0.0654669702f, 0.0f, 0.00896536559f, 0.0f, 0.0400707945f, 0.0547713265f, 0.0f, 0.0180137008f, 0.0f, 0.00744348811f, 0.00971283112f, 0.00166375528f, 0.0f, 0.00505021168f, 0.00358723197f, 0.0114272851f, 0.0f, 0.00159590819f, 0.00333900354f, 0.00269529945f, 0.00771333044f, 0.0131803462f, 0.0120496228f, 0.0f, 0.000383099134f, 0.00555864954f, 0.00292546302f, 0.00827219989f, 0.00631631911f, 0.00755083049f, 0.00912229996f, 0.00981168821f, 0.0204014927f, 0.00674399268f, 0.0210893676f, 0.0166574419f, 0.0115653481f, 0.0145548126f, 0.00602577999f, 0.00332817086f, 0.00559752528f, 0.00638973946f, 0.00513908966f, 0.00699066464f, 0.00472976873f, 0.00398535421f, 0.00660192547f, 0.00726658618f, 0.00837394409f, 0.00432787742f, 0.00589689473f, 0.00357200485f, 0.00461067399f, 0.00400052546f, 0.00191560946f, 0.00241564121f, 0.0042632129f, 0.00595465163f, 0.0045077079f, 0.00407224521f, 0.0040033781f, 0.0047679753f, 0.00180018984f, 0.00261506438f, 0.00256358297f, 0.0019561681f, 0.00208852277f, 0.00402163342f, 0.00257470552f, 0.001802154f, 0.00283336476f, 0.0036957229f, 0.00291555841f, 0.00199479214f, 0.00169269729f, 0.00217823056f, 0.00149899698f, 0.00324103795f, 0.00152428111f, 0.00158835633f },
+	{ 0.0152938282f, 0.0f, 0.00930905156f, 0.0f, 0.0338788293f, 0.0345829055f, 0.0f, 0.0551218428f, 0.0f, 0.00240504299f, 0.024484992f, 0.0081601236f, 0.0f, 0.00685710739f, 0.00376138627f, 0.00363829453f, 0.0f, 0.00569012482f, 0.00687101064f, 0.00417648721f, 0.00663517229f, 0.00576115865f, 0.0110076051f, 0.0f, 0.00609504757f, 0.00237557571f, 0.00794410892f, 0.00619929982f, 0.0100848339f, 0.00884920172f, 0.00356121501f, 0.00787447859f, 0.0221966282f, 0.0197221469f, 0.00750883063f, 0.0108746756f, 0.0101894168f, 0.0121921208f, 0.00631196937f, 0.00753068365f, 0.00336092082f, 0.00264768838f, 0.00313354842f, 0.00348718371f, 0.00726232119f, 0.00697526848f, 0.00531215128f, 0.00710521592f, 0.00344327861f, 0.00539745111f, 0.00226278673f, 0.00461521139f, 0.00574776484f, 0.00492443005f, 0.00274626631f, 0.00208269665f, 0.00262585119f, 0.00358212879f, 0.0025777393f, 0.00255572377f, 0.00426839571f, 0.00341569982f, 0.00290924008f, 0.00245415862f, 0.00370540726f, 0.00199172343f, 0.00241565425f, 0.00204396201f, 0.00212790957f, 0.00280423649f, 0.00316506042f, 0.00273864577f, 0.00179735175f, 0.00161716028f, 0.00105086807f, 0.00199934351f, 0.00198724773f, 0.00206614751f, 0.00151843822f, 0.00181997172f },
+	{ 0.0747421011f, 0.0f, 0.0104346871f, 0.0f, 0.0572786331f, 0.0434286185f, 0.0f, 0.0266471673f, 0.0f, 0.0241108481f, 0.00765720289f, 0.013169934f, 0.0f, 0.0104854582f, 0.00495248428f, 0.00981015246f, 0.0f, 0.00821874849f, 0.0121028563f, 0.00780449947f, 0.0205174387f, 0.00172007037f, 0.00804543495f, 0.0f, 0.00523757515f, 0.00750267319f, 0.00486503076f, 0.00633502845f, 0.00498155924f, 0.00767117785f, 0.00411695242f, 0.0140729258f, 0.00685519259f, 0.0160025358f, 0.0270921644f, 0.0119131496f, 0.0216837842f, 0.00848553888f, 0.0134094348f, 0.00114952633f, 0.00711457152f, 0.00995223597f, 0.0110913776f, 0.0024878378f, 0.00273769326f, 0.00507724332f, 0.0112570459f, 0.00709188823f, 0.00674127648f, 0.00464791246f, 0.00167626748f, 0.00303738913f, 0.00240629353f, 0.00292038731f, 0.00187421136f, 0.00482096896f, 0.00204228843f, 0.0041793501f, 0.00248213508f, 0.00364570133f, 0.00615038956f, 0.00369551079f, 0.0022284505f, 0.00387108f, 0.00272573438f, 0.00168945489f, 0.00139749981f, 0.00129762804f, 0.00156968087f, 0.00115848728f, 0.00107246335f, 0.00226334482f, 0.00200070557f, 0.00254204078f, 0.00156252913f, 0.00190584559f, 0.00181941269f, 0.0023144898f, 0.0025794704f, 0.00274768355f },
+	{ 0.0936219692f, 0.0f, 0.0261597894f, 0.0f, 0.0589077771f, 0.081168972f, 0.0f, 0.046897471f, 0.0f, 0.0130062532f, 0.0237181056f, 0.00658534467f, 0.0f, 0.00413609156f, 0.00502596376f, 0.00500642788f, 0.0f, 0.00602258323f, 0.00444417866f, 0.00273796637f, 0.00470618159f, 0.0066417018f, 0.00767923612f, 0.0f, 0.00481018331f, 0.00321047008f, 0.00225097267f, 0.00785390753f, 0.00582931284f, 0.00534687098f, 0.00739017362f, 0.0150022712f, 0.00603338378f, 0.0118823629f, 0.0138365654f, 0.0120386127f, 0.0125214988f, 0.0103029842f, 0.0146891791f, 0.0129367243f, 0.00949023012f, 0.00539363036f, 0.00409478415f, 0.00518450746f, 0.00535095204f, 0.00646777358f, 0.00963454321f, 0.00712147076f, 0.00361092854f, 0.00511226524f, 0.00337722222f, 0.00320828077f, 0.00545042381f, 0.00370301888f, 0.00525367679f, 0.00503998483f, 0.00467775995f, 0.00451045483f, 0.00386489835f, 0.00332065532f, 0.0013913135f, 0.00392449368f, 0.00198439555f, 0.00406224467f, 0.00321917748f, 0.00220251759f, 0.00355307106f, 0.0017715256f, 0.001426965f, 0.00182936131f, 0.00202545524f, 0.00168910681f, 0.00195470918f, 0.00190384302f, 0.00135003019f, 0.00215822482f, 0.00295104925f, 0.00179421506f, 0.00139564939f, 0.00156461017f },
+	{ 0.0460718609f, 0.0f, 0.0599263348f, 0.0f, 0.0447033457f, 0.0155209517f, 0.0f, 0.0692021549f, 0.0f, 0.00950380974f, 0.0232042279f, 0.00966996793f, 0.0f, 0.00726898247f, 0.00901813526f, 0.0061995713f, 0.0f, 0.0093665272f, 0.00566826761f, 0.00779943354f, 0.00885867421f, 0.00672302255f, 0.00966591481f, 0.0f, 0.00378079736f, 0.00804127101f, 0.00482627423f, 0.0128352772f, 0.0164361354f, 0.00708187139f, 0.0164015181f, 0.00655954843f, 0.0184254274f, 0.00681924168f, 0.00403315807f, 0.0279995278f, 0.0207832363f, 0.00860426575f, 0.0105820084f, 0.0107338689f, 0.00387280597f, 0.0115962103f, 0.0066742464f, 0.00525255175f, 0.0130710024f, 0.00450408878f, 0.00920637697f, 0.00843474641f, 0.0225070808f, 0.0175560769f, 0.00461850315f, 0.0116867395f, 0.0132335983f, 0.0222294759f, 0.0155120976f, 0.0065505919f, 0.00691163912f, 0.00631851936f, 0.00469923625f, 0.00610337174f, 0.0109759718f, 0.0161793996f, 0.00768949883f, 0.00463097123f, 0.00726543786f, 0.0049760784f, 0.00190876098f, 0.00831307936f, 0.00966495834f, 0.00609782152f, 0.00914534461f, 0.0185497571f, 0.0117775733f, 0.0085323425f, 0.00835034531f, 0.01809044f, 0.0150541198f, 0.0139027163f, 0.0100767184f, 0.0100398138f },
+	{ 0.0783040449f, 0.0f, 0.0462621525f, 0.0f, 0.0583992191f, 0.0502350889f, 0.0f, 0.0777610093f, 0.0f, 0.020788487f, 0.00388191943f, 0.00718308194f, 0.0f, 0.0106563289f, 0.00497743674f, 0.00985859148f, 0.0f, 0.0176484361f, 0.0159124229f, 0.00832804292f, 0.0141316308f, 0.0102653215f, 0.005476424f, 0.0f, 0.010878507f, 0.00445935316f, 0.00461575761f, 0.0056309402f, 0.0089700222f, 0.0111249844f, 0.00863106921f, 0.00439783558f, 0.00787384156f, 0.0113102971f, 0.0120359873f, 0.0106964447f, 0.0113759516f, 0.00754734036f, 0.00821001176f, 0.0100990012f, 0.00619441597f, 0.00886870921f, 0.00773871597f, 0.00742926309f, 0.00851731654f, 0.00930750463f, 0.0129251694f, 0.0074177105f, 0.00757963397f, 0.0104364175f, 0.00464924797f, 0.0108193196f, 0.00566582289f, 0.00977524463f, 0.00967257842f, 0.00847582147f, 0.00363081088f, 0.00544458954f, 0.00557399495f, 0.004818107f, 0.00827757083f, 0.00641909521f, 0.00428107986f, 0.00445802696f, 0.00708328048f, 0.0067340224f, 0.00664879009f, 0.00485435035f, 0.00468881521f, 0.00624223473f, 0.00550211268f, 0.00879032072f, 0.00385244051f, 0.00412647892f, 0.00507750735f, 0.00776975509f, 0.00881148502f, 0.00727301557f, 0.00422929786f, 0.00762815028f },
+	{ 0.11832542f, 0.0f, 0.0250536446f, 0.0f, 0.0277251527f, 0.114075981f, 0.0f, 0.060434062f, 0.0f, 0.03809347f, 0.00495434087f, 0.00702061877f, 0.0f, 0.00843712594f, 0.00406833924f, 0.00420309464f, 0.0f, 0.0140702957f, 0.0138285542f, 0.00609527575f, 0.0028126468f, 0.00828493387f, 0.0153545029f, 0.0f, 0.00444166968f, 0.0118743051f, 0.00631828979f, 0.00253010378f, 0.0132650984f, 0.0195327625f, 0.00930004381f, 0.0105552487f, 0.00671277149f, 0.0115312589f, 0.000985551625f, 0.0125172809f, 0.0133954668f, 0.0133166257f, 0.00656397501f, 0.0136809815f, 0.00317774317f, 0.00545474282f, 0.0072368742f, 0.00583150517f, 0.00766614266f, 0.00263443403f, 0.00576270418f, 0.0105591044f, 0.00401528832f, 0.0110036992f, 0.00929639395f, 0.00501444936f, 0.01037018f, 0.00644952105f, 0.00439892244f, 0.00409172149f, 0.00409825798f, 0.00795338396f, 0.00509756943f, 0.0033714748f, 0.00686465902f, 0.00478267763f, 0.00443485379f, 0.00460901158f, 0.00219397014f, 0.00275652437f, 0.00503737945f, 0.00236234954f, 0.00355980964f, 0.00379408011f, 0.00399052911f, 0.00510764774f, 0.0032576602f, 0.00295948819f, 0.00351346098f, 0.00420443341f, 0.00486465869f, 0.00457116216f, 0.00283944746f, 0.00222381623f },
+	{ 2.2471683f, 0.0f, 3.37376976f, 0.0f, 3.34220934f, 2.47908592f, 0.0f, 2.80403042f, 0.0f, 0.646384776f, 1.55354071f, 2.00821447f, 0.0f, 1.73929632f, 2.14885306f, 1.93108094f, 0.0f, 1.64355695f, 1.59514487f, 0.678278387f, 1.57815778f, 1.70077431f, 1.69622982f, 0.0f, 1.75632572f, 1.31624711f, 1.18388343f, 0.614451826f, 1.39543843f, 1.6254555f, 1.32823896f, 0.889019608f, 0.557648361f, 0.404768199f, 0.826494217f, 1.0292927f, 0.755105436f, 0.534589648f, 0.863868356f, 1.04188609f, 0.557565272f, 0.939737141f, 0.727371633f, 0.904967964f, 0.75359863f, 0.649880171f, 0.865331233f, 0.881886899f, 1.06116259f, 1.10456944f, 0.989567161f, 0.970368028f, 1.03398466f, 0.997666717f, 1.02713132f, 0.990762293f, 0.851706386f, 0.718012035f, 1.0166446f, 0.921414375f, 1.05642688f, 1.32459879f, 0.780608177f, 0.917147517f, 0.801107049f, 0.563522577f, 0.649640858f, 0.940924168f, 1.02941334f, 0.974262059f, 0.803433478f, 0.978057444f, 0.969755054f, 1.07810438f, 0.933926821f, 0.866033971f, 0.896686494f, 0.865296423f, 0.953110278f, 0.891816676f },
+	{ 3.01844597f, 0.0f, 2.46320081f, 0.0f, 3.66661739f, 2.09251738f, 0.0f, 2.99261522f, 0.0f, 1.56671894f, 1.92420387f, 1.36935508f, 0.0f, 1.85669887f, 2.17379785f, 1.34713554f, 0.0f, 1.13552403f, 1.61477613f, 1.49844539f, 0.963573337f, 0.912267864f, 0.749777079f, 0.0f, 1.14716995f, 0.672124207f, 1.40504372f, 1.03916824f, 1.39676857f, 1.18235183f, 0.513691068f, 1.45481205f, 0.765635788f, 1.02840388f, 0.908743858f, 1.1406889f, 1.26226878f, 1.03542387f, 1.28570962f, 0.733234048f, 1.13083446f, 0.961441636f, 1.29992127f, 0.954760849f, 1.41488075f, 0.728651881f, 1.35292375f, 0.859755456f, 0.960544884f, 1.35430658f, 0.866499245f, 0.871111989f, 0.695376456f, 0.86517024f, 1.27837408f, 0.958009243f, 0.890845299f, 0.949470043f, 0.891053259f, 0.960996091f, 1.15312111f, 1.039047f, 0.881207645f, 1.0636425f, 0.782372355f, 1.03317261f, 0.915618122f, 0.760815501f, 1.16893172f, 0.957648456f, 0.938614428f, 1.04019916f, 1.15250111f, 1.05901134f, 1.01544821f, 0.999943972f, 1.0061928f, 1.14424992f, 0.49133566f, 0.934951961f },
+	{ 2.67371082f, 0.0f, 2.29593372f, 0.0f, 2.39475942f, 1.8639369f, 0.0f, 0.688919365f, 0.0f, 1.80658412f, 0.302187353f, 1.3661828f, 0.0f, 1.58032167f, 0.716927946f, 0.523305237f, 0.0f, 1.60408664f, 1.1715672f, 1.08971524f, 0.741443455f, 0.80035007f, 1.10886824f, 0.0f, 1.6700238f, 1.03027916f, 1.62761807f, 1.34032822f, 1.22920477f, 1.09205663f, 1.11109567f, 0.907667696f, 0.874367774f, 0.651117086f, 1.1211096f, 0.743786991f, 1.07116604f, 0.905134559f, 1.48997641f, 1.19922793f, 0.961411953f, 0.989226282f, 0.671978652f, 0.680151165f, 0.996946096f, 1.11157584f, 1.23004079f, 1.10872614f, 0.948803902f, 1.03391147f, 0.8044101f, 1.11071312f, 1.11856472f, 0.905197322f, 0.629818857f, 0.731836796f, 1.06885707f, 0.880756795f, 0.668260813f, 1.09676933f, 1.34118545f, 1.19106245f, 1.16327965f, 1.45797908f, 0.895390213f, 1.34150326f, 1.14623976f, 1.0379256f, 1.25935149f, 1.20053804f, 0.714681268f, 0.978030801f, 0.878532946f, 0.972612143f, 1.20272684f, 0.979971588f, 0.854500532f, 0.817540586f, 0.809709311f, 1.01616156f },
+	{ 1.26830149f, 0.0f, 1.29845607f, 0.0f, 1.72253394f, 1.13149285f, 0.0f, 1.26391399f, 0.0f, 0.910223484f, 1.5742774f, 0.372487903f, 0.0f, 0.572438061f, 0.695223391f, 1.06312323f, 0.0f, 0.623508632f, 0.176130965f, 0.701225042f, 0.581911504f, 0.537481785f, 1.03853822f, 0.0f, 0.633041978f, 0.855336547f, 0.283867806f, 0.433047384f, 0.920617044f, 0.739223361f, 0.254581511f, 0.5291906f, 0.740764081f, 0.628010213f, 0.768010497f, 0.723445714f, 0.630211532f, 0.334428757f, 0.406889677f, 0.713308096f, 0.03625286f, 0.513360798f, 0.64020896f, 0.604838014f, 0.791991353f, 0.469951004f, 0.741429746f, 0.403983027f, 0.39315781f, 0.537520647f, 0.325645447f, 0.701712132f, 0.702181756f, 0.604066193f, 0.532188654f, 0.646574497f, 0.660336077f, 0.849356294f, 1.3093555f, 0.660588861f, 1.00055039f, 0.839644611f, 0.751243532f, 1.18200576f, 0.715709984f, 0.558593452f, 0.885890841f, 0.899167895f, 1.71030045f, 1.53933704f, 0.915545762f, 0.843084097f, 0.577355087f, 0.485280663f, 0.985872865f, 1.07449436f, 0.84449631f, 0.622175157f, 0.71702373f, 0.596799195f },
+	{ 1.95636213f, 0.0f, 0.960726142f, 0.0f, 1.55445111f, 1.45250154f, 0.0f, 1.58876991f, 0.0f, 1.10198915f, 1.20180917f, 1.16890538f, 0.0f, 0.936617494f, 0.657281041f, 1.01439035f, 0.0f, 0.199740142f, 0.793767333f, 0.409055233f, 0.50485301f, 0.36809513f, 0.224112824f, 0.0f, 0.530250192f, 0.311894745f, 0.392815053f, 0.458075285f, 0.194112048f, 0.328339875f, 0.224505961f, 0.378825009f, 0.161129728f, 0.436027884f, 0.0748748332f, 0.344217271f, 0.178829297f, 0.126274437f, 0.250159591f, 0.429640353f, 0.0630712956f, 0.107655384f, 0.183729902f, 0.106301166f, 0.267741233f, 0.118826687f, 0.180374503f, 0.129682899f, 0.373857796f, 0.659166574f, 0.25762701f, 0.227882549f, 0.493763745f, 0.283162147f, 0.38717407f, 0.578651726f, 0.303691387f, 0.932941794f, 1.02154994f, 0.510029435f, 0.226767167f, 0.150545448f, 0.484451652f, 1.65480065f, 0.730135381f, 0.697601199f, 1.02993131f, 0.519039512f, 1.29049647f, 1.03808343f, 0.467165351f, 0.803864121f, 0.488785535f, 0.725633025f, 0.979323566f, 1.01512849f, 0.865781307f, 0.698261797f, 0.810956478f, 0.508593857f },
+	{ 1.71557021f, 0.0f, 0.368228227f, 0.0f, 2.10332775f, 1.65210474f, 0.0f, 1.90518379f, 0.0f, 1.25025749f, 0.287644625f, 1.49463177f, 0.0f, 1.02937651f, 0.882024348f, 0.93026638f, 0.0f, 0.298033565f, 0.659544349f, 0.15023154f, 0.179125741f, 0.122861668f, 0.151425451f, 0.0f, 0.254770458f, 0.196241662f, 0.505936801f, 0.816447973f, 0.756898284f, 0.361789763f, 0.27375719f, 0.0148891127f, 0.202351794f, 0.318571895f, 0.342300057f, 0.300187767f, 0.595674694f, 0.252830595f, 0.30164066f, 0.296507031f, 0.13065736f, 0.378159612f, 0.338555753f, 0.168564126f, 0.457588375f, 0.367817253f, 0.216931f, 0.256291986f, 0.373731822f, 0.548805416f, 0.129695445f, 0.141190007f, 0.285218924f, 0.484802514f, 0.453887075f, 0.667883217f, 0.453861237f, 0.802998126f, 0.661357462f, 0.524352849f, 0.440191537f, 0.807911158f, 1.119681f, 2.13149023f, 0.951715469f, 0.864445448f, 1.02323031f, 0.367315829f, 0.8448053f, 0.736361325f, 0.462780803f, 0.459410548f, 0.465484768f, 0.589874148f, 0.631375968f, 0.470638454f, 0.479144454f, 0.458043247f, 0.474427521f, 0.469631255f },
+	{ 1.42047083f, 0.0f, 0.934611976f, 0.0f, 1.25054049f, 0.868841887f, 0.0f, 1.16336024f, 0.0f, 0.253628194f, 0.880652726f, 0.873237014f, 0.0f, 0.857714415f, 0.827513099f, 0.714586318f, 0.0f, 0.302589595f, 0.264985234f, 0.0289044734f, 0.242457405f, 0.091060102f, 0.103690818f, 0.0f, 0.15433383f, 0.181826115f, 0.280152529f, 0.317260414f, 0.455091059f, 0.358869284f, 0.217443213f, 0.021185074f, 0.092759721f, 0.0912878588f, 0.102120966f, 0.329759091f, 0.421224952f, 0.230480075f, 0.177464202f, 0.185660928f, 0.160655811f, 0.196622878f, 0.146224543f, 0.149830744f, 0.143949285f, 0.163260877f, 0.177391365f, 0.147625148f, 0.129345447f, 0.347907454f, 0.0807506666f, 0.213852614f, 0.374559551f, 0.255696535f, 0.453772575f, 0.39393121f, 0.164406374f, 0.288265407f, 0.564876735f, 0.501108348f, 0.424541056f, 0.459796697f, 0.857043564f, 1.67507195f, 0.723903418f, 0.549081564f, 0.77080971f, 0.622292101f, 0.899125099f, 0.914464951f, 0.482100457f, 0.379007041f, 0.184261441f, 0.388332009f, 0.539733171f, 0.427056104f, 1.38786221f, 0.921258211f, 0.609408438f, 0.466613322f },
+	{ 1.75188708f, 0.0f, 0.306320131f, 0.0f, 0.715284705f, 0.525169671f, 0.0f, 0.573386133f, 0.0f, 0.331248969f, 0.216125548f, 0.184099913f, 0.0f, 0.432453126f, 0.227658063f, 0.223386109f, 0.0f, 0.135112703f, 0.128412321f, 0.16679059f, 0.12202663f, 0.0334199443f, 0.0994510576f, 0.0f, 0.0876928717f, 0.0946333855f, 0.122588471f, 0.0950649157f, 0.245405182f, 0.108575471f, 0.0971658528f, 0.0125707649f, 0.164428145f, 0.184337512f, 0.298818439f, 0.0687885508f, 0.127952829f, 0.113412321f, 0.192182109f, 0.291773587f, 0.124076031f, 0.239668012f, 0.262200505f, 0.324401885f, 0.179309145f, 0.134355471f, 0.36487627f, 0.249769911f, 0.180975497f, 0.313224524f, 0.14735575f, 0.291965783f, 0.284317017f, 0.387347132f, 0.45601961f, 0.633906126f, 0.230313256f, 0.398275703f, 0.880520165f, 0.716395795f, 0.443940908f, 0.578653693f, 0.543269932f, 1.02322507f, 0.349264354f, 0.648044169f, 0.449147403f, 0.539002419f, 0.689893663f, 0.458790064f, 0.436545432f, 0.562757075f, 0.600998938f, 0.369170189f, 0.512484848f, 0.621113241f, 1.21718299f, 0.653451979f, 0.628458858f, 0.582295001f },
+	{ 1.97983062f, 0.0f, 0.485149384f, 0.0f, 1.55442464f, 1.16483164f, 0.0f, 0.88984865f, 0.0f, 0.644219398f, 0.382315516f, 0.385440052f, 0.0f, 0.41532436f, 0.314291328f, 0.340410829f, 0.0f, 0.236392185f, 0.0917067751f, 0.226705909f, 0.151927337f, 0.167509347f, 0.243880764f, 0.0f, 0.103295669f, 0.153417394f, 0.143276662f, 0.168724746f, 0.331388831f, 0.279608399f, 0.139156163f, 0.160495684f, 0.0563975535f, 0.215300798f, 0.177591324f, 0.134707451f, 0.252046824f, 0.0837221146f, 0.121615618f, 0.0735993311f, 0.169764951f, 0.191953763f, 0.114195272f, 0.0811978951f, 0.206068426f, 0.263763934f, 0.232923239f, 0.0719615966f, 0.27312237f, 0.35989067f, 0.100614145f, 0.183808491f, 0.334094703f, 0.305740684f, 0.433140814f, 0.291662812f, 0.245665282f, 0.82616806f, 1.00921452f, 0.703568876f, 0.484801739f, 0.257981002f, 0.417959481f, 0.797797322f, 0.50400722f, 0.452209502f, 0.451482773f, 0.308905721f, 0.413237929f, 0.28880018f, 0.297463268f, 0.496160686f, 0.462855846f, 0.672630966f, 0.454057544f, 0.505784333f, 1.32432652f, 0.782629609f, 0.612819314f, 0.443014562f },
+	{ 1.74072528f, 0.0f, 0.28502959f, 0.0f, 0.479181558f, 0.603018582f, 0.0f, 0.368684947f, 0.0f, 0.366567999f, 0.213561147f, 0.234523162f, 0.0f, 0.161203474f, 0.160199493f, 0.0987524316f, 0.0f, 0.063867934f, 0.10087917f, 0.126103386f, 0.0949416831f, 0.151622459f, 0.224890962f, 0.0f, 0.096552223f, 0.0107173827f, 0.077768065f, 0.115380354f, 0.118671156f, 0.124986954f, 0.199393734f, 0.130139545f, 0.110759631f, 0.0846305266f, 0.0720075071f, 0.191358954f, 0.179408103f, 0.1408097f, 0.187238798f, 0.15469715f, 0.0121903988f, 0.0379375257f, 0.119152717f, 0.193156481f, 0.117607355f, 0.14575839f, 0.247204155f, 0.277788907f, 0.279409856f, 0.523364961f, 0.403835386f, 0.248200893f, 0.281791836f, 0.209092051f, 0.200388595f, 0.206393749f, 0.19321765f, 0.59780997f, 0.64261353f, 0.468065053f, 0.306825548f, 0.194698617f, 0.412320286f, 0.943015814f, 0.238092035f, 0.211266518f, 0.224134311f, 0.215572476f, 0.479934275f, 0.412732273f, 0.361570686f, 0.425805777f, 0.379785299f, 0.971242189f, 0.588528037f, 0.544063985f, 1.13936365f, 0.503194332f, 0.416965753f, 0.443163604f },
+	{ 1.35688198f, 0.0f, 0.417552233f, 0.0f, 0.163161293f, 0.361501515f, 0.0f, 0.277966529f, 0.0f, 0.341489255f, 0.149267405f, 0.153432369f, 0.0f, 0.0854068622f, 0.354457736f, 0.200099066f, 0.0f, 0.0716477633f, 0.085376963f, 0.0383942276f, 0.156429663f, 0.0444013849f, 0.203603208f, 0.0f, 0.0918636769f, 0.170080811f, 0.216116101f, 0.151540458f, 0.384782821f, 0.186880365f, 0.210926041f, 0.418304801f, 0.433638424f, 0.474770963f, 0.437670648f, 0.3065705f, 0.260865837f, 0.0811687931f, 0.331086129f, 0.176388383f, 0.0954803452f, 0.414072126f, 0.414317399f, 0.471780837f, 0.50399065f, 0.379342318f, 0.521278739f, 0.432080418f, 0.418028861f, 0.567358732f, 0.32274735f, 0.294323325f, 0.311172158f, 0.525971353f, 0.599170208f, 0.552322745f, 0.450880021f, 0.872998774f, 1.16018796f, 0.852954149f, 0.743334234f, 0.415027022f, 0.570444524f, 0.846935391f, 0.621549845f, 0.67209506f, 0.459917307f, 0.421595991f, 0.497782409f, 0.371511608f, 0.455946356f, 0.665077031f, 0.570451736f, 0.808661819f, 0.36023739f, 0.349254966f, 1.0119313f, 0.544258833f, 0.410707116f, 0.368877411f },
+	{ 2.18502474f, 0.0f, 0.246911898f, 0.0f, 1.53796315f, 1.03288865f, 0.0f, 0.847570002f, 0.0f, 0.749781847f, 0.812723994f, 0.8628124f, 0.0f, 0.812257111f, 0.476745874f, 0.925168753f, 0.0f, 0.960065067f, 1.10118032f, 0.870756805f, 1.19304967f, 0.97691679f, 1.05837941f, 0.0f, 0.960592508f, 0.475307673f, 0.5465855f, 0.38472724f, 0.600225866f, 1.22187603f, 0.570637882f, 0.981819749f, 0.441043198f, 0.754540145f, 0.752488554f, 1.56777167f, 1.95132184f, 1.6972872f, 1.86953092f, 1.87176275f, 1.09005487f, 1.14241028f, 1.02817941f, 0.979458749f, 1.62455738f, 0.992471218f, 2.16574526f, 1.85633874f, 1.9041667f, 1.96748269f, 1.28905022f, 1.59936678f, 1.09547818f, 1.15066469f, 0.98877722f, 1.53747618f, 1.42113185f, 1.22337484f, 1.18579197f, 1.25423074f, 1.32251763f, 1.52832496f, 1.2026217f, 1.52912533f, 1.51089895f, 1.10886359f, 1.39256549f, 1.2249136f, 1.44421697f, 1.07129717f, 1.22421658f, 0.809390903f, 0.820950627f, 0.51072067f, 0.794603109f, 0.748697937f, 1.1532917f, 0.851740062f, 0.755103588f, 0.82845217f },
+	{ 2.02027583f, 0.0f, 1.77358484f, 0.0f, 2.13470173f, 1.35601819f, 0.0f, 0.664080918f, 0.0f, 0.57616663f, 0.959103942f, 0.657772839f, 0.0f, 0.601187229f, 0.954723656f, 0.3807365f, 0.0f, 0.0894817859f, 0.75027734f, 0.243869454f, 0.757778406f, 0.575568497f, 0.346090347f, 0.0f, 0.4925282f, 0.348567039f, 0.666859925f, 0.227226511f, 0.512998879f, 0.928889692f, 0.404991508f, 0.501181126f, 0.205099061f, 0.452956706f, 0.698979139f, 0.605974078f, 1.14001238f, 0.738869548f, 0.923608184f, 0.344838232f, 0.461134166f, 0.956746817f, 0.910079539f, 0.780266881f, 0.782841265f, 1.14279914f, 1.53857338f, 0.533534229f, 1.22228456f, 1.08120084f, 0.895572782f, 1.07852352f, 1.35911739f, 1.5146023f, 1.29554033f, 1.10614669f, 1.35551417f, 1.15667021f, 1.34672678f, 1.34143865f, 1.10473311f, 1.26852691f, 0.76515758f, 1.06322575f, 1.23984957f, 1.50701118f, 1.36639965f, 1.50865424f, 1.22231781f, 0.604617119f, 0.849372029f, 0.900335312f, 0.710727632f, 0.802150846f, 1.44064653f, 1.58185387f, 0.854973972f, 0.874737322f, 0.686169684f, 0.754403889f },
+	{ 1.14691603f, 0.0f, 0.793537796f, 0.0f, 2.03626633f, 1.7187798f, 0.0f, 1.82952881f, 0.0f, 0.822219849f, 1.44153631f, 0.370652229f, 0.0f, 1.27502155f, 0.835297823f, 0.544184566f, 0.0f, 0.93051821f, 0.995453954f, 0.697999418f, 0.384305716f, 0.457320094f, 1.67418873f, 0.0f, 0.926288009f, 0.995708883f, 0.715646446f, 0.610586226f, 0.59803009f, 0.871225893f, 0.638036132f, 0.540548444f, 0.208540916f, 0.337695152f, 0.501686394f, 0.818200171f, 1.31620169f, 0.527016044f, 0.820132315f, 0.945654035f, 0.789026439f, 0.224973693f, 0.72481513f, 1.04631782f, 0.812097967f, 1.16667879f, 1.11238313f, 0.77943331f, 0.928774476f, 1.16954982f, 0.864211142f, 0.792143762f, 1.07681417f, 0.883519411f, 1.39632082f, 1.32224512f, 1.7381376f, 1.55971432f, 1.01954949f, 1.10882223f, 1.39351654f, 1.32519364f, 0.906125546f, 1.6120044f, 1.11211312f, 1.36624348f, 1.52825153f, 1.10659623f, 1.59972203f, 1.40277088f, 0.931539059f, 1.35879076f, 1.23885727f, 1.07785857f, 1.36911023f, 1.23342919f, 1.55131996f, 1.2304461f, 0.775509179f, 0.922811985f },
+	{ 1.62884676f, 0.0f, 0.813484907f, 0.0f, 1.46464944f, 1.49383712f, 0.0f, 1.32739294f, 0.0f, 0.667780936f, 0.925378263f, 0.419498235f, 0.0f, 0.25164628f, 0.214821458f, 0.336522311f, 0.0f, 0.327613682f, 0.691896081f, 0.664282084f, 0.364227921f, 0.67884165f, 0.757686853f, 0.0f, 0.379692495f, 0.234309196f, 0.0926763862f, 0.354614556f, 0.262668639f, 0.538900256f, 0.704555094f, 0.386260122f, 0.741826713f, 0.416361243f, 0.59140712f, 0.525787413f, 0.979861677f, 0.324768275f, 1.10263836f, 1.06594002f, 0.331018895f, 1.09457612f, 0.732067168f, 0.874648273f, 0.691596687f, 0.989496708f, 1.90536475f, 1.04946709f, 1.48001039f, 1.96719432f, 1.5284996f, 0.829376519f, 1.51218605f, 1.4575187f, 1.89496744f, 1.63614023f, 1.47985792f, 1.61893284f, 1.15051079f, 0.762362182f, 1.51033831f, 1.58597624f, 1.02875006f, 1.76344669f, 1.20854127f, 1.45719099f, 1.52834332f, 1.48629928f, 1.4096911f, 0.821002841f, 0.734040082f, 1.12234497f, 1.61719811f, 1.19600129f, 1.16714871f, 1.2737776f, 1.25879323f, 1.03493679f, 0.873256922f, 0.719548225f },
+	{ 0.753642559f, 0.0f, 0.941511631f, 0.0f, 1.41814816f, 1.50712621f, 0.0f, 0.829080701f, 0.0f, 0.567349434f, 0.994638979f, 0.860728502f, 0.0f, 0.651167691f, 0.780348063f, 0.406600505f, 0.0f, 0.598162293f, 0.632405341f, 0.256523907f, 0.180104315f, 0.150725052f, 0.245296687f, 0.0f, 0.166743264f, 0.53970015f, 0.401746452f, 0.541228473f, 0.599490881f, 0.642276645f, 0.413652956f, 0.749030411f, 0.710756004f, 0.481440246f, 0.453229964f, 0.355784655f, 0.589951813f, 0.727612555f, 0.930180073f, 0.623970628f, 0.143934712f, 0.981307268f, 1.56866467f, 1.36646569f, 0.875780761f, 1.25745296f, 0.971074939f, 0.550325394f, 1.13988531f, 0.971381307f, 0.77200532f, 1.1345979f, 1.33453262f, 1.29008567f, 1.30316925f, 1.05638099f, 1.20582366f, 1.46429873f, 1.63815367f, 1.38933718f, 1.73941576f, 1.04292727f, 1.09595144f, 1.62702823f, 1.09754646f, 1.01480389f, 1.11323655f, 0.96116817f, 1.18279612f, 1.10450387f, 1.07909048f, 1.05714381f, 1.29023802f, 1.13481319f, 1.19550502f, 1.94419134f, 1.07918799f, 1.00151277f, 0.771042466f, 0.853236079f },
+	{ 0.369064301f, 0.0f, 0.174617618f, 0.0f, 1.38069916f, 1.40796041f, 0.0f, 0.719557226f, 0.0f, 0.547835588f, 0.133035555f, 0.44473803f, 0.0f, 0.84269774f, 0.399078488f, 0.568895221f, 0.0f, 0.305550903f, 0.478514165f, 0.426917732f, 0.294367194f, 0.295622855f, 0.750458419f, 0.0f, 0.42287451f, 0.359612912f, 0.171032101f, 0.246777967f, 0.194637194f, 0.484275371f, 0.530248821f, 0.181343392f, 0.24170877f, 0.21980907f, 0.369357944f, 0.4934223f, 0.988617122f, 0.720650613f, 0.98865509f, 0.97259903f, 0.372978419f, 1.12188947f, 0.910814524f, 1.02676082f, 1.14527118f, 0.686046779f, 1.22230732f, 0.808349848f, 1.06998348f, 1.16539073f, 0.83969748f, 0.770049512f, 1.16989565f, 1.0263989f, 1.30206895f, 1.1167438f, 0.847338915f, 1.11316323f, 1.72303116f, 1.34631467f, 1.51390445f, 1.85966921f, 1.51946819f, 1.45692396f, 1.12809563f, 1.16992462f, 1.1836319f, 1.28628647f, 1.5626539f, 1.43799138f, 0.920910299f, 1.22436666f, 1.15424073f, 0.951383829f, 0.916226089f, 0.754239857f, 0.708851635f, 1.05915022f, 0.875354469f, 0.905418873f },
+	{ 0.377322137f, 0.0f, 0.506567061f, 0.0f, 1.10196507f, 1.37913525f, 0.0f, 1.32817352f, 0.0f, 1.23858309f, 0.777055085f, 1.07837105f, 0.0f, 0.619098127f, 0.902728617f, 0.705798626f, 0.0f, 0.755201638f, 0.525863409f, 0.730668187f, 0.503564596f, 1.21240842f, 0.639021218f, 0.0f, 1.11821783f, 0.778218687f, 0.658825457f, 0.282669753f, 0.773460865f, 1.20038211f, 0.763028204f, 0.839554787f, 0.317228019f, 0.566431701f, 0.447323889f, 0.638694346f, 0.609328389f, 0.880131543f, 1.10793757f, 0.78198123f, 0.944445193f, 0.794820309f, 0.996547103f, 1.47511458f, 0.617873728f, 0.699284494f, 1.90979087f, 1.23756135f, 0.612153828f, 1.18207335f, 1.27968919f, 0.618698299f, 1.14147246f, 1.36604035f, 1.5617466f, 1.01695311f, 0.792299986f, 0.905932069f, 1.36208808f, 0.914737523f, 1.36509264f, 1.26968932f, 1.41981912f, 1.55073011f, 1.0623877f, 1.18432999f, 1.20830095f, 1.43099976f, 1.35783148f, 0.6606462f, 1.07733417f, 1.47007728f, 1.30608428f, 0.701482594f, 0.905243397f, 1.3436029f, 1.20750058f, 0.940399289f, 0.370842189f, 0.480714738f },
+	{ 0.804029822f, 0.0f, 0.301523149f, 0.0f, 0.36397326f, 0.56637305f, 0.0f, 1.25176954f, 0.0f, 0.173587978f, 0.93937546f, 0.824970365f, 0.0f, 0.643702447f, 0.401786298f, 0.326699138f, 0.0f, 0.233243242f, 0.460324764f, 0.401523948f, 0.309124321f, 0.629733741f, 0.297290385f, 0.0f, 0.218696386f, 0.304051191f, 0.420532137f, 0.474569976f, 0.818716526f, 0.704054475f, 0.777749658f, 0.567461967f, 0.57191211f, 0.710785627f, 0.446992099f, 0.866603911f, 0.771906435f, 0.76544404f, 0.659593344f, 0.683971345f, 0.570688665f, 0.701160371f, 0.918006778f, 1.07787955f, 0.774301648f, 0.85529691f, 1.05922258f, 0.819749057f, 0.905394375f, 1.0284456f, 0.6917817f, 0.744986951f, 1.14416015f, 1.10276628f, 0.4931297f, 0.891632676f, 1.40734267f, 1.13778973f, 1.21114957f, 1.15425825f, 1.13780737f, 1.55505693f, 1.42192924f, 1.6296382f, 1.03470647f, 1.18682659f, 0.954164147f, 1.30468106f, 1.59381783f, 1.09606349f, 1.08218801f, 1.19600964f, 1.02681768f, 1.09021187f, 1.14659095f, 1.16191924f, 1.06726301f, 1.02636647f, 0.939589918f, 1.28576493f },
+	{ 0.392729729f, 0.0f, 0.690128982f, 0.0f, 0.327272445f, 1.0580101f, 0.0f, 0.638978124f, 0.0f, 0.679243565f, 0.577703297f, 0.164220124f, 0.0f, 0.410668075f, 0.12587674f, 0.215302795f, 0.0f, 0.322597444f, 0.397601008f, 0.418827683f, 0.224063471f, 0.374019831f, 0.264555216f, 0.0f, 0.209536746f, 0.679369569f, 0.784390509f, 0.178238958f, 0.760382712f, 0.839502752f, 0.493282199f, 0.74186939f, 0.73026371f, 0.285004288f, 0.763366401f, 0.615250051f, 0.664539933f, 0.503932774f, 0.800476372f, 0.815599084f, 0.0511305109f, 0.781701565f, 1.02265549f, 1.16389048f, 0.998823345f, 0.79176712f, 1.10487282f, 1.11769712f, 0.811759233f, 0.924916089f, 1.09251595f, 0.905806422f, 1.19985974f, 0.855128646f, 1.12119138f, 1.5211159f, 1.61169076f, 1.2575376f, 1.43377185f, 1.08857191f, 1.62259603f, 1.1184963f, 1.21420765f, 1.59468412f, 1.27215278f, 1.61788499f, 1.20121062f, 1.1389395f, 1.4342531f, 1.15170455f, 1.2599777f, 1.09888351f, 1.23320055f, 1.24140024f, 1.35777545f, 1.19598985f, 1.06781352f, 1.21796703f, 0.780242145f, 1.34122443f },
+	{ 0.974868238f, 0.0f, 0.336024225f, 0.0f, 1.82835114f, 1.39413619f, 0.0f, 0.610892296f, 0.0f, 0.258558482f, 0.238043904f, 0.352132261f, 0.0f, 0.575713694f, 0.341309011f, 0.420934618f, 0.0f, 0.555842936f, 0.428374767f, 0.624403119f, 0.565195799f, 0.619737685f, 0.334066898f, 0.0f, 0.404123276f, 0.248381644f, 0.244745418f, 0.233035728f, 0.135752454f, 0.792185009f, 0.177154824f, 0.542647719f, 0.199223563f, 0.814348161f, 0.734528601f, 0.676164746f, 0.920380771f, 0.533877552f, 0.907874823f, 1.13606f, 0.147558048f, 1.53060913f, 1.69660294f, 1.54212332f, 1.47165024f, 1.23188019f, 1.22248161f, 1.15925288f, 0.849156797f, 1.31712556f, 1.0031091f, 1.11751831f, 1.21758938f, 1.24908793f, 1.25559866f, 1.01545405f, 1.1291039f, 1.40956867f, 1.87753177f, 1.24717808f, 1.26320517f, 1.38586974f, 1.55307484f, 1.57774889f, 1.41998708f, 1.52133656f, 1.2737267f, 0.936100483f, 0.894814491f, 1.23983395f, 1.12625289f, 1.561831f, 0.961243749f, 1.13936007f, 1.41422343f, 1.53163481f, 1.17943919f, 1.27491748f, 1.1650728f, 1.35635996f },
+	{ 0.266407877f, 0.0f, 0.710966706f, 0.0f, 0.789682508f, 0.872142076f, 0.0f, 0.916154444f, 0.0f, 0.535485744f, 0.584988475f, 0.502618611f, 0.0f, 0.329100937f, 0.479274631f, 0.271763653f, 0.0f, 0.386183798f, 0.306283563f, 0.31671223f, 0.276046604f, 0.350711733f, 0.368629634f, 0.0f, 0.178823918f, 0.206827357f, 0.521550953f, 0.540255129f, 0.451267213f, 1.01562762f, 0.584620893f, 0.433709651f, 0.57679379f, 0.652215302f, 0.568677366f, 0.841178417f, 1.17107809f, 0.823276341f, 0.82547456f, 1.15200937f, 0.648469627f, 0.881702006f, 1.29968464f, 1.45634854f, 1.26485991f, 0.589424014f, 1.33233106f, 0.845144928f, 0.987492621f, 1.25505841f, 1.12093413f, 1.04835129f, 0.999804556f, 1.03705072f, 0.719353855f, 1.03665018f, 1.11704314f, 0.986096442f, 1.21058595f, 1.30306578f, 1.47345889f, 1.18141556f, 1.79380584f, 1.5357573f, 1.39795971f, 1.47138309f, 1.09286225f, 1.18109715f, 1.37846661f, 1.25121355f, 1.11539435f, 1.12042844f, 1.10835576f, 1.0441221f, 1.59187472f, 1.68754935f, 0.893170178f, 1.14711654f, 0.97414875f, 1.12884581f },
+	{ 0.379078358f, 0.0f, 0.634865403f, 0.0f, 1.25097275f, 0.68620497f, 0.0f, 0.824981809f, 0.0f, 0.127272695f, 0.60485673f, 0.157148436f, 0.0f, 0.514961004f, 0.148970708f, 0.200195044f, 0.0f, 0.304816812f, 0.338291436f, 0.38884151f, 0.318223178f, 0.481966853f, 0.63531816f, 0.0f, 0.239523247f, 0.238351673f, 0.383552074f, 0.561100304f, 0.400416791f, 0.680513144f, 0.42513147f, 0.841337502f, 0.628602743f, 0.420835733f, 0.724262416f, 0.768787026f, 0.706578255f, 0.10334564f, 0.379862249f, 0.35018912f, 0.611119509f, 0.554872692f, 0.730040014f, 0.871743143f, 1.12843013f, 0.629180968f, 1.02372837f, 0.706791341f, 0.779319525f, 1.01295567f, 0.509351611f, 0.934367776f, 0.724174321f, 1.07143176f, 0.933430851f, 1.18387997f, 1.39219332f, 1.04349256f, 1.05851638f, 0.800892651f, 0.929094315f, 1.1674422f, 1.6081872f, 1.11249232f, 0.98364538f, 1.12123108f, 0.983131707f, 1.23167169f, 1.42928362f, 1.02730191f, 0.535380602f, 1.04566014f, 0.757693291f, 0.808522999f, 1.03956687f, 1.20483446f, 0.95763284f, 0.917769194f, 0.928094208f, 1.03293741f },
+	{ 0.138641447f, 0.0f, 0.858219266f, 0.0f, 0.824680865f, 1.02705181f, 0.0f, 0.572814703f, 0.0f, 0.227456376f, 0.505347311f, 0.532804668f, 0.0f, 0.460906297f, 0.397568643f, 0.556168377f, 0.0f, 0.152824089f, 0.398829281f, 0.338999867f, 0.29910022f, 0.32330513f, 0.37511611f, 0.0f, 0.155230314f, 0.257634223f, 0.0401760004f, 0.488304138f, 0.526269972f, 0.92308706f, 0.420375139f, 0.87905848f, 0.415261269f, 0.597683668f, 0.95906359f, 0.970046461f, 0.426674485f, 0.527943015f, 0.646176994f, 0.616455793f, 0.459623754f, 0.947265804f, 1.14801431f, 0.969733953f, 0.384925038f, 0.789660394f, 0.984116435f, 1.30719543f, 0.600991845f, 1.20249927f, 0.680786908f, 0.990400314f, 1.24553621f, 1.18368113f, 1.29864216f, 0.96464622f, 0.658699751f, 0.644901216f, 0.697764933f, 0.838777483f, 0.853639305f, 1.1776458f, 0.833745003f, 1.11821437f, 0.809656858f, 1.29582429f, 1.47055328f, 1.10776591f, 1.15889585f, 0.815485001f, 0.670491695f, 0.901627004f, 0.994635165f, 1.3929795f, 1.39093816f, 1.06446552f, 0.872375727f, 0.883697271f, 0.829206645f, 0.906938374f },
+	{ 0.689064741f, 0.0f, 0.387360334f, 0.0f, 0.862140834f, 0.869362772f, 0.0f, 0.687352717f, 0.0f, 0.232496336f, 0.670071125f, 0.335793585f, 0.0f, 0.351916134f, 0.0860214233f, 0.120541044f, 0.0f, 0.142306298f, 0.210915998f, 0.281444907f, 0.438464075f, 0.0747661144f, 0.398162663f, 0.0f, 0.281136811f, 0.120927781f, 0.657662094f, 0.372870326f, 0.792501867f, 1.04208016f, 0.684577823f, 0.639406919f, 1.25936902f, 0.881779969f, 0.929089248f, 0.833908081f, 0.808484912f, 0.349325657f, 1.22239769f, 1.04272974f, 1.06766534f, 1.47181737f, 1.65458715f, 0.760372758f, 1.04936028f, 1.38234329f, 1.4202621f, 0.976737618f, 0.859300196f, 1.05801284f, 1.01693165f, 1.31105983f, 1.60079348f, 0.882123888f, 0.71638155f, 0.554416656f, 0.750576377f, 0.736898541f, 0.631377995f, 1.21854234f, 1.15215051f, 0.798299134f, 0.931575298f, 1.14613163f, 1.17445469f, 1.03591752f, 1.28049934f, 1.27316892f, 1.10095346f, 0.80474633f, 0.978196323f, 1.26565599f, 1.15918243f, 0.843529165f, 1.03014088f, 0.798608124f, 1.15882087f, 0.915119588f, 0.603074074f, 0.702853858f },
+	{ 0.805899143f, 0.0f, 0.849334657f, 0.0f, 1.15678692f, 0.295293629f, 0.0f, 0.369654328f, 0.0f, 0.671701014f, 0.31577307f, 0.192905068f, 0.0f, 0.480065525f, 0.270093441f, 0.509642839f, 0.0f, 0.43217802f, 0.336100698f, 0.285537243f, 0.159276068f, 0.454461247f, 0.41180414f, 0.0f, 0.453784496f, 0.239277601f, 0.403011978f, 0.102512434f, 0.62689513f, 0.722317398f, 0.644250035f, 0.149729475f, 0.72708261f, 0.826279521f, 0.694557965f, 0.508933544f, 0.25745663f, 0.466276795f, 0.787041903f, 0.881993353f, 0.478881538f, 0.950242698f, 1.26619458f, 1.36480629f, 1.09484363f, 0.940245271f, 1.02403462f, 1.17358696f, 1.22862947f, 1.54536247f, 0.692794442f, 0.941518247f, 1.36374903f, 1.16443026f, 1.20693207f, 1.06010258f, 1.32998574f, 1.02582037f, 1.30804074f, 1.05511975f, 1.12659883f, 0.784392297f, 1.09948993f, 0.997721255f, 0.914257169f, 1.08739913f, 1.21161056f, 1.14659262f, 1.16036272f, 0.980787277f, 1.09267509f, 1.6236788f, 1.39685953f, 1.24172747f, 1.57799697f, 1.56145573f, 1.00225997f, 1.08089983f, 1.06677103f, 1.29252601f },
+};
+#else
+#error No prerecorded features for this AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and LOG_MEL_FILTERS, run tools/generate_prerecorded_features.py
+#endif
@@ -0,0 +1,111 @@
+#include "activity_detector.h"
+#include <stdint.h>
+#include <string.h>
+
+// Weight of each frame's level when the noise floor moves down towards it
+#define FLOOR_FALL 0.5f
+// Largest factor the floor rises by per quiet frame (about 0.2 dB)
+#define FLOOR_RISE 1.05f
+// Largest factor the floor rises by per active frame (about 0.04 dB). A short event barely
+// moves the floor, but a new steady noise such as a fan is absorbed within about 15 seconds
+// instead of keeping the gate open.
+#define FLOOR_RISE_ACTIVE 1.01f
+
+static float TrackFloor(float floor, float level, bool active)
+{
+	if (level < floor) {
+		floor += FLOOR_FALL * (level - floor);
+	}
+	else {
+		float limit = floor * (active ? FLOOR_RISE_ACTIVE : FLOOR_RISE);
+		floor = (level < limit) ? level : limit;
+	}
+	return (floor < ACTIVITY_MIN_NOISE_FLOOR) ? ACTIVITY_MIN_NOISE_FLOOR : floor;
+}
+
+void activity_detector_init(ActivityDetector* detector)
+{
+	memset(detector, 0, sizeof(*detector));
+	detector->noise_floor = ACTIVITY_MIN_NOISE_FLOOR;
+	detector->band_noise_floor = ACTIVITY_MIN_NOISE_FLOOR;
+}
+
+ActivityResult activity_detector_process(ActivityDetector* detector, const short* frame,
+	const FrameInfo* info)
+{
+	++detector->frames;
+#if AUDIO_ACTIVITY_GATE
+	// full band variance, which ignores the DC offset of the microphone, and the mean square
+	// of the first difference, a cheap high-pass that catches glass and gunshot transients
+	int64_t sum = 0;
+	int64_t sumSquares = 0;
+	int64_t diffSquares = 0;
+	int previous = frame[0];
+	for (int i = 0; i < AUDIO_FRAME_SIZE; ++i) {
+		int sample = frame[i];
+		int diff = sample - previous;
+		sum += sample;
+		sumSquares += sample * sample;
+		// a difference reaches 65535, whose square overflows an int
+		diffSquares += (int64_t)diff * diff;
+		previous = sample;
+	}
+	float mean = (float)sum / AUDIO_FRAME_SIZE;
+	float level = (float)sumSquares / AUDIO_FRAME_SIZE - mean * mean;
+	float bandLevel = (float)diffSquares / (AUDIO_FRAME_SIZE - 1);
+
+	if (!detector->floor_ready) {
+		detector->noise_floor = (level < ACTIVITY_MIN_NOISE_FLOOR) ? ACTIVITY_MIN_NOISE_FLOOR : level;
+		detector->band_noise_floor = (bandLevel < ACTIVITY_MIN_NOISE_FLOOR)
+			? ACTIVITY_MIN_NOISE_FLOOR : bandLevel;
+		detector->floor_ready = true;
+	}
+	bool loud = level > ACTIVITY_ENERGY_RATIO * detector->noise_floor
+		|| bandLevel > ACTIVITY_BAND_RATIO * detector->band_noise_floor;
+	bool rising = loud || detector->active;
+	detector->noise_floor = TrackFloor(detector->noise_floor, level, rising);
+	detector->band_noise_floor = TrackFloor(detector->band_noise_floor, bandLevel, rising);
+
+	if (loud) {
+		detector->hangover = ACTIVITY_HANGOVER_FRAMES;
+	}
+	else if (detector->hangover > 0) {
+		--detector->hangover;
+	}
+	bool wasActive = detector->active;
+	detector->active = loud || detector->hangover > 0;
+	if (!detector->active) {
+		activity_detector_add_preroll(detector, frame, info);
+		++detector->skipped_frames;
+		return ActivityResult_Inactive;
+	}
+	return wasActive ? ActivityResult_Active : ActivityResult_Onset;
+#else
+	return ActivityResult_Active;
+#endif
+}
+
+void activity_detector_add_preroll(ActivityDetector* detector, const short* frame,
+	const FrameInfo* info)
+{
+	memcpy(detector->preroll[detector->preroll_next], frame, AUDIO_FRAME_SIZE * sizeof(short));
+	detector->preroll_info[detector->preroll_next] = *info;
+	detector->preroll_next = (detector->preroll_next + 1) % ACTIVITY_PREROLL_FRAMES;
+	if (detector->preroll_count < ACTIVITY_PREROLL_FRAMES) {
+		++detector->preroll_count;
+	}
+}
+
+void activity_detector_clear_preroll(ActivityDetector* detector)
+{
+	detector->preroll_count = 0;
+}
+
+const short* activity_detector_preroll(const ActivityDetector* detector, int index,
+	const FrameInfo** info)
+{
+	int slot = (detector->preroll_next - detector->preroll_count + index + ACTIVITY_PREROLL_FRAMES)
+		% ACTIVITY_PREROLL_FRAMES;
+	*info = &detector->preroll_info[slot];
+	return detector->preroll[slot];
+}
@@ -0,0 +1,81 @@
+#include "adpcm.h"
+
+// Quantizer step sizes of the IMA ADPCM standard
+static const short stepSizes[89] = {
+	7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+	50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+	337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+	2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Step index change after each code, by the magnitude bits of the code
+static const signed char indexSteps[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+void adpcm_encoder_init(AdpcmEncoder* encoder)
+{
+	encoder->step_index = 0;
+}
+
+/// <summary>
+///     Quantizes the difference between a sample and the prediction to a 4-bit code and moves
+///     the prediction the way the decoder will.
+/// </summary>
+static unsigned char EncodeSample(AdpcmEncoder* encoder, int* predictor, int sample)
+{
+	int step = stepSizes[encoder->step_index];
+	int diff = sample - *predictor;
+	unsigned char code = 0;
+	if (diff < 0) {
+		code = 8;
+		diff = -diff;
+	}
+	// the decoder reconstructs step/8 + code bits times step/4, step/2 and step
+	int delta = step >> 3;
+	if (diff >= step) {
+		code |= 4;
+		diff -= step;
+		delta += step;
+	}
+	step >>= 1;
+	if (diff >= step) {
+		code |= 2;
+		diff -= step;
+		delta += step;
+	}
+	step >>= 1;
+	if (diff >= step) {
+		code |= 1;
+		delta += step;
+	}
+	*predictor += (code & 8) ? -delta : delta;
+	if (*predictor > 32767) {
+		*predictor = 32767;
+	}
+	else if (*predictor < -32768) {
+		*predictor = -32768;
+	}
+	encoder->step_index += indexSteps[code & 7];
+	if (encoder->step_index < 0) {
+		encoder->step_index = 0;
+	}
+	else if (encoder->step_index > 88) {
+		encoder->step_index = 88;
+	}
+	return code;
+}
+
+void adpcm_encode_block(AdpcmEncoder* encoder, const short* samples, unsigned char* block)
+{
+	int predictor = samples[0];
+	block[0] = (unsigned char)(predictor & 0xff);
+	block[1] = (unsigned char)((predictor >> 8) & 0xff);
+	block[2] = (unsigned char)encoder->step_index;
+	block[3] = 0;
+	// two samples per byte, the earlier one in the low nibble
+	for (int i = 1, byte = 4; i < ADPCM_BLOCK_SAMPLES; i += 2, ++byte) {
+		unsigned char low = EncodeSample(encoder, &predictor, samples[i]);
+		unsigned char high = EncodeSample(encoder, &predictor, samples[i + 1]);
+		block[byte] = (unsigned char)(low | (high << 4));
+	}
+}
@@ -0,0 +1,152 @@
+#include "audio_history.h"
+#include <stdlib.h>
+#include <string.h>
+#include <applibs/log.h>
+
+#define WAVE_FORMAT_IMA_ADPCM 0x0011
+
+void audio_history_init(AudioHistory* history)
+{
+	memset(history, 0, sizeof(*history));
+	adpcm_encoder_init(&history->encoder);
+}
+
+void audio_history_free(AudioHistory* history)
+{
+	free(history->blocks);
+	history->blocks = NULL;
+}
+
+void audio_history_append(AudioHistory* history, const short* samples, int count,
+	const struct timespec* capture_time)
+{
+	if (history->blocks == NULL) {
+		if (history->disabled) {
+			return;
+		}
+		history->blocks = malloc(AUDIO_HISTORY_BYTES);
+		if (history->blocks == NULL) {
+			Log_Debug("WARNING: Not enough memory for %d bytes of audio history, event clips are disabled.\n",
+				AUDIO_HISTORY_BYTES);
+			history->disabled = true;
+			return;
+		}
+	}
+	if (capture_time != NULL) {
+		history->timed = true;
+		history->last_time = *capture_time;
+		history->last_time_sample = history->block_count * ADPCM_BLOCK_SAMPLES
+			+ (unsigned long long)history->pending_count;
+	}
+	while (count > 0) {
+		int copy = ADPCM_BLOCK_SAMPLES - history->pending_count;
+		if (copy > count) {
+			copy = count;
+		}
+		memcpy(history->pending + history->pending_count, samples, (size_t)copy * sizeof(short));
+		history->pending_count += copy;
+		samples += copy;
+		count -= copy;
+		if (history->pending_count == ADPCM_BLOCK_SAMPLES) {
+			adpcm_encode_block(&history->encoder, history->pending,
+				history->blocks[history->block_count % AUDIO_HISTORY_BLOCKS]);
+			++history->block_count;
+			history->pending_count = 0;
+		}
+	}
+}
+
+bool audio_history_freeze(AudioHistory* history, const struct timespec* onset, unsigned int pre_samples,
+	unsigned int post_samples)
+{
+	if (history->freezing || history->blocks == NULL) {
+		return false;
+	}
+	unsigned long long appended = history->block_count * ADPCM_BLOCK_SAMPLES
+		+ (unsigned long long)history->pending_count;
+	unsigned long long onsetSample = appended;
+	if (onset != NULL && history->timed) {
+		// count back from the last dated samples, no further than the history reaches, so that a
+		// step of the real-time clock cannot overflow
+		long long ns = (history->last_time.tv_sec - onset->tv_sec) * 1000000000LL
+			+ (history->last_time.tv_nsec - onset->tv_nsec);
+		if (ns < 0) {
+			ns = 0;
+		}
+		else if (ns > AUDIO_HISTORY_SECONDS * 1000000000LL) {
+			ns = AUDIO_HISTORY_SECONDS * 1000000000LL;
+		}
+		unsigned long long back = (unsigned long long)(ns * AUDIO_SAMPLE_RATE / 1000000000LL);
+		onsetSample = (history->last_time_sample > back) ? history->last_time_sample - back : 0;
+	}
+	unsigned long long startSample = (onsetSample > pre_samples) ? onsetSample - pre_samples : 0;
+	unsigned long long endSample = appended + post_samples;
+	history->clip_start = startSample / ADPCM_BLOCK_SAMPLES;
+	history->clip_end = (endSample + ADPCM_BLOCK_SAMPLES - 1) / ADPCM_BLOCK_SAMPLES;
+	// the start of the clip must still be in the ring when it is taken, which can be one block
+	// after its last block since a single append may complete two blocks
+	if (history->clip_end - history->clip_start > AUDIO_HISTORY_BLOCKS - 1) {
+		history->clip_start = history->clip_end - (AUDIO_HISTORY_BLOCKS - 1);
+	}
+	history->freezing = true;
+	return true;
+}
+
+static void PutLe16(unsigned char* out, unsigned int value)
+{
+	out[0] = (unsigned char)(value & 0xff);
+	out[1] = (unsigned char)((value >> 8) & 0xff);
+}
+
+static void PutLe32(unsigned char* out, unsigned int value)
+{
+	PutLe16(out, value & 0xffff);
+	PutLe16(out + 2, value >> 16);
+}
+
+/// <summary>
+///     Writes the AUDIO_CLIP_HEADER_BYTES of WAV headers in front of blockCount blocks.
+/// </summary>
+static void WriteClipHeader(unsigned char* out, unsigned int blockCount)
+{
+	unsigned int dataBytes = blockCount * ADPCM_BLOCK_BYTES;
+	memcpy(out, "RIFF", 4);
+	PutLe32(out + 4, AUDIO_CLIP_HEADER_BYTES - 8 + dataBytes);
+	memcpy(out + 8, "WAVE", 4);
+	memcpy(out + 12, "fmt ", 4);
+	PutLe32(out + 16, 20);
+	PutLe16(out + 20, WAVE_FORMAT_IMA_ADPCM);
+	PutLe16(out + 22, 1);  // mono
+	PutLe32(out + 24, AUDIO_SAMPLE_RATE);
+	PutLe32(out + 28, AUDIO_SAMPLE_RATE * ADPCM_BLOCK_BYTES / ADPCM_BLOCK_SAMPLES);  // bytes/sec
+	PutLe16(out + 32, ADPCM_BLOCK_BYTES);
+	PutLe16(out + 34, 4);  // bits per sample
+	PutLe16(out + 36, 2);  // extra format bytes
+	PutLe16(out + 38, ADPCM_BLOCK_SAMPLES);
+	memcpy(out + 40, "fact", 4);
+	PutLe32(out + 44, 4);
+	PutLe32(out + 48, blockCount * ADPCM_BLOCK_SAMPLES);
+	memcpy(out + 52, "data", 4);
+	PutLe32(out + 56, dataBytes);
+}
+
+unsigned char* audio_history_take_clip(AudioHistory* history, size_t* size)
+{
+	if (!history->freezing || history->block_count < history->clip_end) {
+		return NULL;
+	}
+	history->freezing = false;
+	unsigned int blockCount = (unsigned int)(history->clip_end - history->clip_start);
+	*size = AUDIO_CLIP_HEADER_BYTES + (size_t)blockCount * ADPCM_BLOCK_BYTES;
+	unsigned char* clip = malloc(*size);
+	if (clip == NULL) {
+		return NULL;
+	}
+	WriteClipHeader(clip, blockCount);
+	unsigned char* out = clip + AUDIO_CLIP_HEADER_BYTES;
+	for (unsigned long long block = history->clip_start; block < history->clip_end; ++block) {
+		memcpy(out, history->blocks[block % AUDIO_HISTORY_BLOCKS], ADPCM_BLOCK_BYTES);
+		out += ADPCM_BLOCK_BYTES;
+	}
+	return clip;
+}
@@ -0,0 +1,51 @@
+#include "audio_source.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <applibs/log.h>
+#include <applibs/storage.h>
+
+AudioSource* audio_source_create(const char* spec)
+{
+	if (strcmp(spec, "adc") == 0) {
+		return adc_audio_source_create(NULL);
+	}
+	if (strncmp(spec, "adc:", 4) == 0) {
+		return adc_audio_source_create(spec + 4);
+	}
+	if (strncmp(spec, "wav:", 4) == 0) {
+		return wav_audio_source_create(spec + 4);
+	}
+	if (strncmp(spec, "pcm:", 4) == 0) {
+		return pcm_audio_source_create(spec + 4);
+	}
+	if (strncmp(spec, "synth:tone:", 11) == 0) {
+		return synth_audio_source_create(SynthWaveform_Tone, strtof(spec + 11, NULL));
+	}
+	if (strcmp(spec, "synth:noise") == 0) {
+		return synth_audio_source_create(SynthWaveform_Noise, 0.0f);
+	}
+	if (strncmp(spec, "synth:impulse:", 14) == 0) {
+		return synth_audio_source_create(SynthWaveform_Impulse, strtof(spec + 14, NULL));
+	}
+	Log_Debug("ERROR: Unknown audio source '%s'.\n", spec);
+	return NULL;
+}
+
+void audio_source_destroy(AudioSource* source)
+{
+	if (source != NULL) {
+		free(source->context);
+		free(source);
+	}
+}
+
+int audio_source_open_file(const char* path)
+{
+	int fd = (path[0] == '/') ? open(path, O_RDONLY) : Storage_OpenFileInImagePackage(path);
+	if (fd < 0) {
+		Log_Debug("ERROR: Could not open '%s': %s (%d).\n", path, strerror(errno), errno);
+	}
+	return fd;
+}
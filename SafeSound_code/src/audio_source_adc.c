@@ -0,0 +1,160 @@
+#include "audio_source.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <applibs/adc.h>
+#include <applibs/log.h>
+
+#include "common.h"
+#include "epoll_timerfd_utilities.h"
+#include "hw/safe_sound_hardware.h"
+
+typedef struct AdcSourceContext {
+	int controllerFd;
+	ADC_ChannelId channels[MAX_AUDIO_CHANNELS];  // one microphone per channel
+} AdcSourceContext;
+
+/// <summary>
+///     Checks that the samples of every channel fit in 16 bits.
+/// </summary>
+static int CheckSampleBitCount(AudioSource* source)
+{
+	AdcSourceContext* context = source->context;
+	for (int channel = 0; channel < source->channels; ++channel) {
+		int bitCount = ADC_GetSampleBitCount(context->controllerFd, context->channels[channel]);
+		if (bitCount == -1) {
+			Log_Debug("ERROR: ADC_GetSampleBitCount failed with error : %s (%d)\n", strerror(errno), errno);
+			return -1;
+		}
+		if (bitCount == 0) {
+			Log_Debug("ERROR: ADC_GetSampleBitCount returned sample size of 0 bits.\n");
+			return -1;
+		}
+		if (bitCount > 16) {
+			Log_Debug("ERROR: ADC sample size of %d bits does not fit 16-bit samples.\n", bitCount);
+			return -1;
+		}
+		if (channel > 0 && bitCount != source->bits_per_sample) {
+			Log_Debug("ERROR: ADC channels have different sample sizes (%d and %d bits).\n",
+				source->bits_per_sample, bitCount);
+			return -1;
+		}
+		source->bits_per_sample = bitCount;
+	}
+	Log_Debug("INFO: ADC sample bit count: %d, %d channels.\n", source->bits_per_sample,
+		source->channels);
+	return 0;
+}
+
+static void AdcClose(AudioSource* source)
+{
+	AdcSourceContext* context = source->context;
+	CloseFdAndPrintError(context->controllerFd, "ADC");
+	context->controllerFd = -1;
+}
+
+/// <summary>
+///     Opens the ADC controller. It is closed again if the samples do not fit in 16 bits.
+/// </summary>
+static int AdcOpen(AudioSource* source)
+{
+	AdcSourceContext* context = source->context;
+
+	Log_Debug("INFO: Opening ADC Controller.\n");
+	context->controllerFd = ADC_Open(MICROPHONE_CONTROLLER);
+	if (context->controllerFd < 0) {
+		Log_Debug("ERROR: ADC_Open failed with error: %s (%d)\n", strerror(errno), errno);
+		return -1;
+	}
+	if (CheckSampleBitCount(source) != 0) {
+		AdcClose(source);
+		return -1;
+	}
+	return 0;
+}
+
+/// <summary>
+///     Takes count readings from each microphone ADC channel. The channels are read back to
+///     back for every sample period, so they are sampled within the same capture tick. The ADC
+///     does not buffer, so the readings of one call are only a sample period apart for a count
+///     of 1, which max_block tells the capture thread.
+/// </summary>
+static int AdcReadBlock(AudioSource* source, short* samples, int count)
+{
+	AdcSourceContext* context = source->context;
+	int shift = 16 - source->bits_per_sample;
+	for (int i = 0; i < count; ++i) {
+		for (int channel = 0; channel < source->channels; ++channel) {
+			uint32_t value;
+			int result = ADC_Poll(context->controllerFd, context->channels[channel], &value);
+			if (result < -1) {
+				Log_Debug("ERROR: ADC_Poll failed with error: %s (%d)\n", strerror(errno), errno);
+				return -1;
+			}
+			// shift adc reading into the signed 16-bit range
+			*samples++ = (short)((int32_t)(value << shift) - 32768);
+		}
+	}
+	return count;
+}
+
+/// <summary>
+///     Parses a comma separated list of ADC channel numbers.
+/// </summary>
+/// <returns>Number of channels, or -1 if the list is invalid.</returns>
+static int ParseChannelList(const char* channelList, ADC_ChannelId* channels)
+{
+	int count = 0;
+	const char* next = channelList;
+	while (true) {
+		char* end;
+		unsigned long channel = strtoul(next, &end, 10);
+		if (end == next || count == MAX_AUDIO_CHANNELS) {
+			return -1;
+		}
+		channels[count++] = (ADC_ChannelId)channel;
+		if (*end == '\0') {
+			return count;
+		}
+		if (*end != ',') {
+			return -1;
+		}
+		next = end + 1;
+	}
+}
+
+AudioSource* adc_audio_source_create(const char* channelList)
+{
+	AudioSource* source = calloc(1, sizeof(AudioSource));
+	AdcSourceContext* context = calloc(1, sizeof(AdcSourceContext));
+	if (source == NULL || context == NULL) {
+		free(source);
+		free(context);
+		return NULL;
+	}
+	int channelCount = 1;
+	context->channels[0] = MICROPHONE;
+	if (channelList != NULL) {
+		channelCount = ParseChannelList(channelList, context->channels);
+		if (channelCount < 0) {
+			Log_Debug("ERROR: Expecting 1 to %d comma separated ADC channels, got '%s'.\n",
+				MAX_AUDIO_CHANNELS, channelList);
+			free(source);
+			free(context);
+			return NULL;
+		}
+	}
+	context->controllerFd = -1;
+	source->name = "adc";
+	source->sample_rate = AUDIO_CAPTURE_RATE;
+	source->channels = channelCount;
+	source->bits_per_sample = 16;
+	source->live = true;
+	source->max_block = 1;
+	source->open = AdcOpen;
+	source->read_block = AdcReadBlock;
+	source->close = AdcClose;
+	source->context = context;
+	return source;
+}
@@ -0,0 +1,112 @@
+#include "audio_source.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <applibs/log.h>
+
+#include "common.h"
+#include "epoll_timerfd_utilities.h"
+
+#define PCM_PATH_SIZE 128
+
+typedef struct PcmSourceContext {
+	char path[PCM_PATH_SIZE];
+	int fd;
+	bool have_partial;  // true if partial holds the first byte of the next sample
+	uint8_t partial;
+} PcmSourceContext;
+
+static void PcmClose(AudioSource* source)
+{
+	PcmSourceContext* context = source->context;
+	CloseFdAndPrintError(context->fd, "PcmStream");
+	context->fd = -1;
+}
+
+/// <summary>
+///     Opens the stream and switches it to non-blocking reads, so a slow writer shows up
+///     as missing samples rather than stalling the capture thread.
+/// </summary>
+static int PcmOpen(AudioSource* source)
+{
+	PcmSourceContext* context = source->context;
+	// opening a FIFO blocks until the writer has connected
+	context->fd = audio_source_open_file(context->path);
+	if (context->fd < 0) {
+		return -1;
+	}
+	int flags = fcntl(context->fd, F_GETFL);
+	if (flags == -1 || fcntl(context->fd, F_SETFL, flags | O_NONBLOCK) == -1) {
+		Log_Debug("ERROR: Could not make '%s' non-blocking: %s (%d).\n", context->path,
+			strerror(errno), errno);
+		PcmClose(source);
+		return -1;
+	}
+	context->have_partial = false;
+	return 0;
+}
+
+static int PcmReadBlock(AudioSource* source, short* samples, int count)
+{
+	PcmSourceContext* context = source->context;
+	uint8_t* bytes = (uint8_t*)samples;
+	size_t total = 0;
+	if (context->have_partial) {
+		bytes[0] = context->partial;
+		total = 1;
+	}
+	size_t size = (size_t)count * sizeof(short);
+	while (total < size) {
+		ssize_t result = read(context->fd, bytes + total, size - total);
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				// the writer has not caught up yet
+				break;
+			}
+			Log_Debug("ERROR: Could not read '%s': %s (%d).\n", context->path, strerror(errno), errno);
+			return -1;
+		}
+		if (result == 0) {
+			// the writer closed the stream
+			if (total < sizeof(short)) {
+				return -1;
+			}
+			break;
+		}
+		total += (size_t)result;
+	}
+	context->have_partial = (total % sizeof(short)) != 0;
+	if (context->have_partial) {
+		context->partial = bytes[total - 1];
+	}
+	return (int)(total / sizeof(short));
+}
+
+AudioSource* pcm_audio_source_create(const char* path)
+{
+	AudioSource* source = calloc(1, sizeof(AudioSource));
+	PcmSourceContext* context = calloc(1, sizeof(PcmSourceContext));
+	if (source == NULL || context == NULL) {
+		free(source);
+		free(context);
+		return NULL;
+	}
+	strncpy(context->path, path, PCM_PATH_SIZE - 1);
+	context->fd = -1;
+	source->name = "pcm";
+	source->sample_rate = AUDIO_CAPTURE_RATE;
+	source->channels = 1;
+	source->bits_per_sample = 16;
+	source->live = true;
+	source->open = PcmOpen;
+	source->read_block = PcmReadBlock;
+	source->close = PcmClose;
+	source->context = context;
+	return source;
+}
@@ -0,0 +1,93 @@
+#include "audio_source.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <applibs/log.h>
+
+#include "common.h"
+
+#define SYNTH_AMPLITUDE 16384  // half of full scale
+
+typedef struct SynthSourceContext {
+	SynthWaveform waveform;
+	float parameter;
+	float phase;  // tone phase in cycles (0 - 1)
+	uint32_t noise_state;
+	unsigned int sample_index;  // samples since the last impulse
+} SynthSourceContext;
+
+static int SynthOpen(AudioSource* source)
+{
+	SynthSourceContext* context = source->context;
+	if (context->waveform != SynthWaveform_Noise && context->parameter <= 0.0f) {
+		Log_Debug("ERROR: Synthetic audio source needs a positive frequency or period.\n");
+		return -1;
+	}
+	context->phase = 0.0f;
+	context->noise_state = 22222;
+	context->sample_index = 0;
+	return 0;
+}
+
+static int SynthReadBlock(AudioSource* source, short* samples, int count)
+{
+	SynthSourceContext* context = source->context;
+	switch (context->waveform) {
+	case SynthWaveform_Tone: {
+		const float twoPi = 6.28318530718f;
+		float increment = context->parameter / source->sample_rate;
+		for (int i = 0; i < count; ++i) {
+			samples[i] = (short)(SYNTH_AMPLITUDE * sinf(twoPi * context->phase));
+			context->phase += increment;
+			context->phase -= floorf(context->phase);
+		}
+		break;
+	}
+	case SynthWaveform_Noise:
+		for (int i = 0; i < count; ++i) {
+			// 32-bit linear congruential generator, the top bits are the most random
+			context->noise_state = context->noise_state * 1664525u + 1013904223u;
+			samples[i] = (short)((int32_t)(context->noise_state >> 16) - 32768) / 2;
+		}
+		break;
+	case SynthWaveform_Impulse: {
+		unsigned int period = (unsigned int)(context->parameter * source->sample_rate / 1000.0f);
+		if (period == 0) {
+			period = 1;
+		}
+		for (int i = 0; i < count; ++i) {
+			samples[i] = (context->sample_index == 0) ? 32767 : 0;
+			context->sample_index = (context->sample_index + 1) % period;
+		}
+		break;
+	}
+	}
+	return count;
+}
+
+static void SynthClose(AudioSource* source)
+{
+}
+
+AudioSource* synth_audio_source_create(SynthWaveform waveform, float parameter)
+{
+	AudioSource* source = calloc(1, sizeof(AudioSource));
+	SynthSourceContext* context = calloc(1, sizeof(SynthSourceContext));
+	if (source == NULL || context == NULL) {
+		free(source);
+		free(context);
+		return NULL;
+	}
+	context->waveform = waveform;
+	context->parameter = parameter;
+	source->name = "synth";
+	source->sample_rate = AUDIO_CAPTURE_RATE;
+	source->channels = 1;
+	source->bits_per_sample = 16;
+	source->live = false;
+	source->open = SynthOpen;
+	source->read_block = SynthReadBlock;
+	source->close = SynthClose;
+	source->context = context;
+	return source;
+}
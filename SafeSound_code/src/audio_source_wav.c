@@ -0,0 +1,190 @@
+#include "audio_source.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <applibs/log.h>
+
+#include "common.h"
+#include "epoll_timerfd_utilities.h"
+
+#define WAV_PATH_SIZE 128
+
+typedef struct WavSourceContext {
+	char path[WAV_PATH_SIZE];
+	int fd;
+	uint32_t data_remaining;  // bytes of sample data left in the file
+} WavSourceContext;
+
+/// <summary>
+///     Reads until size bytes have been read or the end of the file is reached.
+/// </summary>
+/// <returns>Number of bytes read, or -1 on failure.</returns>
+static int ReadFully(int fd, void* buffer, size_t size)
+{
+	size_t total = 0;
+	while (total < size) {
+		ssize_t result = read(fd, (char*)buffer + total, size - total);
+		if (result < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			Log_Debug("ERROR: Could not read audio file: %s (%d).\n", strerror(errno), errno);
+			return -1;
+		}
+		if (result == 0) {
+			break;
+		}
+		total += (size_t)result;
+	}
+	return (int)total;
+}
+
+/// <summary>
+///     Skips over size bytes. Reading instead of seeking also works for pipes.
+/// </summary>
+/// <returns>0 on success, or -1 on failure.</returns>
+static int Skip(int fd, uint32_t size)
+{
+	char scratch[64];
+	while (size > 0) {
+		size_t chunk = size < sizeof(scratch) ? size : sizeof(scratch);
+		if (ReadFully(fd, scratch, chunk) != (int)chunk) {
+			return -1;
+		}
+		size -= (uint32_t)chunk;
+	}
+	return 0;
+}
+
+static uint16_t ReadLe16(const uint8_t* bytes)
+{
+	return (uint16_t)(bytes[0] | (bytes[1] << 8));
+}
+
+static uint32_t ReadLe32(const uint8_t* bytes)
+{
+	return (uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16)
+		| ((uint32_t)bytes[3] << 24);
+}
+
+/// <summary>
+///     Parses the RIFF header up to the start of the sample data.
+/// </summary>
+/// <returns>0 on success, or -1 if the file is not a WAV file the pipeline can read.</returns>
+static int ParseHeader(AudioSource* source)
+{
+	WavSourceContext* context = source->context;
+	uint8_t header[16];
+	if (ReadFully(context->fd, header, 12) != 12 || memcmp(header, "RIFF", 4) != 0
+		|| memcmp(header + 8, "WAVE", 4) != 0) {
+		Log_Debug("ERROR: '%s' is not a WAV file.\n", context->path);
+		return -1;
+	}
+
+	bool haveFormat = false;
+	while (true) {
+		if (ReadFully(context->fd, header, 8) != 8) {
+			Log_Debug("ERROR: '%s' has no data chunk.\n", context->path);
+			return -1;
+		}
+		uint32_t chunkSize = ReadLe32(header + 4);
+		if (memcmp(header, "data", 4) == 0) {
+			if (!haveFormat) {
+				Log_Debug("ERROR: '%s' has no format chunk before its data.\n", context->path);
+				return -1;
+			}
+			context->data_remaining = chunkSize;
+			return 0;
+		}
+		// chunks are padded to an even number of bytes
+		uint32_t skip = chunkSize + (chunkSize & 1);
+		if (memcmp(header, "fmt ", 4) == 0 && chunkSize >= 16) {
+			if (ReadFully(context->fd, header, 16) != 16) {
+				return -1;
+			}
+			skip -= 16;
+			uint16_t format = ReadLe16(header);
+			source->channels = ReadLe16(header + 2);
+			source->sample_rate = (int)ReadLe32(header + 4);
+			source->bits_per_sample = ReadLe16(header + 14);
+			if (format != 1 || source->bits_per_sample != 16 || source->channels < 1
+				|| source->channels > MAX_AUDIO_CHANNELS) {
+				Log_Debug("ERROR: '%s' must be 16-bit PCM with 1 to %d channels (format %u, %d channels, %d bits).\n",
+					context->path, MAX_AUDIO_CHANNELS, format, source->channels, source->bits_per_sample);
+				return -1;
+			}
+			haveFormat = true;
+		}
+		if (Skip(context->fd, skip) != 0) {
+			return -1;
+		}
+	}
+}
+
+static void WavClose(AudioSource* source)
+{
+	WavSourceContext* context = source->context;
+	CloseFdAndPrintError(context->fd, "WavFile");
+	context->fd = -1;
+}
+
+/// <summary>
+///     Opens the file and parses its header. The file is closed again if the header is invalid.
+/// </summary>
+static int WavOpen(AudioSource* source)
+{
+	WavSourceContext* context = source->context;
+	context->fd = audio_source_open_file(context->path);
+	if (context->fd < 0) {
+		return -1;
+	}
+	if (ParseHeader(source) != 0) {
+		WavClose(source);
+		return -1;
+	}
+	return 0;
+}
+
+static int WavReadBlock(AudioSource* source, short* samples, int count)
+{
+	WavSourceContext* context = source->context;
+	size_t periodSize = (size_t)source->channels * sizeof(short);
+	if (context->data_remaining < periodSize) {
+		return -1;
+	}
+	size_t size = (size_t)count * periodSize;
+	if (size > context->data_remaining) {
+		// stop at the last whole sample period
+		size = context->data_remaining - context->data_remaining % periodSize;
+	}
+	int result = ReadFully(context->fd, samples, size);
+	if (result < (int)periodSize) {
+		return -1;
+	}
+	context->data_remaining -= (uint32_t)result;
+	return result / (int)periodSize;
+}
+
+AudioSource* wav_audio_source_create(const char* path)
+{
+	AudioSource* source = calloc(1, sizeof(AudioSource));
+	WavSourceContext* context = calloc(1, sizeof(WavSourceContext));
+	if (source == NULL || context == NULL) {
+		free(source);
+		free(context);
+		return NULL;
+	}
+	strncpy(context->path, path, WAV_PATH_SIZE - 1);
+	context->fd = -1;
+	source->name = "wav";
+	source->channels = 1;
+	source->bits_per_sample = 16;
+	source->live = false;
+	source->open = WavOpen;
+	source->read_block = WavReadBlock;
+	source->close = WavClose;
+	source->context = context;
+	return source;
+}
@@ -229,6 +229,30 @@ void update_device_twin_int(const char* propertyName, int propertyValue)
 	}
 }
 
+/// <summary>
+///     Sends an update to the device twin.
+/// </summary>
+/// <param name="propertyName">the IoT Hub Device Twin property name</param>
+/// <param name="propertyValue">the IoT Hub Device Twin property value</param>
+void update_device_twin_string(const char* propertyName, const char* propertyValue)
+{
+	static char reportedPropertiesString[64] = { 0 };
+	int len = snprintf(reportedPropertiesString, sizeof(reportedPropertiesString), "{\"%s\":\"%s\"}",
+		propertyName, propertyValue);
+	if (len < 0 || len >= (int)sizeof(reportedPropertiesString)) {
+		Log_Debug("ERROR: Couldn't create string for update_device_twin_string.\n");
+		return;
+	}
+
+	if (!update_device_twin((unsigned char*)reportedPropertiesString)) {
+		Log_Debug("ERROR: failed to set reported state for '%s'.\n", propertyName);
+	}
+	else {
+		Log_Debug("INFO: Reported state for '%s' set to '%s'.\n", propertyName,
+			propertyValue);
+	}
+}
+
 /// <summary>
 ///     Converts the IoT Hub connection status reason to a string.
 /// </summary>
@@ -1,47 +1,318 @@
+#define _GNU_SOURCE  // memfd_create
 #include "common.h"
 
 #include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+#if AUDIO_HOP_SIZE > AUDIO_FRAME_SIZE || (AUDIO_HOP_SIZE & (AUDIO_HOP_SIZE - 1)) != 0
+#error AUDIO_HOP_SIZE must be a power of two no larger than AUDIO_FRAME_SIZE
+#endif
+#if (AUDIO_RING_SAMPLES & (AUDIO_RING_SAMPLES - 1)) != 0 || AUDIO_RING_SAMPLES < 2 * AUDIO_FRAME_SIZE \
+	|| AUDIO_RING_SAMPLES < AUDIO_RING_MIN_SAMPLES
+#error AUDIO_RING_SAMPLES must be a power of two holding at least two frames and AUDIO_QUEUE_DEPTH
+#endif
+
+#define RING_BYTES (AUDIO_RING_SAMPLES * sizeof(short))
+// Samples past the end of the ring that the last frames reach into
+#define MIRROR_SAMPLES (AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE)
 
 // Termination state
 volatile sig_atomic_t terminationRequired = false;
 
+/// <summary>
+///     Maps the same memory twice in a row, so that reads and writes past the end of the ring
+///     land at its start.
+/// </summary>
+/// <returns>The first mapping, or NULL if the platform does not support it.</returns>
+static short* MapMirroredRing(void)
+{
+#if AUDIO_RING_MIRROR
+	long pageSize = sysconf(_SC_PAGESIZE);
+	if (pageSize <= 0 || RING_BYTES % (size_t)pageSize != 0) {
+		return NULL;
+	}
+	int fd = memfd_create("AudioBuffer", 0);
+	if (fd < 0) {
+		return NULL;
+	}
+	char* ring = NULL;
+	if (ftruncate(fd, RING_BYTES) == 0) {
+		// reserve both halves first so that nothing else can be mapped in between
+		char* base = mmap(NULL, 2 * RING_BYTES, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (base != MAP_FAILED) {
+			if (mmap(base, RING_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED
+				&& mmap(base + RING_BYTES, RING_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED,
+					fd, 0) != MAP_FAILED) {
+				ring = base;
+			}
+			else {
+				munmap(base, 2 * RING_BYTES);
+			}
+		}
+	}
+	// the mappings keep the memory alive
+	close(fd);
+	return (short*)ring;
+#else
+	return NULL;
+#endif
+}
+
 bool initialize_audio_buffer(AudioBuffer* buf)
 {
-	buf->read_index = MAX_BUFFERS - 1;
-	buf->write_index = 0;
-	buf->buffer_size = AUDIO_FRAME_SIZE;
-	buf->dropped_frames = 0;
-	buf->dataAvailableFd = eventfd(0, EFD_SEMAPHORE);
+	atomic_init(&buf->write_count, 0);
+	atomic_init(&buf->read_count, 0);
+	atomic_init(&buf->held, 0);
+	atomic_init(&buf->holding, false);
+	atomic_init(&buf->dropped_frames, 0);
+	atomic_init(&buf->gap_samples_total, 0);
+	memset(buf->info, 0, sizeof(buf->info));
+	buf->priming_hops = AUDIO_FRAME_HOPS;
+	for (int policy = 0; policy < AudioOverload_Count; ++policy) {
+		atomic_init(&buf->overload_frames[policy], 0);
+	}
+	atomic_init(&buf->depth, AUDIO_QUEUE_DEPTH);
+	atomic_init(&buf->policy, AUDIO_OVERLOAD_POLICY);
+	buf->samples = MapMirroredRing();
+	buf->mirrored = buf->samples != NULL;
+	if (!buf->mirrored) {
+		buf->samples = calloc(AUDIO_RING_SAMPLES + MIRROR_SAMPLES, sizeof(short));
+		if (buf->samples == NULL) {
+			return false;
+		}
+	}
+	// a counting eventfd: one read takes all the notifications, and the consumer drains the
+	// ring rather than taking one frame per notification
+	buf->dataAvailableFd = eventfd(0, 0);
 	return buf->dataAvailableFd >= 0;
 }
 
-bool write_audio_buffer(AudioBuffer* buf, float* srcData, unsigned short srcSize)
+void free_audio_buffer(AudioBuffer* buf)
 {
-	if (srcSize > buf->buffer_size) {
-		return false;
+	if (buf->mirrored) {
+		munmap(buf->samples, 2 * RING_BYTES);
+	}
+	else {
+		free(buf->samples);
 	}
-	if (buf->read_index == buf->write_index) {
-		// no free buffer to write to
+	buf->samples = NULL;
+	buf->mirrored = false;
+}
+
+bool set_audio_buffer_depth(AudioBuffer* buf, unsigned int depth)
+{
+	if (depth < 1 || depth > AUDIO_MAX_QUEUE_DEPTH) {
 		return false;
 	}
-	// everything is good, copy the data
-	memcpy(buf->buffers[buf->write_index], srcData, srcSize * sizeof(float));
-	buf->write_index = (short)((buf->write_index + 1) % MAX_BUFFERS);
+	atomic_store_explicit(&buf->depth, depth, memory_order_relaxed);
 	return true;
 }
 
-bool read_audio_buffer(AudioBuffer* buf, float* destBuf, unsigned short destSize)
+void set_audio_buffer_policy(AudioBuffer* buf, AudioOverloadPolicy policy)
 {
-	if (destBuf == NULL || destSize < buf->buffer_size) {
-		return false;
+	atomic_store_explicit(&buf->policy, policy, memory_order_relaxed);
+}
+
+/// <summary>
+///     Number of complete frames that have not been released.
+/// </summary>
+static unsigned int QueuedFrames(unsigned int writeCount, unsigned int readCount)
+{
+	unsigned int hops = writeCount - readCount;
+	return (hops < AUDIO_FRAME_HOPS) ? 0 : hops - AUDIO_FRAME_HOPS + 1;
+}
+
+short* acquire_write_slot(AudioBuffer* buf, FrameInfo** info)
+{
+	// only this thread writes write_count
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_relaxed);
+	unsigned int readCount = atomic_load(&buf->read_count);
+	AudioOverloadPolicy policy = atomic_load_explicit(&buf->policy, memory_order_relaxed);
+	bool reclaimed = false;
+	if (writeCount - readCount == AUDIO_RING_HOPS) {
+		// the oldest unreleased frame starts at the hop that would be overwritten
+		if (policy != AudioOverload_DropOldest) {
+			return NULL;
+		}
+		// take the oldest frame back from the consumer; if the consumer released or skipped it
+		// in the meantime, the hop is free anyway
+		reclaimed = atomic_compare_exchange_strong(&buf->read_count, &readCount, readCount + 1);
 	}
-	short next_index = (short)((buf->read_index + 1) % MAX_BUFFERS);
-	if (next_index == buf->write_index) {
-		// no new data to read
-		return false;
+	else if (policy == AudioOverload_DropNewest
+		&& QueuedFrames(writeCount + 1, readCount) > atomic_load_explicit(&buf->depth, memory_order_relaxed)) {
+		// the hop would complete one frame more than the queue may hold
+		return NULL;
 	}
-	memcpy(destBuf, buf->buffers[buf->read_index], destSize * sizeof(float));
-	buf->read_index = next_index;
-	return true;
+	// The consumer pins its frame before it checks read_count again, and all of these accesses
+	// are sequentially consistent: either the consumer sees the frame taken back and moves on,
+	// or this sees the pin and leaves the hop alone. Once unpinned, the consumer has finished
+	// reading the hop.
+	if (atomic_load(&buf->holding) && writeCount - atomic_load(&buf->held) >= AUDIO_RING_HOPS) {
+		// the frame stays with the consumer, and its release finds read_count already past it
+		return NULL;
+	}
+	if (reclaimed) {
+		atomic_fetch_add_explicit(&buf->overload_frames[AudioOverload_DropOldest], 1, memory_order_relaxed);
+	}
+	// AudioReaders behind read_count find out from write_count whether a hop was overwritten
+	// while they read it, so the count must be visible before anything in the hop changes
+	atomic_thread_fence(memory_order_release);
+	unsigned int hop = writeCount % AUDIO_RING_HOPS;
+	*info = &buf->info[hop];
+	return buf->samples + hop * AUDIO_HOP_SIZE;
+}
+
+bool commit_write_slot(AudioBuffer* buf)
+{
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_relaxed);
+#if MIRROR_SAMPLES > 0
+	// with frames of one hop nothing reaches past the end of the ring
+	unsigned int offset = (writeCount % AUDIO_RING_HOPS) * AUDIO_HOP_SIZE;
+	if (!buf->mirrored && offset < MIRROR_SAMPLES) {
+		// frames near the end of the ring read these samples past its end
+		memcpy(buf->samples + AUDIO_RING_SAMPLES + offset, buf->samples + offset,
+			AUDIO_HOP_SIZE * sizeof(short));
+	}
+#endif
+	// publishes the samples and FrameInfo written to the hop
+	atomic_store_explicit(&buf->write_count, writeCount + 1, memory_order_release);
+	if (buf->priming_hops > 0) {
+		--buf->priming_hops;
+	}
+	return buf->priming_hops == 0;
+}
+
+void drop_write_slot(AudioBuffer* buf)
+{
+	atomic_fetch_add_explicit(&buf->dropped_frames, 1, memory_order_relaxed);
+	if (atomic_load_explicit(&buf->policy, memory_order_relaxed) == AudioOverload_DropNewest) {
+		atomic_fetch_add_explicit(&buf->overload_frames[AudioOverload_DropNewest], 1, memory_order_relaxed);
+	}
+}
+
+/// <summary>
+///     Composes the origin of the frame starting at a hop from the FrameInfo of its hops.
+/// </summary>
+static void ComposeFrameInfo(const AudioBuffer* buf, unsigned int hop, FrameInfo* info)
+{
+	*info = buf->info[hop];
+	for (int i = 1; i < AUDIO_FRAME_HOPS; ++i) {
+		info->gap_samples += buf->info[(hop + i) % AUDIO_RING_HOPS].gap_samples;
+	}
+}
+
+const short* acquire_read_slot(AudioBuffer* buf, const FrameInfo** info)
+{
+	// with AudioOverload_DropOldest the producer takes frames back too
+	unsigned int readCount = atomic_load(&buf->read_count);
+	for (;;) {
+		// pairs with the release in commit_write_slot, so the hop contents are visible
+		unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_acquire);
+		unsigned int queued = QueuedFrames(writeCount, readCount);
+		if (queued == 0) {
+			// the next frame is not complete yet
+			return NULL;
+		}
+		unsigned int depth = atomic_load_explicit(&buf->depth, memory_order_relaxed);
+		if (queued > depth
+			&& atomic_load_explicit(&buf->policy, memory_order_relaxed) == AudioOverload_DropOldest) {
+			// hand the oldest frames back unread, their sequence numbers show the jump
+			if (!atomic_compare_exchange_strong(&buf->read_count, &readCount, readCount + queued - depth)) {
+				// the producer took a frame back first, readCount now holds the new count
+				continue;
+			}
+			readCount += queued - depth;
+			atomic_fetch_add_explicit(&buf->overload_frames[AudioOverload_DropOldest], queued - depth,
+				memory_order_relaxed);
+		}
+		// pin the frame, then make sure the producer did not take it back in the meantime
+		atomic_store(&buf->held, readCount);
+		atomic_store(&buf->holding, true);
+		unsigned int current = atomic_load(&buf->read_count);
+		if (current == readCount) {
+			break;
+		}
+		atomic_store(&buf->holding, false);
+		readCount = current;
+	}
+	unsigned int hop = readCount % AUDIO_RING_HOPS;
+	if (info != NULL) {
+		ComposeFrameInfo(buf, hop, &buf->frame_info);
+		*info = &buf->frame_info;
+	}
+	return buf->samples + hop * AUDIO_HOP_SIZE;
+}
+
+void release_read_slot(AudioBuffer* buf)
+{
+	// only this thread writes held
+	unsigned int readCount = atomic_load_explicit(&buf->held, memory_order_relaxed);
+	// fails if the producer already took the frame back, which leaves read_count past it
+	atomic_compare_exchange_strong(&buf->read_count, &readCount, readCount + 1);
+	// the hop must not be refilled before this thread has finished reading it
+	atomic_store(&buf->holding, false);
+}
+
+void audio_reader_init(AudioBuffer* buf, AudioReader* reader)
+{
+	reader->read_count = atomic_load_explicit(&buf->read_count, memory_order_acquire);
+	reader->skipped_frames = 0;
+}
+
+const short* acquire_reader_slot(AudioBuffer* buf, AudioReader* reader, const FrameInfo** info)
+{
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_acquire);
+	if (QueuedFrames(writeCount, reader->read_count) == 0) {
+		return NULL;
+	}
+	if (writeCount - reader->read_count >= AUDIO_RING_HOPS) {
+		// the producer may already be filling the first hop of the frame again, so the reader
+		// has fallen off the ring; it continues with the newest frame
+		unsigned int newest = writeCount - AUDIO_FRAME_HOPS;
+		reader->skipped_frames += newest - reader->read_count;
+		reader->read_count = newest;
+	}
+	unsigned int hop = reader->read_count % AUDIO_RING_HOPS;
+	if (info != NULL) {
+		ComposeFrameInfo(buf, hop, &reader->frame_info);
+		*info = &reader->frame_info;
+	}
+	return buf->samples + hop * AUDIO_HOP_SIZE;
+}
+
+bool release_reader_slot(AudioBuffer* buf, AudioReader* reader)
+{
+	// orders the reads of the frame before the check, pairs with the fence in acquire_write_slot
+	atomic_thread_fence(memory_order_acquire);
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_relaxed);
+	// the producer only fills a hop once write_count has reached it, and the first hop of the
+	// frame is the first to be filled again
+	bool intact = writeCount - reader->read_count < AUDIO_RING_HOPS;
+	if (!intact) {
+		reader->skipped_frames += 1;
+	}
+	reader->read_count += 1;
+	return intact;
+}
+
+unsigned int audio_buffer_queued_frames(AudioBuffer* buf)
+{
+	unsigned int readCount = atomic_load_explicit(&buf->read_count, memory_order_acquire);
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_acquire);
+	return QueuedFrames(writeCount, readCount);
+}
+
+bool audio_buffer_overloaded(AudioBuffer* buf)
+{
+	unsigned int readCount = atomic_load_explicit(&buf->read_count, memory_order_acquire);
+	unsigned int writeCount = atomic_load_explicit(&buf->write_count, memory_order_acquire);
+	return QueuedFrames(writeCount, readCount) > atomic_load_explicit(&buf->depth, memory_order_relaxed);
+}
+
+float frame_integrity(const FrameInfo* info)
+{
+	return 1.0f - (float)info->gap_samples / AUDIO_FRAME_SIZE;
 }
\ No newline at end of file
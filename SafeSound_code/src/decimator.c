@@ -0,0 +1,79 @@
+#include "decimator.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Index of the center tap in the filter window
+#define CENTER (DECIMATOR_TAPS / 2)
+// Number of non-zero taps on each side of the center
+#define SIDE_TAPS ((DECIMATOR_TAPS + 1) / 4)
+// Fractional bits of the fixed-point taps
+#define TAP_BITS 15
+
+// Non-zero taps at odd distances 1, 3, 5, ... from the center in Q15. The center tap is 0.5.
+static short taps[SIDE_TAPS];
+static bool tapsReady = false;
+
+static void compute_taps(void)
+{
+	const double pi = 3.14159265358979323846;
+	double values[SIDE_TAPS];
+	double sum = 0;
+	for (int k = 0; k < SIDE_TAPS; ++k) {
+		int t = 2 * k + 1;  // distance from the center
+		double sinc = sin(pi * t / 2) / (pi * t);
+		// Blackman window which reaches zero just beyond the outermost taps
+		double x = pi * t / (CENTER + 1);
+		double window = 0.42 + 0.5 * cos(x) + 0.08 * cos(2 * x);
+		values[k] = sinc * window;
+		sum += 2 * values[k];
+	}
+	// normalize the side taps to 0.5 in total, which with the center tap gives unity gain at DC
+	for (int k = 0; k < SIDE_TAPS; ++k) {
+		taps[k] = (short)lround(values[k] * 0.5 / sum * (1 << TAP_BITS));
+	}
+	tapsReady = true;
+}
+
+void decimator_init(Decimator* decimator)
+{
+	if (!tapsReady) {
+		compute_taps();
+	}
+	memset(decimator->delay, 0, sizeof(decimator->delay));
+	decimator->position = 0;
+	decimator->output_due = false;
+}
+
+int decimator_process(Decimator* decimator, const short* input, int inputCount, short* output)
+{
+	int count = 0;
+	for (int i = 0; i < inputCount; ++i) {
+		// the newest sample replaces the oldest one in both copies
+		short sample = input[i];
+		decimator->delay[decimator->position] = sample;
+		decimator->delay[decimator->position + DECIMATOR_TAPS] = sample;
+		if (++decimator->position == DECIMATOR_TAPS) {
+			decimator->position = 0;
+		}
+		decimator->output_due = !decimator->output_due;
+		if (!decimator->output_due) {
+			continue;
+		}
+		const short* x = decimator->delay + decimator->position;
+		// the taps sum to 1.0, so the Q30 sum of 16-bit samples fits in 32 bits
+		int32_t acc = (int32_t)x[CENTER] << (TAP_BITS - 1);
+		for (int k = 0; k < SIDE_TAPS; ++k) {
+			acc += taps[k] * (x[CENTER - 2 * k - 1] + x[CENTER + 2 * k + 1]);
+		}
+		acc = (acc + (1 << (TAP_BITS - 1))) >> TAP_BITS;
+		if (acc > 32767) {
+			acc = 32767;
+		}
+		else if (acc < -32768) {
+			acc = -32768;
+		}
+		output[count++] = (short)acc;
+	}
+	return count;
+}
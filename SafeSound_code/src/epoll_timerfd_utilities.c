@@ -82,8 +82,14 @@ int SetTimerFdToSingleExpiry(int timerFd, const struct timespec *expiry)
 int ConsumeTimerFdEvent(int timerFd)
 {
     uint64_t timerData = 0;
+    return ConsumeTimerFdEventCount(timerFd, &timerData);
+}
+
+int ConsumeTimerFdEventCount(int timerFd, uint64_t *expirations)
+{
+    *expirations = 0;
 
-    if (read(timerFd, &timerData, sizeof(timerData)) == -1) {
+    if (read(timerFd, expirations, sizeof(*expirations)) == -1) {
         Log_Debug("ERROR: Could not read timerfd %s (%d).\n", strerror(errno), errno);
         return -1;
     }
@@ -21,13 +21,19 @@ void save_event(const char* event_string)
 }
 
 bool construct_event_message(
-	char* buffer, size_t buf_size, const char* event_type, float confidence
+	char* buffer, size_t buf_size, const char* event_type, float confidence,
+	const struct timespec* event_time
 )
 {
-	const char* EventMsgTemplate = "{\"eventType\":\"%s\",\"confidence\":%1.2f,\"eventTime\":%d}";
+	const char* EventMsgTemplate =
+		"{\"eventType\":\"%s\",\"confidence\":%1.2f,\"eventTime\":%d,\"eventTimeMs\":%d}";
 	struct timespec currentTime;
-	clock_gettime(CLOCK_REALTIME, &currentTime);
-	int len = snprintf(buffer, buf_size, EventMsgTemplate, event_type, confidence, currentTime.tv_sec);
+	if (event_time == NULL) {
+		clock_gettime(CLOCK_REALTIME, &currentTime);
+		event_time = &currentTime;
+	}
+	int len = snprintf(buffer, buf_size, EventMsgTemplate, event_type, confidence,
+		(int)event_time->tv_sec, (int)(event_time->tv_nsec / 1000000));
 	return len > 0;
 }
 
@@ -72,4 +78,66 @@ bool construct_history_message(char* buffer, size_t buf_size)
 	}
 	strcpy(buffer + string_index, HISTORY_FORMAT_END);
 	return true;
-}
\ No newline at end of file
+}
+
+/// <summary>
+///		Writes data as base64 with padding.
+///	</summary>
+///	<returns>Number of characters written, not counting the terminating null.</returns>
+static size_t EncodeBase64(char* out, const unsigned char* data, size_t size)
+{
+	static const char alphabet[] =
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	size_t length = 0;
+	for (size_t i = 0; i < size; i += 3) {
+		unsigned int group = (unsigned int)data[i] << 16;
+		if (i + 1 < size) {
+			group |= (unsigned int)data[i + 1] << 8;
+		}
+		if (i + 2 < size) {
+			group |= data[i + 2];
+		}
+		out[length++] = alphabet[(group >> 18) & 0x3f];
+		out[length++] = alphabet[(group >> 12) & 0x3f];
+		out[length++] = (i + 1 < size) ? alphabet[(group >> 6) & 0x3f] : '=';
+		out[length++] = (i + 2 < size) ? alphabet[group & 0x3f] : '=';
+	}
+	out[length] = '\0';
+	return length;
+}
+
+bool construct_clip_chunk_message(
+	char* buffer, size_t buf_size, unsigned int clip_id, const char* event_type,
+	const struct timespec* event_time, int microphone, unsigned int chunk,
+	unsigned int chunk_count, const unsigned char* data, size_t size
+)
+{
+	const char* ClipMsgTemplate =
+		"{\"clipId\":%u,\"eventType\":\"%s\",\"eventTime\":%d,\"eventTimeMs\":%d,\"microphone\":%d,\"chunk\":%u,\"chunks\":%u,\"data\":\"";
+	if (size > CLIP_CHUNK_BYTES) {
+		return false;
+	}
+	int len = snprintf(buffer, buf_size, ClipMsgTemplate, clip_id, event_type,
+		(int)event_time->tv_sec, (int)(event_time->tv_nsec / 1000000), microphone, chunk, chunk_count);
+	// room for the base64 data, the closing characters and the terminating null
+	if (len < 0 || (size_t)len + 4 * ((size + 2) / 3) + 3 > buf_size) {
+		Log_Debug("ERROR: buffer is not big enough.\n");
+		return false;
+	}
+	len += (int)EncodeBase64(buffer + len, data, size);
+	strcpy(buffer + len, "\"}");
+	return true;
+}
+
+bool construct_level_message(
+	char* buffer, size_t buf_size, int microphone, const struct timespec* period_end,
+	int period_seconds, const LevelSummary* summary
+)
+{
+	const char* LevelMsgTemplate =
+		"{\"microphone\":%d,\"periodEnd\":%d,\"periodSeconds\":%d,\"minDb\":%.1f,\"leqDb\":%.1f,\"maxDb\":%.1f,\"peakDb\":%.1f,\"p10Db\":%.0f,\"p50Db\":%.0f,\"p90Db\":%.0f}";
+	int len = snprintf(buffer, buf_size, LevelMsgTemplate, microphone, (int)period_end->tv_sec,
+		period_seconds, summary->min_db, summary->leq_db, summary->max_db, summary->peak_db,
+		summary->p10_db, summary->p50_db, summary->p90_db);
+	return len > 0 && (size_t)len < buf_size;
+}
@@ -0,0 +1,88 @@
+#include "level_meter.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Mean square of a full-scale signal
+#define FULL_SCALE_POWER (32768.0f * 32768.0f)
+
+void level_meter_init(LevelMeter* meter)
+{
+	memset(meter, 0, sizeof(*meter));
+	meter->min_db = 0;
+	meter->max_db = LEVEL_FLOOR_DB;
+}
+
+/// <summary>
+///     Converts a mean square to dBFS, limited to LEVEL_FLOOR_DB.
+/// </summary>
+static float PowerToDb(float meanSquare)
+{
+	float db = 10.0f * log10f(meanSquare / FULL_SCALE_POWER);
+	return (db > LEVEL_FLOOR_DB) ? db : LEVEL_FLOOR_DB;
+}
+
+float level_meter_process(LevelMeter* meter, const short* samples, int count)
+{
+	// a squared 16-bit sample fits in 32 bits, so only the sum needs 64 bits
+	uint64_t energy = 0;
+	int peak = 0;
+	for (int i = 0; i < count; ++i) {
+		int32_t sample = samples[i];
+		energy += (uint32_t)(sample * sample);
+		int magnitude = (sample < 0) ? -sample : sample;
+		if (magnitude > peak) {
+			peak = magnitude;
+		}
+	}
+	meter->energy += energy;
+	meter->samples += (unsigned long long)count;
+	if (peak > meter->peak) {
+		meter->peak = peak;
+	}
+
+	float db = PowerToDb((float)energy / (float)count);
+	if (db < meter->min_db) {
+		meter->min_db = db;
+	}
+	if (db > meter->max_db) {
+		meter->max_db = db;
+	}
+	int bin = (int)(db - LEVEL_FLOOR_DB);
+	meter->histogram[(bin < LEVEL_BINS) ? bin : LEVEL_BINS - 1] += 1;
+	++meter->blocks;
+	return db;
+}
+
+/// <summary>
+///     Finds the level which a fraction of the blocks stayed below.
+/// </summary>
+/// <returns>Upper edge of the histogram bin containing the percentile, in dBFS.</returns>
+static float Percentile(const LevelMeter* meter, float fraction)
+{
+	unsigned int count = 0;
+	for (int i = 0; i < LEVEL_BINS; ++i) {
+		count += meter->histogram[i];
+		if (count >= fraction * meter->blocks) {
+			return (float)(LEVEL_FLOOR_DB + i + 1);
+		}
+	}
+	return 0;
+}
+
+bool level_meter_summarize(LevelMeter* meter, LevelSummary* summary)
+{
+	if (meter->blocks == 0) {
+		return false;
+	}
+	summary->blocks = meter->blocks;
+	summary->min_db = meter->min_db;
+	summary->leq_db = PowerToDb((float)((double)meter->energy / (double)meter->samples));
+	summary->max_db = meter->max_db;
+	summary->peak_db = (meter->peak > 0) ? 20.0f * log10f((float)meter->peak / 32768.0f) : LEVEL_FLOOR_DB;
+	summary->p10_db = Percentile(meter, 0.1f);
+	summary->p50_db = Percentile(meter, 0.5f);
+	summary->p90_db = Percentile(meter, 0.9f);
+	level_meter_init(meter);
+	return true;
+}
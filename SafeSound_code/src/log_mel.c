@@ -0,0 +1,353 @@
+#include "log_mel.h"
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if (LOG_MEL_FFT_SIZE & (LOG_MEL_FFT_SIZE - 1)) != 0
+#error LOG_MEL_FFT_SIZE must be a power of two
+#endif
+
+// The real frame is transformed as a complex sequence of half its length, even samples in the
+// real part and odd samples in the imaginary part, and then split into the spectrum of the frame
+#define HALF_SIZE (LOG_MEL_FFT_SIZE / 2)
+
+#include "log_mel_tables.h"
+
+/// <summary>
+///     Transforms the HALF_SIZE values in re and im, which hold the input in bit-reversed order,
+///     into their spectrum in natural order with radix-2 decimation-in-time butterflies.
+/// </summary>
+static void Fft(float* restrict re, float* restrict im)
+{
+	for (int span = 1; span < HALF_SIZE; span *= 2) {
+		const float* wr = twiddleRe + span - 1;
+		const float* wi = twiddleIm + span - 1;
+		for (int start = 0; start < HALF_SIZE; start += 2 * span) {
+			float* ar = re + start;
+			float* ai = im + start;
+			float* br = ar + span;
+			float* bi = ai + span;
+			for (int k = 0; k < span; ++k) {
+				float tr = wr[k] * br[k] - wi[k] * bi[k];
+				float ti = wr[k] * bi[k] + wi[k] * br[k];
+				br[k] = ar[k] - tr;
+				bi[k] = ai[k] - ti;
+				ar[k] += tr;
+				ai[k] += ti;
+			}
+		}
+	}
+}
+
+/// <summary>
+///     Splits the half-size spectrum Z of the packed frame into the magnitudes of bins 0 to
+///     HALF_SIZE of the spectrum X of the real frame. With E and O the spectra of the even and
+///     odd samples, E[k] = (Z[k] + conj(Z[-k])) / 2, O[k] = (Z[k] - conj(Z[-k])) / 2i,
+///     X[k] = E[k] + W^k O[k] and |X[HALF_SIZE - k]| = |E[k] - W^k O[k]|.
+/// </summary>
+static void SplitMagnitudes(const float* re, const float* im, float* magnitude)
+{
+	for (int k = 0; k <= HALF_SIZE / 2; ++k) {
+		int mirror = (HALF_SIZE - k) & (HALF_SIZE - 1);
+		float er = 0.5f * (re[k] + re[mirror]);
+		float ei = 0.5f * (im[k] - im[mirror]);
+		float or = 0.5f * (im[k] + im[mirror]);
+		float oi = 0.5f * (re[mirror] - re[k]);
+		float tr = splitRe[k] * or - splitIm[k] * oi;
+		float ti = splitRe[k] * oi + splitIm[k] * or;
+		magnitude[k] = sqrtf((er + tr) * (er + tr) + (ei + ti) * (ei + ti));
+		magnitude[HALF_SIZE - k] = sqrtf((er - tr) * (er - tr) + (ei - ti) * (ei - ti));
+	}
+}
+
+// Fast natural logarithm. x = m * 2^e with m in [sqrt(1/2), sqrt(2)), found by subtracting the
+// bits of sqrt(1/2) so that the exponent field carries over at the right mantissa, and
+// log(x) = log(1 + t) + e * ln(2) with t = m - 1. log(1 + t) = t - t^2 / 2 + t^3 * P(t), where
+// P is the minimax polynomial of the Cephes logf, which keeps the error within 2 ulp.
+#define LOG_SQRT_HALF_BITS 0x3f3504f3
+#define LOG_MANTISSA_MASK 0x007fffff
+#define LOG_LN2_HIGH 0.693359375f  // ln(2) in few bits, so e * LOG_LN2_HIGH is exact
+#define LOG_LN2_LOW -2.12194440e-4f  // ln(2) - LOG_LN2_HIGH
+#define LOG_P0 7.0376836292e-2f
+#define LOG_P1 -1.1514610310e-1f
+#define LOG_P2 1.1676998740e-1f
+#define LOG_P3 -1.2420140846e-1f
+#define LOG_P4 1.4249322787e-1f
+#define LOG_P5 -1.6668057665e-1f
+#define LOG_P6 2.0000714765e-1f
+#define LOG_P7 -2.4999993993e-1f
+#define LOG_P8 3.3333331174e-1f
+
+/// <summary>
+///     Natural logarithm of a positive, normal and finite x.
+/// </summary>
+static inline float FastLog(float x)
+{
+	int32_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+	bits -= LOG_SQRT_HALF_BITS;
+	float e = (float)(bits >> 23);
+	int32_t mantissaBits = (bits & LOG_MANTISSA_MASK) + LOG_SQRT_HALF_BITS;
+	float t;
+	memcpy(&t, &mantissaBits, sizeof(t));
+	t -= 1.0f;
+	float t2 = t * t;
+	float p = LOG_P0;
+	p = p * t + LOG_P1;
+	p = p * t + LOG_P2;
+	p = p * t + LOG_P3;
+	p = p * t + LOG_P4;
+	p = p * t + LOG_P5;
+	p = p * t + LOG_P6;
+	p = p * t + LOG_P7;
+	p = p * t + LOG_P8;
+	float y = t * t2 * p + e * LOG_LN2_LOW - 0.5f * t2;
+	return t + y + e * LOG_LN2_HIGH;
+}
+
+/// <summary>
+///     FastLog of count values, four at a time with NEON or SSE2 where available.
+/// </summary>
+static void FastLogs(const float* x, float* y, int count)
+{
+	int i = 0;
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+	const int32x4_t sqrtHalf = vdupq_n_s32(LOG_SQRT_HALF_BITS);
+	const int32x4_t mantissaMask = vdupq_n_s32(LOG_MANTISSA_MASK);
+	const float32x4_t one = vdupq_n_f32(1.0f);
+	for (; i + 4 <= count; i += 4) {
+		int32x4_t bits = vsubq_s32(vreinterpretq_s32_f32(vld1q_f32(x + i)), sqrtHalf);
+		float32x4_t e = vcvtq_f32_s32(vshrq_n_s32(bits, 23));
+		float32x4_t t = vsubq_f32(vreinterpretq_f32_s32(vaddq_s32(vandq_s32(bits, mantissaMask), sqrtHalf)), one);
+		float32x4_t t2 = vmulq_f32(t, t);
+		float32x4_t p = vdupq_n_f32(LOG_P0);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P1), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P2), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P3), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P4), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P5), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P6), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P7), p, t);
+		p = vmlaq_f32(vdupq_n_f32(LOG_P8), p, t);
+		float32x4_t r = vmlaq_f32(vmulq_n_f32(e, LOG_LN2_LOW), vmulq_f32(t, t2), p);
+		r = vmlsq_f32(r, t2, vdupq_n_f32(0.5f));
+		r = vmlaq_f32(vaddq_f32(t, r), e, vdupq_n_f32(LOG_LN2_HIGH));
+		vst1q_f32(y + i, r);
+	}
+#elif defined(__SSE2__)
+	const __m128i sqrtHalf = _mm_set1_epi32(LOG_SQRT_HALF_BITS);
+	const __m128i mantissaMask = _mm_set1_epi32(LOG_MANTISSA_MASK);
+	for (; i + 4 <= count; i += 4) {
+		__m128i bits = _mm_sub_epi32(_mm_castps_si128(_mm_loadu_ps(x + i)), sqrtHalf);
+		__m128 e = _mm_cvtepi32_ps(_mm_srai_epi32(bits, 23));
+		__m128 t = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(bits, mantissaMask), sqrtHalf)),
+			_mm_set1_ps(1.0f));
+		__m128 t2 = _mm_mul_ps(t, t);
+		__m128 p = _mm_set1_ps(LOG_P0);
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P1));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P2));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P3));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P4));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P5));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P6));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P7));
+		p = _mm_add_ps(_mm_mul_ps(p, t), _mm_set1_ps(LOG_P8));
+		__m128 r = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(t, t2), p), _mm_mul_ps(e, _mm_set1_ps(LOG_LN2_LOW)));
+		r = _mm_sub_ps(r, _mm_mul_ps(t2, _mm_set1_ps(0.5f)));
+		r = _mm_add_ps(_mm_add_ps(t, r), _mm_mul_ps(e, _mm_set1_ps(LOG_LN2_HIGH)));
+		_mm_storeu_ps(y + i, r);
+	}
+#endif
+	for (; i < count; ++i) {
+		y[i] = FastLog(x[i]);
+	}
+}
+
+void log_mel_filter(const float* input, float* output)
+{
+	float re[HALF_SIZE];
+	float im[HALF_SIZE];
+	for (int i = 0; i < HALF_SIZE; ++i) {
+		re[bitReverse[i]] = input[2 * i];
+		im[bitReverse[i]] = input[2 * i + 1];
+	}
+	Fft(re, im);
+	float magnitude[LOG_MEL_BINS];
+	SplitMagnitudes(re, im, magnitude);
+	float sums[LOG_MEL_FILTERS];
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		const float* bins = magnitude + filters[f].first_bin;
+		const float* weights = filterWeights + filters[f].offset;
+		float sum = 0;
+		for (int j = 0; j < filters[f].length; ++j) {
+			sum += bins[j] * weights[j];
+		}
+		sums[f] = sum + LOG_MEL_OFFSET;
+	}
+	FastLogs(sums, output, LOG_MEL_FILTERS);
+}
+
+// Fixed-point path. The samples are 32-bit values with Q30 twiddles. The values of each stage
+// share one exponent and are scaled down before the stage if they could reach BFP_LIMIT.
+// A butterfly grows a value by at most 1 + sqrt(2), so the results stay within 32 bits.
+#define BFP_LIMIT (1 << 29)
+
+/// <summary>
+///     Scales re and im down until the largest value is below BFP_LIMIT.
+/// </summary>
+/// <returns>Bits the values were shifted right by.</returns>
+static int NormalizeBlock(int32_t* re, int32_t* im, int count)
+{
+	// the OR of the magnitudes has the same highest bit as the largest one
+	int32_t bits = 0;
+	for (int i = 0; i < count; ++i) {
+		bits |= abs(re[i]) | abs(im[i]);
+	}
+	int shift = 0;
+	while ((bits >> shift) >= BFP_LIMIT) {
+		++shift;
+	}
+	if (shift > 0) {
+		int32_t round = 1 << (shift - 1);
+		for (int i = 0; i < count; ++i) {
+			re[i] = (re[i] + round) >> shift;
+			im[i] = (im[i] + round) >> shift;
+		}
+	}
+	return shift;
+}
+
+/// <summary>
+///     Multiplies a value by a Q30 one, leaving the product in Q30.
+/// </summary>
+static inline int64_t MultiplyQ30(int64_t value, int32_t q30)
+{
+	return value * q30;
+}
+
+/// <summary>
+///     Fixed-point version of Fft with block floating point.
+/// </summary>
+/// <returns>Bits the values were shifted right by.</returns>
+static int FftQ31(int32_t* restrict re, int32_t* restrict im)
+{
+	int exponent = 0;
+	for (int span = 1; span < HALF_SIZE; span *= 2) {
+		exponent += NormalizeBlock(re, im, HALF_SIZE);
+		const int32_t* wr = twiddleReQ30 + span - 1;
+		const int32_t* wi = twiddleImQ30 + span - 1;
+		for (int start = 0; start < HALF_SIZE; start += 2 * span) {
+			int32_t* ar = re + start;
+			int32_t* ai = im + start;
+			int32_t* br = ar + span;
+			int32_t* bi = ai + span;
+			for (int k = 0; k < span; ++k) {
+				int32_t tr = (int32_t)((MultiplyQ30(br[k], wr[k]) - MultiplyQ30(bi[k], wi[k]) + (1 << 29)) >> 30);
+				int32_t ti = (int32_t)((MultiplyQ30(bi[k], wr[k]) + MultiplyQ30(br[k], wi[k]) + (1 << 29)) >> 30);
+				br[k] = ar[k] - tr;
+				bi[k] = ai[k] - ti;
+				ar[k] += tr;
+				ai[k] += ti;
+			}
+		}
+	}
+	return exponent;
+}
+
+/// <summary>
+///     Square root to about 17 significant bits, by linear interpolation in sqrtTable.
+/// </summary>
+static uint32_t SquareRoot(uint64_t x)
+{
+	if (x == 0) {
+		return 0;
+	}
+	// shift by an even number of bits to [2^62, 2^64), which shifts the root by half as many
+	int shift = __builtin_clzll(x) & ~1;
+	x <<= shift;
+	uint32_t index = (uint32_t)(x >> 56) - 64;
+	uint32_t fraction = (uint32_t)(x >> 48) & 0xff;
+	// the root of x is the interpolated root of its top 16 bits times 2^24, which is 2^28 and
+	// one more bit than the table's Q27
+	uint64_t root = sqrtTable[index] + (((sqrtTable[index + 1] - sqrtTable[index]) * fraction) >> 8);
+	shift = shift / 2 - 1;
+	return (uint32_t)(shift >= 0 ? (root + (1u << shift >> 1)) >> shift : root << 1);
+}
+
+/// <summary>
+///     Base 2 logarithm in Q16, by linear interpolation in log2Table.
+/// </summary>
+static int32_t Log2Q16(uint64_t x)
+{
+	int bits = 63 - __builtin_clzll(x);
+	uint64_t normalized = x << (63 - bits);  // leading one at bit 63
+	uint32_t index = (uint32_t)(normalized >> 55) & 0xff;
+	int32_t fraction = (int32_t)(normalized >> 47) & 0xff;
+	return (bits << 16) + log2Table[index] + (((log2Table[index + 1] - log2Table[index]) * fraction) >> 8);
+}
+
+void log_mel_filter_pcm(const short* input, float* output)
+{
+	int32_t bits = 0;
+	for (int i = 0; i < LOG_MEL_FFT_SIZE; ++i) {
+		bits |= abs(input[i]);
+	}
+	if (bits == 0) {
+		for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+			output[f] = logf(LOG_MEL_OFFSET);
+		}
+		return;
+	}
+	// shift the largest sample to just below BFP_LIMIT. A float value is the fixed-point one
+	// times 2^exponent / 32768.
+	int exponent = 0;
+	while ((bits << -exponent) < BFP_LIMIT / 2) {
+		--exponent;
+	}
+	int32_t re[HALF_SIZE];
+	int32_t im[HALF_SIZE];
+	for (int i = 0; i < HALF_SIZE; ++i) {
+		re[bitReverse[i]] = input[2 * i] * (1 << -exponent);
+		im[bitReverse[i]] = input[2 * i + 1] * (1 << -exponent);
+	}
+	exponent += FftQ31(re, im);
+	exponent += NormalizeBlock(re, im, HALF_SIZE);
+
+	// as SplitMagnitudes, but for twice X to leave out the halving. The values are below
+	// BFP_LIMIT, so 2X is below 4 sqrt(2) BFP_LIMIT and its square fits 64 bits.
+	uint32_t magnitude[LOG_MEL_BINS];
+	for (int k = 0; k <= HALF_SIZE / 2; ++k) {
+		int mirror = (HALF_SIZE - k) & (HALF_SIZE - 1);
+		int64_t er = (int64_t)re[k] + re[mirror];
+		int64_t ei = (int64_t)im[k] - im[mirror];
+		int64_t or = (int64_t)im[k] + im[mirror];
+		int64_t oi = (int64_t)re[mirror] - re[k];
+		int64_t tr = (MultiplyQ30(or, splitReQ30[k]) - MultiplyQ30(oi, splitImQ30[k]) + (1 << 29)) >> 30;
+		int64_t ti = (MultiplyQ30(oi, splitReQ30[k]) + MultiplyQ30(or, splitImQ30[k]) + (1 << 29)) >> 30;
+		magnitude[k] = SquareRoot((uint64_t)((er + tr) * (er + tr)) + (uint64_t)((ei + ti) * (ei + ti)));
+		magnitude[HALF_SIZE - k] = SquareRoot((uint64_t)((er - tr) * (er - tr)) + (uint64_t)((ei - ti) * (ei - ti)));
+	}
+	exponent -= 1;
+
+	// a filter output in float is the sum times 2^(exponent - 30): 2^-15 for the weights and
+	// 2^-15 for the samples. Adding the offset in the same scale gives
+	// log(offset + output) = (log2(sum + offset * 2^(30 - exponent)) - (30 - exponent)) * ln(2).
+	int scale = 30 - exponent;
+	uint64_t offset = (uint64_t)ldexpf(LOG_MEL_OFFSET, scale);
+	const float q16ToLn = 0.69314718f / 65536.0f;
+	for (int f = 0; f < LOG_MEL_FILTERS; ++f) {
+		const uint32_t* bins = magnitude + filters[f].first_bin;
+		const uint16_t* weights = filterWeightsQ15 + filters[f].offset;
+		uint64_t sum = offset;
+		for (int j = 0; j < filters[f].length; ++j) {
+			sum += (uint64_t)bins[j] * weights[j];
+		}
+		output[f] = (float)(Log2Q16(sum) - (scale << 16)) * q16ToLn;
+	}
+}
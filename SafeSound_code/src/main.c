@@ -23,48 +23,157 @@
 #include "process_audio.h"
 #include "azure_iot.h"
 #include "event_utilities.h"
+#include "replay.h"
+#include "audio_history.h"
+#include "level_meter.h"
 
 // This application uses machine learning to classify audio continuously.
 
 // Forward declaration of functions
+static int OpenAudioSource(const char* spec);
 static int InitializeApp(const char* scopeID);
 static int InitPeripheralsAndHandlers(void);
 static void ClosePeripheralsAndHandlers(void);
 static void ButtonTimerEventHandler(EventData* eventData);
 static void AudioEventHandler(EventData* eventData);
+static bool ProcessNextFrame(int channel);
+static void RecordHistory(int channel);
+static void MeasureLevels(int channel);
 static void AzureTimerEventHandler(EventData* eventData);
-static void SimulateEvent(void);
-static void HandlePrediction(int prediction, float confidence);
+static void ClipUploadEventHandler(EventData* eventData);
+static void LevelReportEventHandler(EventData* eventData);
+static void ReplayEventHandler(EventData* eventData);
+static void StartClipUpload(int channel, unsigned char* clip, size_t size);
+static bool SimulateEvent(void);
+static void SimulateNextFrame(const FrameInfo* frameInfo);
+static void LogAudioStats(long elapsedSeconds);
+static void LogCaptureStats(long elapsedSeconds);
+static long WakeLatencyPercentileUs(const unsigned int* histogram, unsigned int total, float fraction);
+static void HandlePrediction(int channel, int prediction, float confidence,
+	const FrameInfo* onset, const FrameInfo* decision);
 static void TwinCallback(DEVICE_TWIN_UPDATE_STATE updateState, const unsigned char* payload,
 	size_t payloadSize, void* userContextCallback);
 static int DirectMethodCallback(const char* method_name, const unsigned char* payload,
 	size_t size, unsigned char** response, size_t* response_size, void* userContextCallback);
+static int StartReplay(const unsigned char* payload, size_t size);
+static void FinishReplayFile(bool replayed);
+static char* SerializeReplayResults(void);
+static char* SerializeCaptureStats(void);
 
 // File descriptors - initialized to invalid value
 static int buttonAGpioFd = -1;
 static int buttonPollTimerFd = -1;
 static int azureTimerFd = -1;
+static int clipUploadTimerFd = -1;
+static int levelReportTimerFd = -1;
+static int replayTimerFd = -1;
 static int epollFd = -1;
 
 // Button state variables
 static GPIO_Value_Type buttonState = GPIO_Value_High;
 
+/// <summary>
+/// Running totals of how the main loop works off the frames of one microphone. The counters
+/// only ever increase, so readers should take the difference between two snapshots.
+/// </summary>
+typedef struct DrainStats {
+	unsigned int wakeups;  // AudioEventHandler calls
+	unsigned int frames;  // frames taken from the buffer, classified or not
+	unsigned long long backlog;  // sum of the frames queued at each wakeup
+	unsigned int budget_exhausted;  // wakeups which left frames for the next one
+	unsigned int max_backlog;  // largest backlog at a wakeup
+} DrainStats;
+
+/// <summary>
+/// Detection pipeline of one microphone. eventData must stay the first member, so that
+/// AudioEventHandler can find the channel from the EventData it is called with.
+/// </summary>
+typedef struct AudioChannel {
+	EventData eventData;
+	AudioBuffer buffer;  // frames recorded from this microphone
+	PredictionState prediction_state;
+	ActivityDetector activity;  // skips quiet frames; its counters are cleared at each debug check
+	float min_frame_integrity;  // lowest frame capture integrity since the last debug check
+	unsigned int frames;  // frames classified since the last debug check
+	long long processing_ns;  // time spent on the classified frames, including the gate
+	long long skipped_ns;  // time the gate spent on the skipped frames
+	unsigned long long next_sequence;  // sequence number expected in the next frame
+	long long latency_ns;  // total capture-to-decision latency of the classified frames
+	long long max_latency_ns;  // largest capture-to-decision latency since the last debug check
+	AudioHistory history;  // compressed recent audio for event clips
+	AudioReader history_reader;  // feeds the history from the buffer, ahead of the classifier
+	long long history_ns;  // time spent encoding the history since the last debug check
+	const char* clip_event_type;  // event of the clip being recorded in history
+	struct timespec clip_event_time;
+	LevelMeter level;  // sound levels of the current report period
+	AudioReader level_reader;  // feeds the level meter from the buffer
+	long long level_ns;  // time spent metering since the last debug check
+	unsigned int level_blocks;  // blocks metered since the last debug check
+	DrainStats drain;  // main loop wakeups and backlog since startup
+	DrainStats last_drain;  // drain at the last debug check
+	unsigned int max_backlog;  // largest backlog at a wakeup since the last debug check
+} AudioChannel;
+
+/// <summary>
+/// Event clip being sent to the IoT Hub, one chunk per clipUploadPeriod.
+/// </summary>
+typedef struct ClipUpload {
+	unsigned char* data;  // mono IMA ADPCM WAV file, NULL when no clip is being sent
+	size_t size;
+	size_t sent;  // bytes already sent
+	unsigned int id;
+	int channel;
+	const char* event_type;
+	struct timespec event_time;
+} ClipUpload;
+
 // Audio variables
 const float confidenceThresh = 0.95f;
-AudioBuffer audioData;
+static AudioChannel audioChannels[MAX_AUDIO_CHANNELS];
+static AudioSource* audioSource = NULL;
+static int audioChannelCount = 0;  // channels of the open audio source, the only ones prepared
+static RecordAudioContext recordAudioContext;
 const short debugAudioPeriod = 5;  // print debug info every 5 seconds
 const short unsigned maxPredictionCooloff = 3600;  // 3600 seconds = 1 hour
 static short unsigned predictionCooloff = 5;  // only allow a prediction every 5 seconds
 static struct timespec lastDebugCheck, lastPredictionTime;
-static bool usePrerecorded = false;  // Specifies whether to use prerecorded audio
+static CaptureStats lastCaptureStats;  // capture stats at the last debug check
+static float frameClassificationNs = 0;  // latest average time to classify a frame
+static bool simulatingEvent = false;  // Specifies whether to classify the prerecorded clip with channel 0 (holds the classifier)
+static PredictionState simulationState;  // prediction smoothing of the prerecorded clip
+static unsigned int audioQueueDepth = AUDIO_QUEUE_DEPTH;  // applied to every AudioBuffer
+static AudioOverloadPolicy audioOverloadPolicy = AUDIO_OVERLOAD_POLICY;  // applied to every AudioBuffer
+// device twin and log names of the overload policies, in AudioOverloadPolicy order
+static const char* const overloadPolicyNames[AudioOverload_Count] = { "dropOldest", "dropNewest", "decimate" };
+// one CLIP_CHUNK_BYTES chunk is sent per period, which caps the bandwidth of event clips
+static const struct timespec clipUploadPeriod = { 1, 0 };
+static ClipUpload clipUpload;
+
+/// <summary>
+/// WAV files being replayed through the detection pipeline, one step per replayTimerFd expiry.
+/// </summary>
+typedef struct ReplayQueue {
+	JSON_Value* request;  // {"files":[...]} of the running replay, NULL when none is running
+	JSON_Array* files;
+	size_t next_file;  // index in files of the next file to open
+	JSON_Value* results;  // array with the results of the files replayed so far
+	Replay replay;  // replay of the current file
+	AudioSource* source;  // source of the current file, NULL between files
+} ReplayQueue;
+
+static ReplayQueue replayQueue;
+static const struct timespec replayStepPeriod = { 0, REPLAY_STEP_PERIOD_MS * 1000000 };
+static const struct timespec timerStopped = { 0, 0 };
 
 // General settings variables
 static bool isArmed = true;  // Whether a new event should be reported
 
 // Event handler data structures. Only the event handler field needs to be populated.
 static EventData buttonEventData = { .eventHandler = &ButtonTimerEventHandler };
-static EventData audioEventData = { .eventHandler = &AudioEventHandler };
 static EventData azureEventData = { .eventHandler = &AzureTimerEventHandler };
+static EventData clipUploadEventData = { .eventHandler = &ClipUploadEventHandler };
+static EventData levelReportEventData = { .eventHandler = &LevelReportEventHandler };
+static EventData replayEventData = { .eventHandler = &ReplayEventHandler };
 
 /// <summary>
 ///     Main entry point for this application.
@@ -74,20 +183,32 @@ int main(int argc, char* argv[])
 	pthread_t tid;
 	Log_Debug("INFO: Application starting.\n");
 
-	if (argc != 2) {
+	if (argc < 2 || argc > 3) {
 		Log_Debug("ERROR: ScopeID needs to be set in the app_manifest CmdArgs\n");
 		return -1;
 	}
 
-	if (InitializeApp(argv[1]) < 0) {
+	// The optional second argument selects the audio source, see audio_source_create()
+	const char* audioSourceSpec = (argc == 3) ? argv[2] : "adc";
+	if (OpenAudioSource(audioSourceSpec) < 0 || InitializeApp(argv[1]) < 0) {
 		terminationRequired = true;
 	}
 
 	// Start audio recording thread
-	if (!terminationRequired
-		&& pthread_create(&tid, NULL, RecordAudioThread, (void*)&audioData) != 0) {
-		Log_Debug("ERROR: Microphone record thread creation failed.");
-		terminationRequired = true;
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		recordAudioContext.buffers[channel] = &audioChannels[channel].buffer;
+	}
+	recordAudioContext.buffer_count = audioChannelCount;
+	recordAudioContext.source = audioSource;
+	bool threadStarted = false;
+	if (!terminationRequired) {
+		if (pthread_create(&tid, NULL, RecordAudioThread, (void*)&recordAudioContext) != 0) {
+			Log_Debug("ERROR: Microphone record thread creation failed.");
+			terminationRequired = true;
+		}
+		else {
+			threadStarted = true;
+		}
 	}
 
 	// Use epoll to wait for events and trigger handlers, until an error or SIGTERM happens
@@ -97,7 +218,18 @@ int main(int argc, char* argv[])
 
 	ClosePeripheralsAndHandlers();
 	// Wait for audio recording thread to finish
-	pthread_join(tid, NULL);
+	if (threadStarted) {
+		pthread_join(tid, NULL);
+	}
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		free_audio_buffer(&audioChannels[channel].buffer);
+		audio_history_free(&audioChannels[channel].history);
+	}
+	free(clipUpload.data);
+	if (audioSource != NULL) {
+		audioSource->close(audioSource);
+		audio_source_destroy(audioSource);
+	}
 	Log_Debug("INFO: Application exiting.\n");
 	return 0;
 }
@@ -111,6 +243,32 @@ static void TerminationHandler(int signalNumber)
 	terminationRequired = true;
 }
 
+/// <summary>
+///     Creates and opens the audio source, which tells how many microphones there are.
+/// </summary>
+/// <param name="spec">Audio source specification, see audio_source_create.</param>
+/// <returns>0 on success, -1 on failure</returns>
+static int OpenAudioSource(const char* spec)
+{
+	if ((audioSource = audio_source_create(spec)) == NULL) {
+		Log_Debug("ERROR: Failed to create audio source '%s'.\n", spec);
+		return -1;
+	}
+	Log_Debug("INFO: Opening audio source '%s'.\n", audioSource->name);
+	if (audioSource->open(audioSource) != 0) {
+		audio_source_destroy(audioSource);
+		audioSource = NULL;
+		return -1;
+	}
+	if (audioSource->channels < 1 || audioSource->channels > MAX_AUDIO_CHANNELS) {
+		Log_Debug("ERROR: Audio source delivers %d channels, expecting 1 to %d.\n", audioSource->channels,
+			MAX_AUDIO_CHANNELS);
+		return -1;
+	}
+	audioChannelCount = audioSource->channels;
+	return 0;
+}
+
 ///	<summary>
 ///		Initializes audio buffers, prediction models, event history and peripherals.
 ///	</summary>
@@ -119,10 +277,30 @@ static int InitializeApp(const char* scopeID)
 {
 	initialize_hub_client(scopeID);
 
-	if (!initialize_audio_buffer(&audioData)) {
-		Log_Debug("ERROR: Failed to initialize the audio buffer.\n");
-		return -1;
+	// only the channels of the audio source are prepared
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		audioChannels[channel].buffer.dataAvailableFd = -1;
+	}
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		AudioChannel* audioChannel = &audioChannels[channel];
+		audioChannel->eventData.eventHandler = &AudioEventHandler;
+		audioChannel->prediction_state.overall_inverse_confidence = 1.0f;
+		activity_detector_init(&audioChannel->activity);
+		audioChannel->min_frame_integrity = 1.0f;
+		audio_history_init(&audioChannel->history);
+		if (!initialize_audio_buffer(&audioChannel->buffer)) {
+			Log_Debug("ERROR: Failed to initialize the audio buffer.\n");
+			return -1;
+		}
+		audio_reader_init(&audioChannel->buffer, &audioChannel->history_reader);
+		audio_reader_init(&audioChannel->buffer, &audioChannel->level_reader);
+		level_meter_init(&audioChannel->level);
 	}
+	Log_Debug("INFO: %d-sample frames every %d samples, audio ring of %d samples per microphone %s.\n",
+		AUDIO_FRAME_SIZE, AUDIO_HOP_SIZE, AUDIO_RING_SAMPLES,
+		audioChannels[0].buffer.mirrored ? "mapped twice" : "mirrored by copying");
+	Log_Debug("INFO: Event clips of %d s before and %d s after, %d bytes of audio history for each of %d microphones.\n",
+		AUDIO_SNAPSHOT_PRE_SECONDS, AUDIO_SNAPSHOT_POST_SECONDS, AUDIO_HISTORY_BYTES, audioChannelCount);
 
 	if (!check_predict_setup()) {
 		Log_Debug("ERROR: Prediction setup failed.\n");
@@ -136,6 +314,14 @@ static int InitializeApp(const char* scopeID)
 		return -1;
 	}
 
+	// Replays are worked off in steps, so that they do not hold up the other events. The timer
+	// only runs while a replay is queued.
+	replayTimerFd =
+		CreateTimerFdAndAddToEpoll(epollFd, &timerStopped, &replayEventData, EPOLLIN);
+	if (replayTimerFd < 0) {
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -170,13 +356,18 @@ static int InitPeripheralsAndHandlers(void)
 		return -1;
 	}
 
-	// Register the file descriptor which specifies if there is new audio data to process
+	// Register the file descriptors which specify if there is new audio data to process.
+	// Each channel has its own level-triggered eventfd and each wakeup classifies at most
+	// AUDIO_DRAIN_BUDGET frames, so epoll takes ready channels in turn and no microphone can
+	// starve the others.
 	clock_gettime(CLOCK_REALTIME, &lastDebugCheck);
 	clock_gettime(CLOCK_REALTIME, &lastPredictionTime);
-	int result = RegisterEventHandlerToEpoll(
-		epollFd, audioData.dataAvailableFd, &audioEventData, EPOLLIN);
-	if (result < 0) {
-		return -1;
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		int result = RegisterEventHandlerToEpoll(epollFd,
+			audioChannels[channel].buffer.dataAvailableFd, &audioChannels[channel].eventData, EPOLLIN);
+		if (result < 0) {
+			return -1;
+		}
 	}
 
 	// Register Azure IoT Hub update handler which is called periodically
@@ -187,6 +378,21 @@ static int InitPeripheralsAndHandlers(void)
 		return -1;
 	}
 
+	// Send event clips in chunks, at most one per period
+	clipUploadTimerFd =
+		CreateTimerFdAndAddToEpoll(epollFd, &clipUploadPeriod, &clipUploadEventData, EPOLLIN);
+	if (clipUploadTimerFd < 0) {
+		return -1;
+	}
+
+	// Summarize the sound levels of each microphone once per report period
+	struct timespec levelReportPeriod = { LEVEL_REPORT_SECONDS, 0 };
+	levelReportTimerFd =
+		CreateTimerFdAndAddToEpoll(epollFd, &levelReportPeriod, &levelReportEventData, EPOLLIN);
+	if (levelReportTimerFd < 0) {
+		return -1;
+	}
+
 	return 0;
 }
 
@@ -196,10 +402,19 @@ static int InitPeripheralsAndHandlers(void)
 static void ClosePeripheralsAndHandlers(void)
 {
 	Log_Debug("INFO: Closing file descriptors.\n");
+	if (replayQueue.source != NULL) {
+		replay_close(&replayQueue.replay);
+		audio_source_destroy(replayQueue.source);
+	}
 	CloseFdAndPrintError(azureTimerFd, "AzureTimer");
+	CloseFdAndPrintError(clipUploadTimerFd, "ClipUploadTimer");
+	CloseFdAndPrintError(levelReportTimerFd, "LevelReportTimer");
+	CloseFdAndPrintError(replayTimerFd, "ReplayTimer");
 	CloseFdAndPrintError(buttonPollTimerFd, "ButtonPollTimer");
 	CloseFdAndPrintError(buttonAGpioFd, "ButtonAGPIO");
-	CloseFdAndPrintError(audioData.dataAvailableFd, "AudioDataAvailable");
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		CloseFdAndPrintError(audioChannels[channel].buffer.dataAvailableFd, "AudioDataAvailable");
+	}
 	CloseFdAndPrintError(epollFd, "Epoll");
 }
 
@@ -233,11 +448,15 @@ static void ButtonTimerEventHandler(EventData* eventData)
 }
 
 /// <summary>
-///     Handle new audio event: a new audio frame has been recorded so process it.
+///     Handle new audio event: new audio frames have been recorded on one of the microphones
+///     so process up to AUDIO_DRAIN_BUDGET of them. All channels share the featurizer and
+///     classifier, which classifies one active microphone at a time, see PredictionState.
 /// </summary>
 static void AudioEventHandler(EventData* eventData)
 {
-	if (ConsumeTimerFdEvent(audioData.dataAvailableFd) != 0) {
+	AudioChannel* audioChannel = (AudioChannel*)eventData;
+	int channel = (int)(audioChannel - audioChannels);
+	if (ConsumeTimerFdEvent(audioChannel->buffer.dataAvailableFd) != 0) {
 		terminationRequired = true;
 		return;
 	}
@@ -246,36 +465,322 @@ static void AudioEventHandler(EventData* eventData)
 	struct timespec currentTime;
 	clock_gettime(CLOCK_REALTIME, &currentTime);
 	if (currentTime.tv_sec - lastDebugCheck.tv_sec > debugAudioPeriod) {
-		if (audioData.dropped_frames > 0) {
-			Log_Debug("WARNING: Dropped %d frames in last %d seconds.\n",
-				audioData.dropped_frames, currentTime.tv_sec - lastDebugCheck.tv_sec);
-			audioData.dropped_frames = 0;
-		}
+		LogAudioStats(currentTime.tv_sec - lastDebugCheck.tv_sec);
 		lastDebugCheck = currentTime;
 	}
 
-	// Read the next frame of data
-	float featurizer_input[AUDIO_FRAME_SIZE];
-	bool readResult = read_audio_buffer(&audioData, featurizer_input, AUDIO_FRAME_SIZE);
-	if (usePrerecorded) {
-		usePrerecorded = prepare_prerecorded(featurizer_input);
-		if (!usePrerecorded) {
-			predict_reset();
+	// The readers stay at or ahead of the classifier, so their frames are never overwritten
+	RecordHistory(channel);
+	MeasureLevels(channel);
+
+	// Drain the frames queued since the last wakeup, up to the budget
+	DrainStats* drain = &audioChannel->drain;
+	unsigned int backlog = audio_buffer_queued_frames(&audioChannel->buffer);
+	++drain->wakeups;
+	drain->backlog += backlog;
+	if (backlog > drain->max_backlog) {
+		drain->max_backlog = backlog;
+	}
+	if (backlog > audioChannel->max_backlog) {
+		audioChannel->max_backlog = backlog;
+	}
+	int handled = 0;
+	while (handled < AUDIO_DRAIN_BUDGET && ProcessNextFrame(channel)) {
+		++handled;
+	}
+	drain->frames += (unsigned int)handled;
+	if (handled == AUDIO_DRAIN_BUDGET && audio_buffer_queued_frames(&audioChannel->buffer) > 0) {
+		// let the other events in, then come back for the rest
+		++drain->budget_exhausted;
+		uint64_t increment_one = 1;
+		if (write(audioChannel->buffer.dataAvailableFd, &increment_one, sizeof(increment_one)) < 0) {
+			Log_Debug("ERROR: Could not rearm the audio eventfd: %s (%d).\n", strerror(errno), errno);
+			terminationRequired = true;
 		}
 	}
-	else if (!readResult) {
-		// no data to read
-		return;
+}
+
+/// <summary>
+///     Appends the samples each new frame of a microphone adds to its history, and starts the
+///     upload of a clip once its post-roll has been recorded.
+/// </summary>
+/// <param name="channel">Microphone to record.</param>
+static void RecordHistory(int channel)
+{
+	AudioChannel* audioChannel = &audioChannels[channel];
+	struct timespec historyStart, historyEnd;
+	clock_gettime(CLOCK_MONOTONIC, &historyStart);
+	const short* frame;
+	const FrameInfo* frameInfo;
+	while ((frame = acquire_reader_slot(&audioChannel->buffer, &audioChannel->history_reader, &frameInfo)) != NULL) {
+		// the new hop is the end of the frame, captured after the rest of it
+		long long hopNs = (frameInfo->capture_realtime.tv_sec * 1000000000LL + frameInfo->capture_realtime.tv_nsec)
+			+ (long long)(AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE) * 1000000000LL / AUDIO_SAMPLE_RATE;
+		struct timespec hopTime = { (time_t)(hopNs / 1000000000LL), (long)(hopNs % 1000000000LL) };
+		audio_history_append(&audioChannel->history, frame + AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE,
+			AUDIO_HOP_SIZE, &hopTime);
+		release_reader_slot(&audioChannel->buffer, &audioChannel->history_reader);
 	}
+	clock_gettime(CLOCK_MONOTONIC, &historyEnd);
+	audioChannel->history_ns += (historyEnd.tv_sec - historyStart.tv_sec) * 1000000000LL
+		+ (historyEnd.tv_nsec - historyStart.tv_nsec);
+	size_t clipSize;
+	unsigned char* clip = audio_history_take_clip(&audioChannel->history, &clipSize);
+	if (clip != NULL) {
+		StartClipUpload(channel, clip, clipSize);
+	}
+}
+
+/// <summary>
+///     Adds the samples each new frame of a microphone adds to its sound level meter.
+/// </summary>
+/// <param name="channel">Microphone to measure.</param>
+static void MeasureLevels(int channel)
+{
+	AudioChannel* audioChannel = &audioChannels[channel];
+	struct timespec levelStart, levelEnd;
+	clock_gettime(CLOCK_MONOTONIC, &levelStart);
+	const short* frame;
+	while ((frame = acquire_reader_slot(&audioChannel->buffer, &audioChannel->level_reader, NULL)) != NULL) {
+		level_meter_process(&audioChannel->level, frame + AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE,
+			AUDIO_HOP_SIZE);
+		++audioChannel->level_blocks;
+		release_reader_slot(&audioChannel->buffer, &audioChannel->level_reader);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &levelEnd);
+	audioChannel->level_ns += (levelEnd.tv_sec - levelStart.tv_sec) * 1000000000LL
+		+ (levelEnd.tv_nsec - levelStart.tv_nsec);
+}
 
+/// <summary>
+///     Classifies the next queued frame of a microphone.
+/// </summary>
+/// <param name="channel">Microphone to take the frame from.</param>
+/// <returns>True if a frame was processed, false if none is queued.</returns>
+static bool ProcessNextFrame(int channel)
+{
+	AudioChannel* audioChannel = &audioChannels[channel];
+
+	// Read the next frame of data in place, the slot stays ours until it is released
+	const FrameInfo* slotInfo;
+	const short* audio_frame = acquire_read_slot(&audioChannel->buffer, &slotInfo);
+	if (audio_frame == NULL) {
+		// no data to read
+		return false;
+	}
+	FrameInfo frameInfo = *slotInfo;  // sequence number, capture time and filled-in samples of the frame
+	float frameIntegrity = frame_integrity(&frameInfo);
+	if (frameIntegrity < audioChannel->min_frame_integrity) {
+		audioChannel->min_frame_integrity = frameIntegrity;
+	}
+	if (frameInfo.sequence != audioChannel->next_sequence) {
+		Log_Debug("WARNING: Microphone %d lost frames %llu to %llu, audio resumes at %lld.%03ld.\n",
+			channel, audioChannel->next_sequence, frameInfo.sequence - 1,
+			(long long)frameInfo.capture_realtime.tv_sec, frameInfo.capture_realtime.tv_nsec / 1000000);
+	}
+	audioChannel->next_sequence = frameInfo.sequence + 1;
 	int prediction;  // prediction category (0 - num_categories)
-	float confidence;  // confidence in prediction (0.0 - 1.0)
-	predict_single_frame(featurizer_input, &prediction, &confidence);
-	float overall_confidence = smooth_prediction(prediction, confidence);
+	float overall_confidence;  // smoothed confidence in prediction (0.0 - 1.0)
+	struct timespec start, end;
+	bool decimate = audioOverloadPolicy == AudioOverload_Decimate
+		&& audio_buffer_overloaded(&audioChannel->buffer);
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	int classified = predict_active_frame(&audioChannel->activity, &audioChannel->prediction_state,
+		audio_frame, &frameInfo, decimate, &prediction, &overall_confidence);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	release_read_slot(&audioChannel->buffer);
+	long long elapsedNs = (end.tv_sec - start.tv_sec) * 1000000000LL + (end.tv_nsec - start.tv_nsec);
+	if (classified > 0) {
+		audioChannel->frames += (unsigned int)classified;
+		audioChannel->processing_ns += elapsedNs;
+		// from the first sample of the frame to its prediction
+		long long latencyNs = (end.tv_sec - frameInfo.capture_time.tv_sec) * 1000000000LL
+			+ (end.tv_nsec - frameInfo.capture_time.tv_nsec);
+		audioChannel->latency_ns += latencyNs;
+		if (latencyNs > audioChannel->max_latency_ns) {
+			audioChannel->max_latency_ns = latencyNs;
+		}
+	}
+	else if (audioChannel->prediction_state.decimated) {
+		atomic_fetch_add_explicit(&audioChannel->buffer.overload_frames[AudioOverload_Decimate], 1,
+			memory_order_relaxed);
+	}
+	else {
+		audioChannel->skipped_ns += elapsedNs;
+	}
 	if (overall_confidence > confidenceThresh) {
 		// call prediction handler
-		HandlePrediction(prediction, overall_confidence);
+		HandlePrediction(channel, prediction, overall_confidence,
+			&audioChannel->prediction_state.onset, &frameInfo);
+	}
+	if (simulatingEvent && channel == 0) {
+		SimulateNextFrame(&frameInfo);
+	}
+	return true;
+}
+
+/// <summary>
+///		Prints the dropped frames, filled-in samples, skipped frames, backlog and classification time
+///		of each microphone, and the share of real time the classifier was busy.
+/// </summary>
+/// <param name="elapsedSeconds">Seconds since the last call.</param>
+static void LogAudioStats(long elapsedSeconds)
+{
+	unsigned int totalFrames = 0;
+	long long totalProcessingNs = 0;
+	int classifiedChannels = 0;
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		AudioChannel* audioChannel = &audioChannels[channel];
+		// the capture thread keeps counting, so take each count and clear it in one step
+		unsigned int droppedFrames = atomic_exchange_explicit(&audioChannel->buffer.dropped_frames, 0,
+			memory_order_relaxed);
+		if (droppedFrames > 0) {
+			Log_Debug("WARNING: Microphone %d dropped %u frames in last %ld seconds.\n", channel,
+				droppedFrames, elapsedSeconds);
+		}
+		unsigned int gapSamples = atomic_exchange_explicit(&audioChannel->buffer.gap_samples_total, 0,
+			memory_order_relaxed);
+		if (gapSamples > 0) {
+			Log_Debug("WARNING: Microphone %d filled in %u missed samples in last %ld seconds, lowest frame integrity %.3f.\n",
+				channel, gapSamples, elapsedSeconds, audioChannel->min_frame_integrity);
+		}
+		for (int policy = 0; policy < AudioOverload_Count; ++policy) {
+			unsigned int overloadFrames = atomic_exchange_explicit(
+				&audioChannel->buffer.overload_frames[policy], 0, memory_order_relaxed);
+			if (overloadFrames > 0) {
+				Log_Debug("WARNING: Microphone %d overloaded, %s applied to %u frames in last %ld seconds.\n",
+					channel, overloadPolicyNames[policy], overloadFrames, elapsedSeconds);
+			}
+		}
+		audioChannel->min_frame_integrity = 1.0f;
+		if (audioChannel->prediction_state.excluded_frames > 0) {
+			Log_Debug("INFO: Microphone %d: %u active frames not classified in last %ld seconds, another stream had the classifier.\n",
+				channel, audioChannel->prediction_state.excluded_frames, elapsedSeconds);
+			audioChannel->prediction_state.excluded_frames = 0;
+		}
+		if (audioChannel->frames > 0) {
+			Log_Debug("INFO: Microphone %d: %u frames, %.2f ms classification per frame, capture-to-decision latency %.1f ms average, %.1f ms max.\n",
+				channel, audioChannel->frames,
+				(float)audioChannel->processing_ns / 1000000.0f / audioChannel->frames,
+				(float)audioChannel->latency_ns / 1000000.0f / audioChannel->frames,
+				(float)audioChannel->max_latency_ns / 1000000.0f);
+			totalFrames += audioChannel->frames;
+			totalProcessingNs += audioChannel->processing_ns;
+			++classifiedChannels;
+		}
+		DrainStats drain = audioChannel->drain;
+		unsigned int wakeups = drain.wakeups - audioChannel->last_drain.wakeups;
+		if (wakeups > 0) {
+			Log_Debug("INFO: Microphone %d: %.2f frames per wakeup, backlog %.2f frames average, %u max, budget of %d reached %u times.\n",
+				channel, (float)(drain.frames - audioChannel->last_drain.frames) / wakeups,
+				(float)(drain.backlog - audioChannel->last_drain.backlog) / wakeups,
+				audioChannel->max_backlog, AUDIO_DRAIN_BUDGET,
+				drain.budget_exhausted - audioChannel->last_drain.budget_exhausted);
+		}
+		audioChannel->last_drain = drain;
+		audioChannel->max_backlog = 0;
+		if (audioChannel->history_reader.skipped_frames > 0) {
+			Log_Debug("WARNING: Microphone %d: audio history missed %u frames in last %ld seconds.\n",
+				channel, audioChannel->history_reader.skipped_frames, elapsedSeconds);
+			audioChannel->history_reader.skipped_frames = 0;
+		}
+		if (audioChannel->history_ns > 0) {
+			Log_Debug("INFO: Microphone %d: audio history encoding %.3f ms CPU per second.\n",
+				channel, (float)audioChannel->history_ns / 1000000.0f / elapsedSeconds);
+		}
+		audioChannel->history_ns = 0;
+		if (audioChannel->level_blocks > 0) {
+			Log_Debug("INFO: Microphone %d: level meter %.2f us per hop.\n", channel,
+				(float)audioChannel->level_ns / 1000.0f / audioChannel->level_blocks);
+		}
+		audioChannel->level_ns = 0;
+		audioChannel->level_blocks = 0;
+		audioChannel->frames = 0;
+		audioChannel->processing_ns = 0;
+		audioChannel->latency_ns = 0;
+		audioChannel->max_latency_ns = 0;
+	}
+	if (totalFrames > 0 && totalProcessingNs > 0) {
+		frameClassificationNs = (float)totalProcessingNs / totalFrames;
+	}
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		AudioChannel* audioChannel = &audioChannels[channel];
+		ActivityDetector* activity = &audioChannel->activity;
+		if (activity->frames > 0) {
+			// a skipped frame saves a classification, less the time the gate took to skip it
+			float savedNs = activity->skipped_frames * frameClassificationNs - audioChannel->skipped_ns;
+			Log_Debug("INFO: Microphone %d: skipped %.1f%% of frames, saving %.1f ms CPU per second.\n",
+				channel, 100.0f * activity->skipped_frames / activity->frames,
+				savedNs / 1000000.0f / elapsedSeconds);
+		}
+		activity->frames = 0;
+		activity->skipped_frames = 0;
+		audioChannel->skipped_ns = 0;
+	}
+	if (totalFrames > 0 && elapsedSeconds > 0) {
+		// the microphones take turns at the classifier, so only the frames it actually
+		// classified count, whichever microphone they came from
+		Log_Debug("INFO: Classifier busy %.1f%% of real time with %u frames from %d microphones.\n",
+			100.0f * totalProcessingNs / 1000000000.0f / elapsedSeconds, totalFrames, classifiedChannels);
+	}
+	LogCaptureStats(elapsedSeconds);
+}
+
+/// <summary>
+///		Prints the capture thread wakeup rate and the CPU time it spends per second of audio.
+/// </summary>
+/// <param name="elapsedSeconds">Seconds since the last call.</param>
+static void LogCaptureStats(long elapsedSeconds)
+{
+	CaptureStats stats = recordAudioContext.stats;
+	CaptureStats previous = lastCaptureStats;
+	unsigned int wakeups = stats.wakeups - previous.wakeups;
+	unsigned int samples = stats.samples - previous.samples;
+	long long cpuNs = stats.cpu_ns - previous.cpu_ns;
+	long long resampleNs = stats.resample_ns - previous.resample_ns;
+	lastCaptureStats = stats;
+	if (elapsedSeconds <= 0 || samples == 0) {
+		return;
+	}
+	float audioSeconds = (float)samples / AUDIO_SAMPLE_RATE;
+	Log_Debug("INFO: Capture block %d: %ld wakeups/s, %.2f ms CPU per second of audio.\n",
+		stats.block_size, wakeups / elapsedSeconds, (float)cpuNs / 1000000.0f / audioSeconds);
+	Log_Debug("INFO: Capture rate %.1f Hz, %u samples lost to late wakeups, resampling %.2f ms per second of audio.\n",
+		stats.input_rate, stats.lost_samples - previous.lost_samples,
+		(float)resampleNs / 1000000.0f / audioSeconds);
+
+	unsigned int latency[CAPTURE_LATENCY_BUCKETS];
+	unsigned int timedWakeups = 0;
+	for (int i = 0; i < CAPTURE_LATENCY_BUCKETS; ++i) {
+		latency[i] = stats.wake_latency[i] - previous.wake_latency[i];
+		timedWakeups += latency[i];
 	}
+	Log_Debug("INFO: Capture wake lateness%s: p50 < %ld us, p99 < %ld us, p99.9 < %ld us, max %lld us.\n",
+		stats.realtime ? " (real-time)" : "",
+		WakeLatencyPercentileUs(latency, timedWakeups, 0.5f),
+		WakeLatencyPercentileUs(latency, timedWakeups, 0.99f),
+		WakeLatencyPercentileUs(latency, timedWakeups, 0.999f),
+		stats.max_wake_latency_ns / 1000);
+}
+
+/// <summary>
+///		Finds the wake lateness which a fraction of the wakeups in a histogram stayed below.
+/// </summary>
+/// <param name="histogram">CAPTURE_LATENCY_BUCKETS wakeup counts, see CaptureStats.</param>
+/// <param name="total">Sum of the counts.</param>
+/// <param name="fraction">Fraction of the wakeups (0 - 1).</param>
+/// <returns>Upper edge in microseconds of the bucket containing the percentile, or -1 if it
+/// is in the last, unbounded bucket.</returns>
+static long WakeLatencyPercentileUs(const unsigned int* histogram, unsigned int total, float fraction)
+{
+	unsigned int count = 0;
+	for (int i = 0; i < CAPTURE_LATENCY_BUCKETS - 1; ++i) {
+		count += histogram[i];
+		if (count >= fraction * total) {
+			return 1L << i;
+		}
+	}
+	return -1;
 }
 
 /// <summary>
@@ -291,37 +796,174 @@ static void AzureTimerEventHandler(EventData* eventData)
 	iot_hub_update(TwinCallback, DirectMethodCallback);
 }
 
+/// <summary>
+///		Queues an event clip for upload. Only one clip is sent at a time, so a clip which is
+///		ready while another one is being sent is discarded.
+/// </summary>
+/// <param name="channel">Microphone the clip was recorded from.</param>
+/// <param name="clip">Clip from audio_history_take_clip, freed once sent.</param>
+/// <param name="size">Size of the clip in bytes.</param>
+static void StartClipUpload(int channel, unsigned char* clip, size_t size)
+{
+	if (clipUpload.data != NULL) {
+		Log_Debug("WARNING: Discarding the clip of microphone %d, clip %u is still being sent.\n",
+			channel, clipUpload.id);
+		free(clip);
+		return;
+	}
+	clipUpload.data = clip;
+	clipUpload.size = size;
+	clipUpload.sent = 0;
+	++clipUpload.id;
+	clipUpload.channel = channel;
+	clipUpload.event_type = audioChannels[channel].clip_event_type;
+	clipUpload.event_time = audioChannels[channel].clip_event_time;
+	Log_Debug("INFO: Sending clip %u of %zu bytes from microphone %d.\n", clipUpload.id, size,
+		channel);
+}
+
+/// <summary>
+///		Clip upload timer event: sends the next chunk of the event clip, if there is one and
+///		the IoT Hub is connected. A chunk whose message cannot be built ends the upload.
+/// </summary>
+static void ClipUploadEventHandler(EventData* eventData)
+{
+	if (ConsumeTimerFdEvent(clipUploadTimerFd) != 0) {
+		terminationRequired = true;
+		return;
+	}
+	if (clipUpload.data == NULL || !is_hub_authenticated()) {
+		return;
+	}
+
+	static char clipMessage[CLIP_MESSAGE_SIZE];
+	size_t chunkSize = clipUpload.size - clipUpload.sent;
+	if (chunkSize > CLIP_CHUNK_BYTES) {
+		chunkSize = CLIP_CHUNK_BYTES;
+	}
+	unsigned int chunkCount = (unsigned int)((clipUpload.size + CLIP_CHUNK_BYTES - 1) / CLIP_CHUNK_BYTES);
+	if (construct_clip_chunk_message(clipMessage, sizeof(clipMessage), clipUpload.id,
+		clipUpload.event_type, &clipUpload.event_time, clipUpload.channel,
+		(unsigned int)(clipUpload.sent / CLIP_CHUNK_BYTES), chunkCount,
+		clipUpload.data + clipUpload.sent, chunkSize)) {
+		send_telemetry(clipMessage);
+		clipUpload.sent += chunkSize;
+	}
+	else {
+		// the message does not fit its buffer, which would not change on a retry, and the clip
+		// cannot be reassembled with a chunk missing
+		Log_Debug("ERROR: Could not build chunk %u of clip %u, the rest of the clip is discarded.\n",
+			(unsigned int)(clipUpload.sent / CLIP_CHUNK_BYTES), clipUpload.id);
+		clipUpload.sent = clipUpload.size;
+	}
+	if (clipUpload.sent == clipUpload.size) {
+		free(clipUpload.data);
+		clipUpload.data = NULL;
+	}
+}
 
 /// <summary>
-///		Simulates an event by feeding the prerecorded audio into the classifier.
+///		Level report timer event: sends a summary of the sound levels of each microphone over
+///		the last LEVEL_REPORT_SECONDS, so that installations can be compared and false alarms
+///		put into context.
 /// </summary>
-static void SimulateEvent(void)
+static void LevelReportEventHandler(EventData* eventData)
 {
+	if (ConsumeTimerFdEvent(levelReportTimerFd) != 0) {
+		terminationRequired = true;
+		return;
+	}
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		LevelSummary summary;
+		if (!level_meter_summarize(&audioChannels[channel].level, &summary)) {
+			// the microphone is not in use
+			continue;
+		}
+		char levelMessage[LEVEL_MESSAGE_SIZE];
+		if (construct_level_message(levelMessage, sizeof(levelMessage), channel, &now,
+			LEVEL_REPORT_SECONDS, &summary)) {
+			send_telemetry(levelMessage);
+		}
+	}
+}
+
+/// <summary>
+///		Simulates an event by classifying the prerecorded clip as if microphone 0 had heard it,
+///		one frame for each frame of microphone 0. The features of the clip are precomputed by
+///		tools/generate_prerecorded_features.py, so the simulation only runs the classifier. It
+///		holds the classifier until the clip ends, so no microphone is classified meanwhile.
+/// </summary>
+/// <returns>True if the simulation started, false if a replay holds the classifier.</returns>
+static bool SimulateEvent(void)
+{
+	// a replay lets go of the classifier between its files
+	if (replayQueue.request != NULL || !predict_hold(&simulationState)) {
+		Log_Debug("WARNING: Cannot simulate an event while files are replayed.\n");
+		return false;
+	}
 	prerecorded_reset();
-	predict_reset();
-	usePrerecorded = true;
+	simulatingEvent = true;
+	return true;
+}
+
+/// <summary>
+///		Classifies the next frame of the simulated event.
+/// </summary>
+/// <param name="frameInfo">Frame of microphone 0 the clip frame stands in for.</param>
+static void SimulateNextFrame(const FrameInfo* frameInfo)
+{
+	int prediction;
+	float confidence;
+	simulatingEvent = predict_prerecorded_frame(&prediction, &confidence);
+	float overall_confidence = smooth_prediction(&simulationState, frameInfo, prediction, confidence);
+	if (overall_confidence > confidenceThresh) {
+		HandlePrediction(0, prediction, overall_confidence, &simulationState.onset, frameInfo);
+	}
+	if (!simulatingEvent) {
+		predict_release(&simulationState);
+	}
 }
 
 /// <summary>
 ///		Processes new predictions by adding each event to the event history
 ///		and notifying the IoT Hub.
 /// </summary>
+/// <param name="channel">Microphone the prediction was made for</param>
 /// <param name="prediction">Prediction index</param>
 /// <param name="confidence">Confidence value (0 - 1)</param>
-static void HandlePrediction(int prediction, float confidence)
+/// <param name="onset">First frame of the agreeing predictions, which dates the event</param>
+/// <param name="decision">Frame which completed the prediction</param>
+static void HandlePrediction(int channel, int prediction, float confidence,
+	const FrameInfo* onset, const FrameInfo* decision)
 {
 	// check if the cooloff period has ended
 	struct timespec currentTime;
 	clock_gettime(CLOCK_REALTIME, &currentTime);
 	// Only process a new prediction at most every predictionCooloff seconds
 	if (currentTime.tv_sec - lastPredictionTime.tv_sec > predictionCooloff && prediction != 0) {
-		Log_Debug("INFO: Prediction: %s with confidence %.2f\n", categories[prediction], confidence);
+		struct timespec decisionTime;
+		clock_gettime(CLOCK_MONOTONIC, &decisionTime);
+		Log_Debug("INFO: Prediction: %s with confidence %.2f on microphone %d, frames %llu to %llu, %.1f ms after onset\n",
+			categories[prediction], confidence, channel, onset->sequence, decision->sequence,
+			(float)((decisionTime.tv_sec - onset->capture_time.tv_sec) * 1000000000LL
+				+ (decisionTime.tv_nsec - onset->capture_time.tv_nsec)) / 1000000.0f);
 		if (isArmed) {
 			char event_string[EVENT_STRING_SIZE] = { 0 };
 			// Create event string (stringified JSON object)
 			bool success = construct_event_message(event_string,
-				sizeof(event_string), categories[prediction], confidence);
+				sizeof(event_string), categories[prediction], confidence, &onset->capture_realtime);
 			if (success) {
+				// Keep the audio around the event, so that operators can verify the alarm. The
+				// history runs ahead of the classifier, so the clip is dated from the onset.
+				AudioChannel* audioChannel = &audioChannels[channel];
+				if (audio_history_freeze(&audioChannel->history, &onset->capture_realtime,
+					AUDIO_SNAPSHOT_PRE_SECONDS * AUDIO_SAMPLE_RATE,
+					AUDIO_SNAPSHOT_POST_SECONDS * AUDIO_SAMPLE_RATE)) {
+					audioChannel->clip_event_type = categories[prediction];
+					audioChannel->clip_event_time = onset->capture_realtime;
+				}
 				// Send event to the IoT Hub
 				send_telemetry(event_string);
 				save_event(event_string);
@@ -342,7 +984,8 @@ static void HandlePrediction(int prediction, float confidence)
 
 /// <summary>
 ///     Callback invoked when a Device Twin update is received from IoT Hub.
-///     Updates local state for 'showEvents' (bool).
+///     Updates local state for 'armed' (bool), 'eventCooldown' (seconds), 'audioQueueDepth'
+///     (frames) and 'audioOverloadPolicy' ("dropOldest", "dropNewest" or "decimate").
 /// </summary>
 /// <param name="payload">Contains the Device Twin JSON document (desired and reported).</param>
 /// <param name="payloadSize">Size of the Device Twin JSON document.</param>
@@ -393,6 +1036,37 @@ static void TwinCallback(DEVICE_TWIN_UPDATE_STATE updateState, const unsigned ch
 		Log_Debug("INFO: Updating cooloff period to %d.\n", predictionCooloff);
 		update_device_twin_int("eventCooldown", predictionCooloff);
 	}
+	double queueDepth = json_object_get_number(desiredProperties, "audioQueueDepth");
+	if (queueDepth >= 1 && queueDepth <= AUDIO_MAX_QUEUE_DEPTH) {
+		audioQueueDepth = (unsigned int)queueDepth;
+		for (int channel = 0; channel < audioChannelCount; ++channel) {
+			set_audio_buffer_depth(&audioChannels[channel].buffer, audioQueueDepth);
+		}
+		Log_Debug("INFO: Updating audio queue depth to %u frames.\n", audioQueueDepth);
+		update_device_twin_int("audioQueueDepth", (int)audioQueueDepth);
+	}
+	else if (queueDepth != 0) {
+		Log_Debug("WARNING: Ignoring audio queue depth %.0f, the ring holds 1 to %d frames.\n",
+			queueDepth, AUDIO_MAX_QUEUE_DEPTH);
+	}
+	const char* policyName = json_object_get_string(desiredProperties, "audioOverloadPolicy");
+	if (policyName != NULL) {
+		int policy = 0;
+		while (policy < AudioOverload_Count && strcmp(policyName, overloadPolicyNames[policy]) != 0) {
+			++policy;
+		}
+		if (policy < AudioOverload_Count) {
+			audioOverloadPolicy = (AudioOverloadPolicy)policy;
+			for (int channel = 0; channel < audioChannelCount; ++channel) {
+				set_audio_buffer_policy(&audioChannels[channel].buffer, audioOverloadPolicy);
+			}
+			Log_Debug("INFO: Updating audio overload policy to %s.\n", policyName);
+			update_device_twin_string("audioOverloadPolicy", overloadPolicyNames[policy]);
+		}
+		else {
+			Log_Debug("WARNING: Unknown audio overload policy '%s'.\n", policyName);
+		}
+	}
 
 cleanup:
 	// Release the allocated memory.
@@ -414,12 +1088,75 @@ static int DirectMethodCallback(const char* method_name, const unsigned char* pa
 
 	if (strcmp("simulateEvent", method_name) == 0)
 	{
-		SimulateEvent();
-		const char deviceMethodResponse[] = "{ \"Response\": \"Simulating window break event\" }";
-		*response_size = sizeof(deviceMethodResponse) - 1;
+		if (SimulateEvent()) {
+			const char deviceMethodResponse[] = "{ \"Response\": \"Simulating window break event\" }";
+			*response_size = sizeof(deviceMethodResponse) - 1;
+			*response = malloc(*response_size);
+			(void)memcpy(*response, deviceMethodResponse, *response_size);
+			result = 200;
+		}
+		else {
+			const char deviceMethodResponse[] = "{ \"Response\": \"A replay is running\" }";
+			*response_size = sizeof(deviceMethodResponse) - 1;
+			*response = malloc(*response_size);
+			(void)memcpy(*response, deviceMethodResponse, *response_size);
+			result = 409;
+		}
+	}
+	else if (strcmp("replay", method_name) == 0)
+	{
+		int fileCount = StartReplay(payload, size);
+		char deviceMethodResponse[128];
+		if (fileCount < 0) {
+			snprintf(deviceMethodResponse, sizeof(deviceMethodResponse),
+				"{ \"Response\": \"Expecting {\\\"files\\\":[...]}\" }");
+			result = 400;
+		}
+		else if (fileCount == 0) {
+			snprintf(deviceMethodResponse, sizeof(deviceMethodResponse),
+				"{ \"Response\": \"A replay or simulated event is already running\" }");
+			result = 409;
+		}
+		else {
+			snprintf(deviceMethodResponse, sizeof(deviceMethodResponse),
+				"{ \"Response\": \"Replaying %d files, see replayResults\" }", fileCount);
+			result = 202;
+		}
+		*response_size = strlen(deviceMethodResponse);
 		*response = malloc(*response_size);
 		(void)memcpy(*response, deviceMethodResponse, *response_size);
-		result = 200;
+	}
+	else if (strcmp("replayResults", method_name) == 0)
+	{
+		char* resultsResponse = SerializeReplayResults();
+		if (resultsResponse == NULL) {
+			const char deviceMethodResponse[] = "{ \"Response\": \"Out of memory\" }";
+			*response_size = sizeof(deviceMethodResponse) - 1;
+			*response = malloc(*response_size);
+			(void)memcpy(*response, deviceMethodResponse, *response_size);
+			result = 500;
+		}
+		else {
+			*response_size = strlen(resultsResponse);
+			*response = (unsigned char*)resultsResponse;
+			result = 200;
+		}
+	}
+	else if (strcmp("captureStats", method_name) == 0)
+	{
+		char* statsResponse = SerializeCaptureStats();
+		if (statsResponse == NULL) {
+			const char deviceMethodResponse[] = "{ \"Response\": \"Out of memory\" }";
+			*response_size = sizeof(deviceMethodResponse) - 1;
+			*response = malloc(*response_size);
+			(void)memcpy(*response, deviceMethodResponse, *response_size);
+			result = 500;
+		}
+		else {
+			*response_size = strlen(statsResponse);
+			*response = (unsigned char*)statsResponse;
+			result = 200;
+		}
 	}
 	else if (strcmp("clearHistory", method_name) == 0)
 	{
@@ -449,3 +1186,199 @@ static int DirectMethodCallback(const char* method_name, const unsigned char* pa
 
 	return result;
 }
+
+/// <summary>
+///     Queues the WAV files listed in a direct method payload of the form
+///     {"files":["a.wav","b.wav"]} for replaying through the detection pipeline, faster than
+///     real time. Live audio is not classified until the replay finishes; replayResults
+///     returns the detections and timing of each file.
+/// </summary>
+/// <returns>
+///		Number of files queued, 0 if a replay or simulated event is already running, or -1 if the
+///		payload is invalid.
+///	</returns>
+static int StartReplay(const unsigned char* payload, size_t size)
+{
+	if (replayQueue.request != NULL || simulatingEvent) {
+		return 0;
+	}
+	char* payloadString = (char*)malloc(size + 1);
+	if (payloadString == NULL) {
+		return -1;
+	}
+	memcpy(payloadString, payload, size);
+	payloadString[size] = 0;
+	JSON_Value* request = json_parse_string(payloadString);
+	free(payloadString);
+	JSON_Array* files = json_object_get_array(json_value_get_object(request), "files");
+	if (files == NULL || json_array_get_count(files) == 0) {
+		json_value_free(request);
+		return -1;
+	}
+
+	// the results of the previous replay are kept until the next one starts
+	json_value_free(replayQueue.results);
+	replayQueue.results = json_value_init_array();
+	replayQueue.request = request;
+	replayQueue.files = files;
+	replayQueue.next_file = 0;
+	replayQueue.source = NULL;
+	if (SetTimerFdToPeriod(replayTimerFd, &replayStepPeriod) != 0) {
+		terminationRequired = true;
+	}
+	return (int)json_array_get_count(files);
+}
+
+/// <summary>
+///     Replay timer event: opens the next queued file or classifies the next frames of the
+///     current one, and stops the timer once every file has been replayed.
+/// </summary>
+static void ReplayEventHandler(EventData* eventData)
+{
+	if (ConsumeTimerFdEvent(replayTimerFd) != 0) {
+		terminationRequired = true;
+		return;
+	}
+	if (replayQueue.request == NULL) {
+		return;
+	}
+	if (replayQueue.source != NULL) {
+		if (!replay_step(&replayQueue.replay, REPLAY_STEP_FRAMES)) {
+			replay_close(&replayQueue.replay);
+			FinishReplayFile(true);
+		}
+		return;
+	}
+	if (replayQueue.next_file < json_array_get_count(replayQueue.files)) {
+		const char* path = json_array_get_string(replayQueue.files, replayQueue.next_file);
+		replayQueue.source = (path != NULL) ? wav_audio_source_create(path) : NULL;
+		if (replayQueue.source == NULL
+			|| !replay_open(&replayQueue.replay, replayQueue.source, confidenceThresh)) {
+			FinishReplayFile(false);
+		}
+		return;
+	}
+
+	Log_Debug("INFO: Replayed %zu files, live audio is classified again.\n",
+		json_array_get_count(replayQueue.files));
+	json_value_free(replayQueue.request);
+	replayQueue.request = NULL;
+	replayQueue.files = NULL;
+	if (SetTimerFdToPeriod(replayTimerFd, &timerStopped) != 0) {
+		terminationRequired = true;
+	}
+}
+
+/// <summary>
+///     Adds the results of the current replay file to replayQueue.results and moves on to the
+///     next file.
+/// </summary>
+/// <param name="replayed">True if the file was replayed, false if it could not be opened.</param>
+static void FinishReplayFile(bool replayed)
+{
+	const char* path = json_array_get_string(replayQueue.files, replayQueue.next_file);
+	JSON_Value* fileValue = json_value_init_object();
+	JSON_Object* fileObject = json_value_get_object(fileValue);
+	json_object_set_string(fileObject, "file", path != NULL ? path : "");
+	const ReplayResult* replayResult = &replayQueue.replay.result;
+	if (!replayed) {
+		json_object_set_string(fileObject, "error", "replay failed");
+	}
+	else {
+		Log_Debug("INFO: Replayed '%s': %u frames (%u skipped), real-time factor %.4f, %.1f frames/s, %d detections.\n",
+			path, replayResult->frames, replayResult->skipped_frames, replayResult->real_time_factor,
+			replayResult->frames_per_second, replayResult->detection_count);
+		json_object_set_number(fileObject, "sampleRate", AUDIO_SAMPLE_RATE);
+		json_object_set_number(fileObject, "frames", replayResult->frames);
+		json_object_set_number(fileObject, "skippedFrames", replayResult->skipped_frames);
+		json_object_set_number(fileObject, "audioSeconds", replayResult->audio_seconds);
+		json_object_set_number(fileObject, "realTimeFactor", replayResult->real_time_factor);
+		json_object_set_number(fileObject, "framesPerSecond", replayResult->frames_per_second);
+		json_object_set_number(fileObject, "detectionCount", replayResult->detection_count);
+		JSON_Value* detectionsValue = json_value_init_array();
+		JSON_Array* detections = json_value_get_array(detectionsValue);
+		int stored = replayResult->detection_count < REPLAY_MAX_DETECTIONS
+			? replayResult->detection_count : REPLAY_MAX_DETECTIONS;
+		for (int j = 0; j < stored; ++j) {
+			const ReplayDetection* detection = &replayResult->detections[j];
+			JSON_Value* detectionValue = json_value_init_object();
+			JSON_Object* detectionObject = json_value_get_object(detectionValue);
+			json_object_set_string(detectionObject, "eventType", categories[detection->prediction]);
+			json_object_set_number(detectionObject, "confidence", detection->confidence);
+			json_object_set_number(detectionObject, "onsetSample", (double)detection->onset_sample);
+			json_object_set_number(detectionObject, "decisionSample", (double)detection->decision_sample);
+			// audio from the onset to the decision, the detection latency without processing time
+			json_object_set_number(detectionObject, "latencyMs",
+				(double)(detection->decision_sample - detection->onset_sample) * 1000.0 / AUDIO_SAMPLE_RATE);
+			json_array_append_value(detections, detectionValue);
+		}
+		json_object_set_value(fileObject, "detections", detectionsValue);
+	}
+	json_array_append_value(json_value_get_array(replayQueue.results), fileValue);
+	audio_source_destroy(replayQueue.source);
+	replayQueue.source = NULL;
+	++replayQueue.next_file;
+}
+
+/// <summary>
+///     Serializes the progress of the latest replay as {"running":..., "files":[...]}, with the
+///     detections and timing of each file replayed so far.
+/// </summary>
+/// <returns>A JSON string which must be freed with free(), or NULL if out of memory.</returns>
+static char* SerializeReplayResults(void)
+{
+	JSON_Value* responseValue = json_value_init_object();
+	JSON_Object* responseObject = json_value_get_object(responseValue);
+	json_object_set_boolean(responseObject, "running", replayQueue.request != NULL);
+	json_object_set_value(responseObject, "files", replayQueue.results != NULL
+		? json_value_deep_copy(replayQueue.results) : json_value_init_array());
+	char* response = json_serialize_to_string(responseValue);
+	json_value_free(responseValue);
+	return response;
+}
+
+/// <summary>
+///     Serializes the capture thread's totals since it started, including the wake lateness
+///     histogram, as {"realtime":..., "blockSize":..., "wakeups":..., "lostSamples":...,
+///     "inputRate":..., "maxWakeLatencyUs":...,
+///     "wakeLatencyHistogram":[...], "audioBacklog":[...]}. Bucket 0 counts timed wakeups less
+///     than 1 us late and bucket i counts those 2^(i-1) to 2^i us late. audioBacklog has the main
+///     loop's DrainStats of each microphone.
+/// </summary>
+/// <returns>A JSON string which must be freed with free(), or NULL if out of memory.</returns>
+static char* SerializeCaptureStats(void)
+{
+	CaptureStats stats = recordAudioContext.stats;
+	JSON_Value* statsValue = json_value_init_object();
+	JSON_Object* statsObject = json_value_get_object(statsValue);
+	json_object_set_boolean(statsObject, "realtime", stats.realtime);
+	json_object_set_number(statsObject, "blockSize", stats.block_size);
+	json_object_set_number(statsObject, "wakeups", stats.wakeups);
+	json_object_set_number(statsObject, "lostSamples", stats.lost_samples);
+	json_object_set_number(statsObject, "inputRate", stats.input_rate);
+	json_object_set_number(statsObject, "maxWakeLatencyUs", (double)stats.max_wake_latency_ns / 1000.0);
+	JSON_Value* histogramValue = json_value_init_array();
+	JSON_Array* histogram = json_value_get_array(histogramValue);
+	for (int i = 0; i < CAPTURE_LATENCY_BUCKETS; ++i) {
+		json_array_append_number(histogram, stats.wake_latency[i]);
+	}
+	json_object_set_value(statsObject, "wakeLatencyHistogram", histogramValue);
+	JSON_Value* backlogValue = json_value_init_array();
+	JSON_Array* backlog = json_value_get_array(backlogValue);
+	for (int channel = 0; channel < audioChannelCount; ++channel) {
+		DrainStats drain = audioChannels[channel].drain;
+		JSON_Value* drainValue = json_value_init_object();
+		JSON_Object* drainObject = json_value_get_object(drainValue);
+		json_object_set_number(drainObject, "wakeups", drain.wakeups);
+		json_object_set_number(drainObject, "frames", drain.frames);
+		json_object_set_number(drainObject, "averageBacklog",
+			drain.wakeups > 0 ? (double)drain.backlog / drain.wakeups : 0.0);
+		json_object_set_number(drainObject, "maxBacklog", drain.max_backlog);
+		json_object_set_number(drainObject, "budgetExhausted", drain.budget_exhausted);
+		json_array_append_value(backlog, drainValue);
+	}
+	json_object_set_value(statsObject, "audioBacklog", backlogValue);
+	char* response = json_serialize_to_string(statsValue);
+	json_value_free(statsValue);
+	return response;
+}
@@ -1,17 +1,22 @@
 #include "process_audio.h"
 #include <stddef.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <applibs/log.h>
+#include <math.h>
 #include <time.h>
 
 #include "common.h"
+#include "decimator.h"
+#include "log_mel.h"
 
 #define MODEL_WRAPPER_DEFINED
 #include "classifier.h"
 #define MFCC_WRAPPER_DEFINED
 #include "featurizer.h"
 #include "window_break.h"
+#include "window_break_features.h"
 
 const char* const categories[] = {
 	"background_noise",
@@ -22,25 +27,250 @@ const char* const categories[] = {
 // Prediction variables
 const float CONFIDENCE_THRESHOLD = 0.85f;
 const int CONSECUTIVE_PREDICTION_THRESHOLD = 7;
-float overall_inverse_confidence = 1;
-int last_prediction = 0;
-unsigned short num_same_prediction = 0;
-int vad_signal = 0;
 int prepared_recording_index = 0;
-const int prepared_recording_rows = sizeof(sample_wav_data) / (AUDIO_FRAME_SIZE * sizeof(short));
+const int prepared_recording_rows = sizeof(sample_wav_data) / (AUDIO_CAPTURE_FRAME_SIZE * sizeof(short));
+const int prepared_feature_rows = sizeof(sample_wav_features) / sizeof(sample_wav_features[0]);
+#if LOG_MEL_FILTERS != FEATURES_SIZE
+#error The native featurizer and prerecorded features do not match the classifier input, FEATURES_SIZE
+#endif
+// Stream the classifier's recurrent state belongs to, NULL if none
+static PredictionState* classifierOwner = NULL;
+// True if classifierOwner took the classifier with predict_hold and keeps it while quiet
+static bool classifierHeld = false;
+// Active streams left out while another had the classifier, in the order they take it next
+static PredictionState* waitingStreams[MAX_AUDIO_CHANNELS];
+static int waitingCount = 0;
+#if AUDIO_DECIMATION > 1
+static Decimator prerecordedDecimator;  // brings the clip from the capture rate to AUDIO_SAMPLE_RATE
+#endif
+
+static int argmax(float* buffer, int len)
+{
+    int max = 0;
+    float value = 0;
+    for (int j = 0; j < len; j++)
+    {
+        float v = buffer[j];
+        if (v > value) {
+            value = v;
+            max = j;
+        }
+    }
+    return max;
+}
+
+#if AUDIO_FEATURIZER_SELF_TEST
+/// <summary>
+///     Copies one row of the prerecorded clip, which is recorded at the capture rate, into a
+///     frame at AUDIO_SAMPLE_RATE. Rows must be taken in order after prerecorded_reset.
+/// </summary>
+static void PrerecordedFrame(int row, short* frame)
+{
+#if AUDIO_DECIMATION > 1
+	decimator_process(&prerecordedDecimator, sample_wav_data[row], AUDIO_CAPTURE_FRAME_SIZE, frame);
+#else
+	memcpy(frame, sample_wav_data[row], AUDIO_FRAME_SIZE * sizeof(short));
+#endif
+}
+#endif
+
+/// <summary>
+///     Computes the features of a frame with the featurizer selected in common.h.
+/// </summary>
+static void FeaturizeFrame(const short* frame, float* features)
+{
+#if AUDIO_FIXED_POINT_FEATURIZER
+	log_mel_filter_pcm(frame, features);
+#else
+	float featurizer_input_buffer[AUDIO_FRAME_SIZE];
+	pcm_to_float(frame, featurizer_input_buffer, AUDIO_FRAME_SIZE);
+#if AUDIO_NATIVE_FEATURIZER
+	log_mel_filter(featurizer_input_buffer, features);
+#else
+	mfcc_Filter(NULL, featurizer_input_buffer, features);
+#endif
+#endif
+}
+
+/// <summary>
+///     Runs the classifier on the features of a frame.
+/// </summary>
+static void ClassifyFeatures(float* features, int* prediction, float* confidence)
+{
+	float classifier_output[NUM_CATEGORIES];
+	model_Predict(NULL, features, classifier_output);
+	*prediction = argmax(classifier_output, NUM_CATEGORIES);
+	*confidence = classifier_output[*prediction];
+}
+
+/// <summary>
+///     Checks that the precomputed features of the prerecorded clip, which the simulated event
+///     classifies, cover the clip, and with AUDIO_FEATURIZER_SELF_TEST that they are those the
+///     featurizer in use computes from the clip.
+/// </summary>
+/// <returns>true if they are within LOG_MEL_TOLERANCE, false if they are stale.</returns>
+static bool CheckPrerecordedFeatures(void)
+{
+	if (prepared_feature_rows != prepared_recording_rows) {
+		Log_Debug("ERROR: Prerecorded features have %d rows for %d rows of audio, run tools/generate_prerecorded_features.py.\n",
+			prepared_feature_rows, prepared_recording_rows);
+		return false;
+	}
+#if AUDIO_FEATURIZER_SELF_TEST
+	short frame[AUDIO_FRAME_SIZE];
+	float features[FEATURES_SIZE];
+	float max_error = 0;
+	prerecorded_reset();
+	for (int i = 0; i < prepared_recording_rows; i++) {
+		PrerecordedFrame(i, frame);
+		FeaturizeFrame(frame, features);
+		for (int j = 0; j < FEATURES_SIZE; j++) {
+			float error = fabsf(features[j] - sample_wav_features[i][j]);
+			if (error > max_error) {
+				max_error = error;
+			}
+		}
+	}
+	prerecorded_reset();
+	if (max_error > LOG_MEL_TOLERANCE) {
+		Log_Debug("ERROR: Prerecorded features differ from the featurizer by %g, run tools/generate_prerecorded_features.py.\n",
+			max_error);
+		return false;
+	}
+	Log_Debug("INFO: Prerecorded features within %g of the featurizer.\n", max_error);
+#endif
+	return true;
+}
+
+#if AUDIO_NATIVE_FEATURIZER && AUDIO_FEATURIZER_SELF_TEST
+
+static float MicrosecondsBetween(const struct timespec* start, const struct timespec* end)
+{
+	return (float)(end->tv_sec - start->tv_sec) * 1000000.0f + (float)(end->tv_nsec - start->tv_nsec) / 1000.0f;
+}
+
+// Featurizer of one frame of 16-bit PCM samples
+typedef void (*FrameFeaturizer)(const short* frame, float* features);
+
+static void FeaturizePrebuilt(const short* frame, float* features)
+{
+	float input[AUDIO_FRAME_SIZE];
+	pcm_to_float(frame, input, AUDIO_FRAME_SIZE);
+	mfcc_Filter(NULL, input, features);
+}
+
+static void FeaturizeFloat(const short* frame, float* features)
+{
+	float input[AUDIO_FRAME_SIZE];
+	pcm_to_float(frame, input, AUDIO_FRAME_SIZE);
+	log_mel_filter(input, features);
+}
+
+/// <summary>
+///     Runs the classifier over the prerecorded clip once on the features of the reference
+///     featurizer and once on those of the candidate. Logs how far apart the features are, on
+///     how many frames the two predict the same category and the time each featurizer takes
+///     per frame.
+/// </summary>
+/// <returns>The largest difference between the features of the two.</returns>
+static float CompareFeaturizers(const char* candidate_name, FrameFeaturizer candidate,
+	const char* reference_name, FrameFeaturizer reference)
+{
+	static int reference_predictions[sizeof(sample_wav_data) / sizeof(sample_wav_data[0])];
+	short frame[AUDIO_FRAME_SIZE];
+	float features[LOG_MEL_FILTERS];
+	float reference_features[LOG_MEL_FILTERS];
+	float classifier_output[NUM_CATEGORIES];
+	float featurizer_us[2] = { 0, 0 };
+	float max_error = 0;
+	int agreeing = 0;
+	struct timespec start, end;
+	for (int pass = 0; pass < 2; pass++) {
+		FrameFeaturizer featurizer = (pass == 0) ? reference : candidate;
+		predict_reset();
+		prerecorded_reset();
+		for (int i = 0; i < prepared_recording_rows; i++) {
+			PrerecordedFrame(i, frame);
+			clock_gettime(CLOCK_MONOTONIC, &start);
+			featurizer(frame, features);
+			clock_gettime(CLOCK_MONOTONIC, &end);
+			featurizer_us[pass] += MicrosecondsBetween(&start, &end);
+			model_Predict(NULL, features, classifier_output);
+			int prediction = argmax(classifier_output, NUM_CATEGORIES);
+			if (pass == 0) {
+				reference_predictions[i] = prediction;
+				continue;
+			}
+			if (prediction == reference_predictions[i]) {
+				agreeing++;
+			}
+			reference(frame, reference_features);
+			for (int j = 0; j < LOG_MEL_FILTERS; j++) {
+				float error = fabsf(features[j] - reference_features[j]);
+				if (error > max_error) {
+					max_error = error;
+				}
+			}
+		}
+	}
+	predict_reset();
+	prerecorded_reset();
+	Log_Debug("INFO: %s featurizer within %g of the %s one, same category on %d of %d rows, %.1f us vs %.1f us per frame.\n",
+		candidate_name, max_error, reference_name, agreeing, prepared_recording_rows,
+		featurizer_us[1] / prepared_recording_rows, featurizer_us[0] / prepared_recording_rows);
+	return max_error;
+}
+
+/// <summary>
+///     Checks the float path of the native featurizer against the prebuilt ELL featurizer on the
+///     prerecorded clip, and with AUDIO_FIXED_POINT_FEATURIZER the fixed-point path against the
+///     float path.
+/// </summary>
+/// <returns>true if the featurizer in use is within its tolerance, false if not.</returns>
+static bool CheckNativeFeaturizer(void)
+{
+	if (mfcc_GetInputSize(0) != LOG_MEL_FFT_SIZE || mfcc_GetOutputSize(0) != LOG_MEL_FILTERS) {
+		Log_Debug("INFO: The prebuilt featurizer takes %d samples to %d features, not comparing it with the native featurizer.\n",
+			mfcc_GetInputSize(0), mfcc_GetOutputSize(0));
+	}
+	else if (CompareFeaturizers("Native", FeaturizeFloat, "prebuilt", FeaturizePrebuilt) > LOG_MEL_TOLERANCE) {
+		Log_Debug("ERROR: Native featurizer differs from the prebuilt one by more than %g.\n", LOG_MEL_TOLERANCE);
+		return false;
+	}
+#if AUDIO_FIXED_POINT_FEATURIZER
+	// only worth the time at startup when the fixed-point path is in use
+	if (CompareFeaturizers("Fixed-point", log_mel_filter_pcm, "float", FeaturizeFloat) > LOG_MEL_FIXED_TOLERANCE) {
+		Log_Debug("ERROR: Fixed-point featurizer exceeds its bound of %g.\n", LOG_MEL_FIXED_TOLERANCE);
+		return false;
+	}
+#endif
+	return true;
+}
+#endif
 
 bool check_predict_setup()
 {
     Log_Debug("INFO: Prerecorded sample contains %d rows of 16-bit PCM data\n",
 		prepared_recording_rows);
 
+#if AUDIO_NATIVE_FEATURIZER
+#if AUDIO_FEATURIZER_SELF_TEST
+    if (!CheckNativeFeaturizer()) {
+        return false;
+    }
+#endif
+    int input_size = LOG_MEL_FFT_SIZE;
+    int output_size = LOG_MEL_FILTERS;
+#else
     int input_size = mfcc_GetInputSize(0);
     if (input_size != AUDIO_FRAME_SIZE)
     {
-        Log_Debug("ERROR: Expecting featurizer to take %d samples\n", AUDIO_FRAME_SIZE);
+        Log_Debug("ERROR: Expecting featurizer to take %d samples for the %d Hz profile, it takes %d.\n",
+			AUDIO_FRAME_SIZE, AUDIO_SAMPLE_RATE, input_size);
         return false;
     }
     int output_size = mfcc_GetOutputSize(0);
+#endif
     Log_Debug("INFO: Featurizer input %d and output %d.\n", input_size, output_size);
 
     input_size = model_GetInputSize(0);
@@ -52,62 +282,158 @@ bool check_predict_setup()
     output_size = model_GetOutputSize(0);
     Log_Debug("INFO: Classifier input %d and output %d.\n", input_size, output_size);
 
-    return true;
+    return CheckPrerecordedFeatures();
 }
 
-static int argmax(float* buffer, int len)
+void prediction_state_reset(PredictionState* state)
 {
-    int max = 0;
-    float value = 0;
-    for (int j = 0; j < len; j++)
-    {
-        float v = buffer[j];
-        if (v > value) {
-            value = v;
-            max = j;
-        }
-    }
-    return max;
+	state->num_same_prediction = 0;
+	state->overall_inverse_confidence = 1.0f;
 }
 
-float smooth_prediction(int prediction, float confidence)
+float smooth_prediction(PredictionState* state, const FrameInfo* frame, int prediction,
+	float confidence)
 {
-	if (confidence >= CONFIDENCE_THRESHOLD && prediction == last_prediction) {
-		++num_same_prediction;
-		overall_inverse_confidence *= (1.0f - confidence);
+	if (confidence >= CONFIDENCE_THRESHOLD && prediction == state->last_prediction) {
+		if (state->num_same_prediction == 0) {
+			state->run_start = *frame;
+		}
+		++state->num_same_prediction;
+		state->overall_inverse_confidence *= (1.0f - confidence);
 	}
 	else {
-		num_same_prediction = 0;
-		overall_inverse_confidence = 1.0f;
+		prediction_state_reset(state);
 	}
-	last_prediction = prediction;
-	if (num_same_prediction > CONSECUTIVE_PREDICTION_THRESHOLD) {
+	state->last_prediction = prediction;
+	if (state->num_same_prediction > CONSECUTIVE_PREDICTION_THRESHOLD) {
 		// got a valid prediction
-		float overall_confidence = 1.0f - overall_inverse_confidence;
-		num_same_prediction = 0;
-		overall_inverse_confidence = 1.0f;
+		float overall_confidence = 1.0f - state->overall_inverse_confidence;
+		state->onset = state->run_start;
+		prediction_state_reset(state);
 		predict_reset();
 		return overall_confidence;
 	}
 	return 0;
 }
 
-void predict_single_frame(float* inputData, int* prediction, float* confidence)
+void pcm_to_float(const short* restrict input, float* restrict output, int count)
+{
+	// a single multiply per sample with no aliasing lets the compiler vectorize this loop
+	const float scale = 1.0f / 32768.0f;
+	for (int j = 0; j < count; j++)
+	{
+		output[j] = (float)input[j] * scale;
+	}
+}
+
+void predict_single_frame(const short* inputData, int* prediction, float* confidence)
 {
 	float classifier_input_buffer[FEATURES_SIZE];
-	float classifier_output[NUM_CATEGORIES];
-	mfcc_Filter(NULL, inputData, classifier_input_buffer);
-	model_Predict(NULL, classifier_input_buffer, classifier_output);
-	*prediction = argmax(classifier_output, NUM_CATEGORIES);
-	*confidence = classifier_output[*prediction];
+	FeaturizeFrame(inputData, classifier_input_buffer);
+	ClassifyFeatures(classifier_input_buffer, prediction, confidence);
 }
 
-bool prepare_prerecorded(float* featurizer_input_buffer)
+/// <summary>
+///     Removes a stream from the streams waiting for the classifier, if it is one of them.
+/// </summary>
+static void StopWaiting(const PredictionState* state)
 {
-	for (int j = 0; j < AUDIO_FRAME_SIZE; j++)
-	{
-		featurizer_input_buffer[j] = (float)sample_wav_data[prepared_recording_index][j] / 32768.0f;
+	for (int i = 0; i < waitingCount; ++i) {
+		if (waitingStreams[i] == state) {
+			memmove(&waitingStreams[i], &waitingStreams[i + 1],
+				(size_t)(waitingCount - i - 1) * sizeof(waitingStreams[0]));
+			--waitingCount;
+			return;
+		}
+	}
+}
+
+/// <summary>
+///     Adds a stream to the back of the streams waiting for the classifier, unless it waits already.
+/// </summary>
+static void StartWaiting(PredictionState* state)
+{
+	for (int i = 0; i < waitingCount; ++i) {
+		if (waitingStreams[i] == state) {
+			return;
+		}
 	}
+	if (waitingCount < MAX_AUDIO_CHANNELS) {
+		waitingStreams[waitingCount++] = state;
+	}
+}
+
+int predict_active_frame(ActivityDetector* detector, PredictionState* state,
+	const short* inputData, const FrameInfo* info, bool decimate, int* prediction,
+	float* overallConfidence)
+{
+	*prediction = 0;
+	*overallConfidence = 0;
+	ActivityResult activity = activity_detector_process(detector, inputData, info);
+	if (activity == ActivityResult_Inactive) {
+		if (classifierOwner == state && !classifierHeld) {
+			// free for the other microphones
+			classifierOwner = NULL;
+		}
+		StopWaiting(state);
+		return 0;
+	}
+	bool fresh = activity == ActivityResult_Onset;
+	if (classifierOwner != state) {
+		if (classifierOwner != NULL || (waitingCount > 0 && waitingStreams[0] != state)) {
+			// another stream's recurrent state is in the classifier, or another stream is next;
+			// the frame may warm the classifier up when this stream's turn comes
+			++state->excluded_frames;
+			state->decimated = false;
+			StartWaiting(state);
+			activity_detector_add_preroll(detector, inputData, info);
+			return 0;
+		}
+		StopWaiting(state);
+		classifierOwner = state;
+		state->turn_frames = 0;
+		// the classifier and smoothing state are left over from other frames
+		fresh = true;
+	}
+	float confidence;
+	int classified = 0;
+	if (!fresh && decimate && !state->decimated) {
+		// the gate has still seen the frame, so the noise floors and hangover stay current
+		state->decimated = true;
+		return 0;
+	}
+	state->decimated = false;
+	if (fresh) {
+		prediction_state_reset(state);
+		predict_reset();
+		// warm up on the frames just before this one; too few to trigger a detection
+		for (int i = 0; i < detector->preroll_count; ++i) {
+			const FrameInfo* prerollInfo;
+			const short* preroll = activity_detector_preroll(detector, i, &prerollInfo);
+			predict_single_frame(preroll, prediction, &confidence);
+			smooth_prediction(state, prerollInfo, *prediction, confidence);
+			++classified;
+		}
+		activity_detector_clear_preroll(detector);
+	}
+	predict_single_frame(inputData, prediction, &confidence);
+	*overallConfidence = smooth_prediction(state, info, *prediction, confidence);
+	++classified;
+	state->turn_frames += classified;
+	bool building = state->num_same_prediction > 0 && state->last_prediction != 0;
+	if (!classifierHeld && waitingCount > 0 && state->turn_frames >= CLASSIFIER_TURN_FRAMES && !building) {
+		// the turn is over, and no detection is cut short: the next waiting stream takes over
+		classifierOwner = NULL;
+	}
+	return classified;
+}
+
+bool predict_prerecorded_frame(int* prediction, float* confidence)
+{
+	// the model takes a writable input, which the table in read-only memory is not
+	float features[FEATURES_SIZE];
+	memcpy(features, sample_wav_features[prepared_recording_index], sizeof(features));
+	ClassifyFeatures(features, prediction, confidence);
 	++prepared_recording_index;
 	// if there is still data to process, return true
 	return prepared_recording_index < prepared_recording_rows;
@@ -118,19 +444,13 @@ void predict_prerecorded()
     predict_reset();
 	int prediction;
 	float confidence;
-	float featurizer_input_buffer[AUDIO_FRAME_SIZE];
-    // run the predictor on our static sample PCM data...
-    int input_size = mfcc_GetInputSize(0);
-    int rows = sizeof(sample_wav_data) / (AUDIO_FRAME_SIZE * sizeof(short));
+    // run the predictor on the precomputed features of our static sample PCM data...
+    prerecorded_reset();
     float best_confidence = 0;
     int best_prediction = 0;
-    for (int i = 0; i < rows; i++)
+    for (int i = 0; i < prepared_recording_rows; i++)
     {
-        for (int j = 0; j < input_size; j++)
-        {
-            featurizer_input_buffer[j] = (float)sample_wav_data[i][j] / 32768.0f;
-        }
-		predict_single_frame(featurizer_input_buffer, &prediction, &confidence);
+		predict_prerecorded_frame(&prediction, &confidence);
         if (confidence > best_confidence)
         {
             best_confidence = confidence;
@@ -143,13 +463,35 @@ void predict_prerecorded()
 
 void predict_reset()
 {
-	num_same_prediction = 0;
-	overall_inverse_confidence = 1.0;
     mfcc_Reset();
     model_Reset();
 }
 
+bool predict_hold(PredictionState* state)
+{
+	if (classifierHeld && classifierOwner != state) {
+		return false;
+	}
+	classifierOwner = state;
+	classifierHeld = true;
+	prediction_state_reset(state);
+	predict_reset();
+	return true;
+}
+
+void predict_release(PredictionState* state)
+{
+	if (classifierOwner == state) {
+		classifierOwner = NULL;
+		classifierHeld = false;
+		predict_reset();
+	}
+}
+
 void prerecorded_reset()
 {
 	prepared_recording_index = 0;
+#if AUDIO_DECIMATION > 1
+	decimator_init(&prerecordedDecimator);
+#endif
 }
\ No newline at end of file
@@ -1,74 +1,402 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE  // CPU affinity
+#endif
 #include "record_audio.h"
 #include <errno.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdbool.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/timerfd.h>
+#include <time.h>
 #include <unistd.h>
-#include <applibs/adc.h>
 #include <applibs/log.h>
 
 #include "epoll_timerfd_utilities.h"
 #include "common.h"
 #include "process_audio.h"
+#include "decimator.h"
+#include "resampler.h"
 
-#include "hw/safe_sound_hardware.h"
+// Largest number of samples captured before they are stored, including filled-in ones
+#define CAPTURE_MAX_BLOCK (AUDIO_CAPTURE_BLOCK_SIZE + AUDIO_CAPTURE_FRAME_SIZE)
 
-static float rawAudioBuffer[AUDIO_FRAME_SIZE];
+#if AUDIO_DECIMATION != 1 && AUDIO_DECIMATION != 2
+#error AUDIO_CAPTURE_RATE must be AUDIO_SAMPLE_RATE or twice it
+#endif
+
+/// <summary>
+/// Capture state of one channel of the audio source.
+/// </summary>
+typedef struct ChannelCapture {
+	short* hop;  // hop being assembled, a ring slot or overflow while the ring is full
+	short overflow[AUDIO_HOP_SIZE];  // holds the hop while the ring has no free slot
+	short block[CAPTURE_MAX_BLOCK];  // samples captured since the last block was stored
+	short resampled[RESAMPLER_MAX_OUTPUT];  // block after drift correction
+	short lastSample;
+	Decimator decimator;  // brings the capture rate down to AUDIO_SAMPLE_RATE
+	Resampler resampler;
+	AudioBuffer* buffer;  // receives the complete frames
+} ChannelCapture;
+
+// All channels are captured on the same ticks, so they share the hop and block positions
+static ChannelCapture channels[MAX_AUDIO_CHANNELS];
+static int channelCount = 0;
 static short audioBufferIndex = 0;
-static AudioBuffer* audioBuf = NULL;
+static unsigned short hopGapSamples = 0;  // filled-in captured samples in the current hop
+static FrameInfo hopInfo;  // origin of the current hop
+static unsigned long long nextSequence = 0;  // sequence number of the next hop
+static int capturedCount = 0;  // samples per channel captured since the last block was stored
+static uint64_t capturedPeriods = 0;  // source sample periods the captured samples account for
+static short sourceBlock[CAPTURE_MAX_BLOCK * MAX_AUDIO_CHANNELS];  // interleaved read_block output
+static CaptureStats* captureStats = NULL;
 static int threadEpollFd = -1;
-static int adcControllerFd = -1;
 static int microphonePollTimerFd = -1;
+static int readSize = AUDIO_CAPTURE_BLOCK_SIZE;  // samples per channel read on each wakeup
+static long long readPeriodNs = 0;  // capture timer period
+static long long nextExpirationNs = 0;  // CLOCK_MONOTONIC time of the next capture timer expiration
+static AudioSource* audioSource = NULL;
 
-// ADC constants
-// The size of a sample in bits
-static int adcBitCount = -1;
+static long long TimespecToNs(const struct timespec* time)
+{
+	return time->tv_sec * 1000000000LL + time->tv_nsec;
+}
 
 /// <summary>
-///     Takes a single reading from ADC channel1 every 62.5 microseconds,
-///     and sends a notification that there is a new frame when it completes.
+///     Adds a wakeup to the lateness histogram in the capture stats.
 /// </summary>
-static void MicrophoneRecordEventHandler(EventData* eventData)
+/// <param name="latenessNs">Time between the timer expiration and the wakeup.</param>
+static void RecordWakeLatency(long long latenessNs)
 {
-	if (ConsumeTimerFdEvent(microphonePollTimerFd) != 0) {
-		terminationRequired = true;
-		return;
+	if (latenessNs < 0) {
+		latenessNs = 0;
+	}
+	if (latenessNs > captureStats->max_wake_latency_ns) {
+		captureStats->max_wake_latency_ns = latenessNs;
 	}
+	long long latenessUs = latenessNs / 1000;
+	int bucket = 0;
+	while (latenessUs > 0 && bucket < CAPTURE_LATENCY_BUCKETS - 1) {
+		latenessUs >>= 1;
+		++bucket;
+	}
+	captureStats->wake_latency[bucket] += 1;
+}
 
-	uint32_t value;
-	int result = ADC_Poll(adcControllerFd, MICROPHONE, &value);
-	if (result < -1) {
-		Log_Debug("ERROR: ADC_Poll failed with error: %s (%d)\n", strerror(errno), errno);
-		terminationRequired = true;
-		return;
+static void NsToTimespec(long long ns, struct timespec* time)
+{
+	time->tv_sec = (time_t)(ns / 1000000000LL);
+	time->tv_nsec = (long)(ns % 1000000000LL);
+}
+
+/// <summary>
+///     Numbers and timestamps the hop whose first sample is about to be stored.
+/// </summary>
+/// <param name="sampleTimeNs">CLOCK_MONOTONIC time the first sample was captured.</param>
+static void StartHop(long long sampleTimeNs)
+{
+	hopInfo.sequence = nextSequence++;
+	NsToTimespec(sampleTimeNs, &hopInfo.capture_time);
+	// derive the wall clock time from the current offset between the two clocks
+	struct timespec monotonicNow, realtimeNow;
+	clock_gettime(CLOCK_MONOTONIC, &monotonicNow);
+	clock_gettime(CLOCK_REALTIME, &realtimeNow);
+	NsToTimespec(TimespecToNs(&realtimeNow) - (TimespecToNs(&monotonicNow) - sampleTimeNs),
+		&hopInfo.capture_realtime);
+}
+
+/// <summary>
+///     Points the channel at the ring slot its next hop is assembled in, so the samples are
+///     written in place. Falls back to the overflow buffer while the ring is full.
+/// </summary>
+static void AcquireHop(ChannelCapture* channel)
+{
+	FrameInfo* info;
+	channel->hop = acquire_write_slot(channel->buffer, &info);
+	if (channel->hop == NULL) {
+		channel->hop = channel->overflow;
 	}
+}
 
-	// scale adc reading from -1 to 1
-	float sample = ((float)value * 2) / (float)((1 << adcBitCount) - 1) - 1.0f;
+/// <summary>
+///     Hands a complete hop of one channel over to the main loop. A dropped hop is missing
+///     from the frames which would have contained it, so those frames join the audio on either
+///     side of it; its sequence number marks the join.
+/// </summary>
+static void StoreHop(ChannelCapture* channel)
+{
+	AudioBuffer* audioBuf = channel->buffer;
+	atomic_fetch_add_explicit(&audioBuf->gap_samples_total, hopInfo.gap_samples,
+		memory_order_relaxed);
+	FrameInfo* info;
+	short* slot = acquire_write_slot(audioBuf, &info);
+	if (slot == NULL) {
+		drop_write_slot(audioBuf);
+	}
+	else {
+		if (channel->hop != slot) {
+			// the ring was full when the hop started but the main loop has caught up since
+			memcpy(slot, channel->hop, AUDIO_HOP_SIZE * sizeof(short));
+		}
+		*info = hopInfo;
+		if (!commit_write_slot(audioBuf)) {
+			// the first frame is not complete yet
+			return;
+		}
+		// notify main loop that there is new data
+		uint64_t increment_one = 1UL;
+		if (write(audioBuf->dataAvailableFd, &increment_one, sizeof(increment_one)) < 0) {
+			Log_Debug("ERROR: dataAvailableFd write failed.\n");
+		}
+	}
+}
 
-	rawAudioBuffer[audioBufferIndex] = sample;
-	if (++audioBufferIndex == AUDIO_FRAME_SIZE) {
+/// <summary>
+///     Adds one sample of every channel to the current hops and hands the hops over to
+///     the main loop once they are full.
+/// </summary>
+/// <param name="samples">Per-channel sample arrays.</param>
+/// <param name="index">Index of the samples to add in each array.</param>
+/// <param name="sampleTimeNs">CLOCK_MONOTONIC time the samples were captured.</param>
+static void StoreSamples(short* const* samples, int index, long long sampleTimeNs)
+{
+	if (audioBufferIndex == 0) {
+		StartHop(sampleTimeNs);
+		for (int channel = 0; channel < channelCount; ++channel) {
+			AcquireHop(&channels[channel]);
+		}
+	}
+	for (int channel = 0; channel < channelCount; ++channel) {
+		channels[channel].hop[audioBufferIndex] = samples[channel][index];
+	}
+	if (++audioBufferIndex == AUDIO_HOP_SIZE) {
 		audioBufferIndex = 0;
-		// copy full raw buffer into audio buffers
-		if (!write_audio_buffer(audioBuf, rawAudioBuffer, AUDIO_FRAME_SIZE)) {
-			audioBuf->dropped_frames += 1;
+		// each filled-in captured sample affects one sample after decimation
+		hopInfo.gap_samples = (hopGapSamples > AUDIO_HOP_SIZE) ? AUDIO_HOP_SIZE : hopGapSamples;
+		for (int channel = 0; channel < channelCount; ++channel) {
+			StoreHop(&channels[channel]);
 		}
-		else {
-			// notify main loop that there is new data
-			uint64_t increment_one = 1UL;
-			if (write(audioBuf->dataAvailableFd, &increment_one, sizeof(increment_one)) < 0) {
-				Log_Debug("ERROR: dataAvailableFd write failed.\n");
-			}
+		hopGapSamples = 0;
+
+		// sample the thread CPU time once per hop to keep the overhead out of the hot path
+		struct timespec cpuTime;
+		if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime) == 0) {
+			captureStats->cpu_ns = cpuTime.tv_sec * 1000000000LL + cpuTime.tv_nsec;
+		}
+	}
+}
+
+/// <summary>
+///     Adds one sample period to the block being captured.
+/// </summary>
+/// <param name="samples">One 16-bit PCM sample per channel.</param>
+/// <param name="filled">True if the samples replace ones that were never captured.</param>
+static void CaptureSamples(const short* samples, bool filled)
+{
+	for (int channel = 0; channel < channelCount; ++channel) {
+		channels[channel].block[capturedCount] = samples[channel];
+		channels[channel].lastSample = samples[channel];
+	}
+	++capturedCount;
+	if (filled) {
+		++hopGapSamples;
+	}
+}
+
+/// <summary>
+///     Stores a block of samples which ends at the time it was read, one sample period apart.
+/// </summary>
+/// <param name="samples">Per-channel sample arrays.</param>
+/// <param name="count">Number of samples in each array.</param>
+/// <param name="timestamp">CLOCK_MONOTONIC time the block was read.</param>
+static void StoreBlock(short* const* samples, int count, const struct timespec* timestamp)
+{
+	const long long samplePeriodNs = 1000000000LL / AUDIO_SAMPLE_RATE;
+	long long lastSampleNs = TimespecToNs(timestamp);
+	for (int i = 0; i < count; ++i) {
+		StoreSamples(samples, i, lastSampleNs - (count - 1 - i) * samplePeriodNs);
+	}
+	captureStats->samples += (unsigned int)count;
+}
+
+/// <summary>
+///     Passes the samples captured since the last block through the decimator and the
+///     resampler into the audio buffers. Every channel gets the same block sizes and
+///     timestamps, so their filters stay in step.
+/// </summary>
+/// <param name="sourcePeriods">
+///		Sample periods of the source's clock the block accounts for: the periods read and those
+///		lost to missed timer expirations, but not the filled-in shortfall of a source which could
+///		not keep up.
+///	</param>
+/// <param name="timestamp">CLOCK_MONOTONIC time the last sample of the block was read.</param>
+static void StoreCapturedBlock(uint64_t sourcePeriods, const struct timespec* timestamp)
+{
+	short* blocks[MAX_AUDIO_CHANNELS];
+	int blockCount = capturedCount;
+	for (int channel = 0; channel < channelCount; ++channel) {
+#if AUDIO_DECIMATION > 1
+		// everything after this runs at AUDIO_SAMPLE_RATE
+		blockCount = decimator_process(&channels[channel].decimator, channels[channel].block,
+			capturedCount, channels[channel].block);
+#endif
+		resampler_update_rate(&channels[channel].resampler, (double)sourcePeriods / AUDIO_DECIMATION,
+			timestamp);
+		blocks[channel] = channels[channel].block;
+	}
+	captureStats->input_rate = (float)channels[0].resampler.input_rate;
+#if AUDIO_DRIFT_CORRECTION
+	// only a live source which buffers its samples runs on its own clock; a polled source is
+	// sampled on the capture timer, so its rate is exact and resampling would only filter it
+	if (!audioSource->live || audioSource->max_block > 0) {
+		StoreBlock(blocks, blockCount, timestamp);
+		capturedCount = 0;
+		return;
+	}
+	short* resampled[MAX_AUDIO_CHANNELS];
+	int count = 0;
+	struct timespec start, done;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	for (int channel = 0; channel < channelCount; ++channel) {
+		resampled[channel] = channels[channel].resampled;
+		count = resampler_process(&channels[channel].resampler, channels[channel].block,
+			blockCount, resampled[channel], RESAMPLER_MAX_OUTPUT);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &done);
+	captureStats->resample_ns += TimespecToNs(&done) - TimespecToNs(&start);
+#else
+	short* const* resampled = blocks;
+	int count = blockCount;
+#endif
+	StoreBlock(resampled, count, timestamp);
+	capturedCount = 0;
+}
+
+/// <summary>
+///     Replaces the samples that were missed while the capture thread was late, so that every
+///     frame still covers AUDIO_FRAME_SIZE sample periods of wall time.
+/// </summary>
+/// <param name="missedSamples">Number of capture sample periods that passed without a reading.</param>
+/// <param name="nextSamples">
+///		First samples captured after the gap, one per channel, or NULL to hold the last samples.
+///	</param>
+static void FillGap(uint64_t missedSamples, const short* nextSamples)
+{
+	// whole frames of missing audio are not worth inventing, so their hops count as dropped
+	uint64_t missedFrames = missedSamples / AUDIO_CAPTURE_FRAME_SIZE;
+	missedSamples -= missedFrames * AUDIO_CAPTURE_FRAME_SIZE;
+	uint64_t missedHops = missedFrames * AUDIO_FRAME_HOPS;
+	// the dropped hops keep their sequence numbers, so the gap is visible downstream
+	nextSequence += missedHops;
+
+	short start[MAX_AUDIO_CHANNELS];
+	for (int channel = 0; channel < channelCount; ++channel) {
+		atomic_fetch_add_explicit(&channels[channel].buffer->dropped_frames, (unsigned int)missedHops,
+			memory_order_relaxed);
+		start[channel] = channels[channel].lastSample;
+	}
+	if (nextSamples == NULL) {
+		nextSamples = start;
+	}
+	int span = (int)missedSamples + 1;
+	short filled[MAX_AUDIO_CHANNELS];
+	for (int i = 1; i < span; ++i) {
+		for (int channel = 0; channel < channelCount; ++channel) {
+#if AUDIO_GAP_FILL_INTERPOLATE
+			filled[channel] = (short)(start[channel] + (nextSamples[channel] - start[channel]) * i / span);
+#else
+			filled[channel] = start[channel];
+#endif
 		}
+		CaptureSamples(filled, true);
+	}
+}
+
+/// <summary>
+///     Reads the samples that became due since the last wakeup from the audio source each time
+///     the capture timer fires, and sends a notification whenever a frame completes.
+///     If the timer expired more than once since the last wakeup, a live source has lost the
+///     missed samples, so they are filled in before the new samples are added. Other sources
+///     catch up by reading the missed samples. A live source which delivers fewer samples than
+///     are due runs on a slower clock, which the drift correction measures and makes up for.
+///     A polled source is read a few samples at a time, so its samples are collected over
+///     several wakeups and timestamped, filtered and stored once AUDIO_CAPTURE_BLOCK_SIZE of them
+///     are in; the wakeups in between only read the source.
+/// </summary>
+static void MicrophoneRecordEventHandler(EventData* eventData)
+{
+	uint64_t expirations;
+	if (ConsumeTimerFdEventCount(microphonePollTimerFd, &expirations) != 0) {
+		terminationRequired = true;
+		return;
+	}
+	captureStats->wakeups += 1;
+	uint64_t missedSamples = (expirations - 1) * (uint64_t)readSize;
+	// a block ends once it is full, and at a gap, which is stored as a block of its own
+	bool blockEnds = capturedCount + readSize >= AUDIO_CAPTURE_BLOCK_SIZE || missedSamples > 0;
+	if (blockEnds) {
+		// a missed expiration counts as lateness of the first one, which is when the samples
+		// were due; wakeups in the middle of a block are not timed, but late ones always are
+		struct timespec wakeTime;
+		clock_gettime(CLOCK_MONOTONIC, &wakeTime);
+		RecordWakeLatency(TimespecToNs(&wakeTime) - nextExpirationNs);
+	}
+	long long firstExpirationNs = nextExpirationNs;
+	nextExpirationNs += (long long)expirations * readPeriodNs;
+
+	int due = readSize;
+	if (!audioSource->live) {
+		int space = CAPTURE_MAX_BLOCK - capturedCount;
+		due = (missedSamples + due > (uint64_t)space) ? space : (int)missedSamples + due;
+		missedSamples = 0;
+	}
+	if (missedSamples > 0 && capturedCount > 0) {
+		// the samples before the gap are stored first, so that the hops dropped in the gap are
+		// numbered after them; the last of them was read for the previous expiration
+		struct timespec lastReadTime;
+		NsToTimespec(firstExpirationNs - readPeriodNs, &lastReadTime);
+		StoreCapturedBlock(capturedPeriods, &lastReadTime);
+		capturedPeriods = 0;
+	}
+
+	int count = audioSource->read_block(audioSource, sourceBlock, due);
+	if (count < 0) {
+		Log_Debug("INFO: Audio source '%s' has no more samples.\n", audioSource->name);
+		terminationRequired = true;
+		return;
+	}
+	if (missedSamples > 0) {
+		captureStats->lost_samples += (unsigned int)missedSamples;
+		FillGap(missedSamples, count > 0 ? sourceBlock : NULL);
+	}
+	for (int i = 0; i < count; ++i) {
+		CaptureSamples(sourceBlock + i * channelCount, false);
+	}
+#if !AUDIO_DRIFT_CORRECTION
+	if (audioSource->live && count < due) {
+		// the source could not keep up, so hold the last samples for the rest of the read
+		FillGap((uint64_t)(due - count), NULL);
+	}
+#endif
+	capturedPeriods += (uint64_t)count + missedSamples;
+	if (blockEnds) {
+		// the last sample of the block was taken by the time read_block returned
+		struct timespec readTime;
+		clock_gettime(CLOCK_MONOTONIC, &readTime);
+		StoreCapturedBlock(capturedPeriods, &readTime);
+		capturedPeriods = 0;
 	}
 }
 
 struct EventData adcPollingEventData = { .eventHandler = &MicrophoneRecordEventHandler };
 
 /// <summary>
-///     Opens and initializes ADC channel 1 (which has the microphone attached),
-///     and creates an event handler to measure the ADC value periodically.
+///     Checks the opened audio source and creates an event handler to read from it periodically.
 /// </summary>
-static int InitMicrophone(void)
+/// <param name="audioBuffers">One AudioBuffer per channel.</param>
+/// <param name="bufferCount">Number of AudioBuffers, the most channels the source may have.</param>
+static int InitAudioSource(AudioBuffer* const* audioBuffers, int bufferCount)
 {
 	// create a separate epoll to avoid waking up main thread
 	threadEpollFd = CreateEpollFd();
@@ -77,36 +405,108 @@ static int InitMicrophone(void)
 		return -1;
 	}
 
-	Log_Debug("INFO: Opening ADC Controller.\n");
-	adcControllerFd = ADC_Open(MICROPHONE_CONTROLLER);
-	if (adcControllerFd < 0) {
-		Log_Debug("ERROR: ADC_Open failed with error: %s (%d)\n", strerror(errno), errno);
+	if (audioSource->sample_rate != AUDIO_CAPTURE_RATE || audioSource->channels < 1
+		|| audioSource->channels > bufferCount) {
+		Log_Debug("ERROR: Audio source delivers %d Hz with %d channels, expecting %d Hz with 1 to %d channels.\n",
+			audioSource->sample_rate, audioSource->channels, AUDIO_CAPTURE_RATE, bufferCount);
 		return -1;
 	}
+	channelCount = audioSource->channels;
 
-	adcBitCount = ADC_GetSampleBitCount(adcControllerFd, MICROPHONE);
-	if (adcBitCount == -1) {
-		Log_Debug("ERROR: ADC_GetSampleBitCount failed with error : %s (%d)\n", strerror(errno), errno);
-		return -1;
+	// a block read from a source which is only sampled when it is polled would squeeze
+	// readings taken back to back into several sample periods
+	readSize = AUDIO_CAPTURE_BLOCK_SIZE;
+	if (audioSource->max_block > 0 && audioSource->max_block < readSize) {
+		readSize = audioSource->max_block;
 	}
-	if (adcBitCount == 0) {
-		Log_Debug("ERROR: ADC_GetSampleBitCount returned sample size of 0 bits.\n");
-		return -1;
-	}
-	Log_Debug("INFO: ADC sample bit count: %d.\n", adcBitCount);
+	captureStats->block_size = readSize;
+	capturedCount = 0;
+	capturedPeriods = 0;
 
-	// record an audio sample every 1sec/AUDIO_SAMPLE_RATE = 1000000000ns/AUDIO_SAMPLE_RATE
-	struct timespec adcCheckPeriod = { .tv_nsec = 1000000000 / AUDIO_SAMPLE_RATE};
+	// read audio samples every
+	// readSize * 1sec/AUDIO_CAPTURE_RATE = readSize * 1000000000ns/AUDIO_CAPTURE_RATE
+	readPeriodNs = readSize * 1000000000LL / AUDIO_CAPTURE_RATE;
+	struct timespec adcCheckPeriod = {
+		.tv_sec = (time_t)(readPeriodNs / 1000000000LL),
+		.tv_nsec = (long)(readPeriodNs % 1000000000LL)
+	};
+	Log_Debug("INFO: Reading %d samples every %lld us and storing blocks of %d at %d Hz, classifying at %d Hz.\n",
+		readSize, readPeriodNs / 1000, AUDIO_CAPTURE_BLOCK_SIZE, AUDIO_CAPTURE_RATE, AUDIO_SAMPLE_RATE);
+	for (int channel = 0; channel < channelCount; ++channel) {
+		channels[channel].buffer = audioBuffers[channel];
+		channels[channel].lastSample = 0;
+		decimator_init(&channels[channel].decimator);
+		resampler_init(&channels[channel].resampler);
+	}
 	microphonePollTimerFd =
 		CreateTimerFdAndAddToEpoll(threadEpollFd, &adcCheckPeriod, &adcPollingEventData, EPOLLIN);
 	if (microphonePollTimerFd < 0) {
 		Log_Debug("Bad ADC timer file descriptor.\n");
 		return -1;
 	}
+	// remember when the timer first expires, wakeups are measured against its expirations
+	struct timespec now;
+	struct itimerspec timerValue;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	if (timerfd_gettime(microphonePollTimerFd, &timerValue) != 0) {
+		Log_Debug("ERROR: Could not read capture timer: %s (%d).\n", strerror(errno), errno);
+		return -1;
+	}
+	nextExpirationNs = TimespecToNs(&now) + TimespecToNs(&timerValue.it_value);
 
 	return 0;
 }
 
+#if AUDIO_CAPTURE_REALTIME
+/// <summary>
+///     Touches the stack the capture thread will use, so its pages are resident before
+///     the first deadline.
+/// </summary>
+static void PrefaultStack(void)
+{
+	volatile unsigned char stack[AUDIO_CAPTURE_STACK_PREFAULT];
+	for (size_t i = 0; i < sizeof(stack); i += 256) {
+		stack[i] = 0;
+	}
+}
+
+/// <summary>
+///     Moves the calling thread to SCHED_FIFO, pins it to AUDIO_CAPTURE_CPU and locks the
+///     process memory, which includes the audio buffers and thread stacks. Each step is
+///     optional: a failure is logged and the remaining steps are still attempted.
+/// </summary>
+/// <returns>True if the thread now has real-time scheduling.</returns>
+static bool EnterRealTimeMode(void)
+{
+	bool realtime = true;
+	struct sched_param param = { .sched_priority = AUDIO_CAPTURE_PRIORITY };
+	int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+	if (result != 0) {
+		Log_Debug("WARNING: Could not set SCHED_FIFO priority %d: %s (%d).\n",
+			AUDIO_CAPTURE_PRIORITY, strerror(result), result);
+		realtime = false;
+	}
+
+	cpu_set_t cpus;
+	CPU_ZERO(&cpus);
+	CPU_SET(AUDIO_CAPTURE_CPU, &cpus);
+	if (sched_setaffinity(0, sizeof(cpus), &cpus) != 0) {
+		Log_Debug("WARNING: Could not pin capture thread to CPU %d: %s (%d).\n",
+			AUDIO_CAPTURE_CPU, strerror(errno), errno);
+	}
+
+	// the audio buffers and both thread stacks already exist. MCL_FUTURE is left out because
+	// later allocations, e.g. by the IoT Hub client, would fail once the lock limit is reached
+	if (mlockall(MCL_CURRENT) != 0) {
+		Log_Debug("WARNING: Could not lock memory: %s (%d).\n", strerror(errno), errno);
+	}
+	PrefaultStack();
+
+	Log_Debug("INFO: Capture thread real-time scheduling %s.\n", realtime ? "enabled" : "unavailable");
+	return realtime;
+}
+#endif
+
 /// <summary>
 ///    Closes all file descriptors opened in this thread
 /// </summary>
@@ -114,23 +514,27 @@ static void CloseFileDescriptors(void)
 {
 	Log_Debug("INFO: Closing record audio thread file descriptors.\n");
 	CloseFdAndPrintError(microphonePollTimerFd, "ADCTimer");
-	CloseFdAndPrintError(adcControllerFd, "ADC");
 	CloseFdAndPrintError(threadEpollFd, "ThreadEpoll");
 }
 
 /// <summary>
-///     Runs an infinite loop which records audio from the microphone in socket 1 and processes it
-///     it to create features that can be input into the classifier.
+///     Runs an infinite loop which records audio from the configured audio source and hands
+///     complete frames of each channel to the main loop through that channel's AudioBuffer.
 /// </summary>
-/// <param name="vargp">Variable arguments; currently unused</param>
+/// <param name="vargp">Used to pass the RecordAudioContext struct.</param>
 /// <returns>NULL</returns>
 void* RecordAudioThread(void* vargp)
 {
 	Log_Debug("INFO: Starting record audio thread.\n");
 
-	audioBuf = (AudioBuffer*)vargp;
+	RecordAudioContext* context = (RecordAudioContext*)vargp;
+	audioSource = context->source;
+	captureStats = &context->stats;
+#if AUDIO_CAPTURE_REALTIME
+	captureStats->realtime = EnterRealTimeMode();
+#endif
 
-	if (InitMicrophone() != 0) {
+	if (InitAudioSource(context->buffers, context->buffer_count) != 0) {
 		terminationRequired = true;
 	}
 
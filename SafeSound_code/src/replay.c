@@ -0,0 +1,167 @@
+#include "replay.h"
+#include <string.h>
+#include <time.h>
+#include <applibs/log.h>
+
+#include "common.h"
+
+/// <summary>
+///     Fills samples from the source, decimating it to AUDIO_SAMPLE_RATE if it runs at
+///     AUDIO_CAPTURE_RATE instead.
+/// </summary>
+/// <param name="decimator">Decimator for a capture-rate source, NULL for a source at AUDIO_SAMPLE_RATE.</param>
+/// <returns>True if all samples were read, false at the end of the source.</returns>
+static bool ReadSamples(AudioSource* source, Decimator* decimator, short* samples, int sampleCount)
+{
+	short captured[AUDIO_CAPTURE_FRAME_SIZE];
+	int total = 0;
+	while (total < sampleCount) {
+		int count;
+		if (decimator == NULL) {
+			count = source->read_block(source, samples + total, sampleCount - total);
+		}
+		else {
+			// at most two captured samples per missing sample, so the output cannot overshoot
+			count = source->read_block(source, captured, (sampleCount - total) * AUDIO_DECIMATION);
+			if (count > 0) {
+				count = decimator_process(decimator, captured, count, samples + total);
+			}
+		}
+		if (count < 0) {
+			return false;
+		}
+		total += count;
+	}
+	return true;
+}
+
+static long long NsBetween(const struct timespec* start, const struct timespec* end)
+{
+	return (end->tv_sec - start->tv_sec) * 1000000000LL + (end->tv_nsec - start->tv_nsec);
+}
+
+bool replay_open(Replay* replay, AudioSource* source, float threshold)
+{
+	memset(replay, 0, sizeof(*replay));
+	if (source->open(source) != 0) {
+		return false;
+	}
+	// a file at any other rate would be classified at the wrong speed
+	bool rateMatches = source->sample_rate == AUDIO_SAMPLE_RATE
+		|| (AUDIO_DECIMATION > 1 && source->sample_rate == AUDIO_CAPTURE_RATE);
+	if (!rateMatches || source->channels != 1) {
+		if (AUDIO_DECIMATION > 1) {
+			Log_Debug("ERROR: Replay needs %d or %d Hz mono audio for the %d Hz profile, got %d Hz with %d channels.\n",
+				AUDIO_SAMPLE_RATE, AUDIO_CAPTURE_RATE, AUDIO_SAMPLE_RATE, source->sample_rate, source->channels);
+		}
+		else {
+			Log_Debug("ERROR: Replay needs %d Hz mono audio for the %d Hz profile, got %d Hz with %d channels.\n",
+				AUDIO_SAMPLE_RATE, AUDIO_SAMPLE_RATE, source->sample_rate, source->channels);
+		}
+		source->close(source);
+		return false;
+	}
+	replay->source = source;
+	replay->threshold = threshold;
+	// audio recorded at the capture rate goes through the same filter as live audio
+	replay->decimate = source->sample_rate != AUDIO_SAMPLE_RATE;
+	if (replay->decimate) {
+		decimator_init(&replay->decimator);
+	}
+	if (!predict_hold(&replay->state)) {
+		Log_Debug("ERROR: Replay needs the classifier, which another replay or simulation holds.\n");
+		source->close(source);
+		return false;
+	}
+	activity_detector_init(&replay->detector);
+	replay->filled = ReadSamples(source, replay->decimate ? &replay->decimator : NULL, replay->frame,
+		AUDIO_FRAME_SIZE);
+	return true;
+}
+
+bool replay_step(Replay* replay, int maxFrames)
+{
+	struct timespec start, end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	ReplayResult* result = &replay->result;
+	Decimator* decimator = replay->decimate ? &replay->decimator : NULL;
+	for (int i = 0; i < maxFrames && replay->filled; ++i) {
+		int prediction;
+		float overall_confidence;
+		// replayed audio has no capture time, the sequence number locates it in the source
+		FrameInfo info = { .sequence = result->frames };
+		if (predict_active_frame(&replay->detector, &replay->state, replay->frame, &info, false,
+			&prediction, &overall_confidence) == 0) {
+			++result->skipped_frames;
+		}
+		++result->frames;
+		// background noise is not an event, as in HandlePrediction
+		if (overall_confidence > replay->threshold && prediction != 0) {
+			if (result->detection_count < REPLAY_MAX_DETECTIONS) {
+				ReplayDetection* detection = &result->detections[result->detection_count];
+				detection->prediction = prediction;
+				detection->confidence = overall_confidence;
+				detection->decision_sample = info.sequence * AUDIO_HOP_SIZE + AUDIO_FRAME_SIZE;
+				detection->onset_sample = replay->state.onset.sequence * AUDIO_HOP_SIZE;
+			}
+			++result->detection_count;
+		}
+		// slide the frame along by one hop, the same frames the live pipeline sees
+		memmove(replay->frame, replay->frame + AUDIO_HOP_SIZE,
+			(AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE) * sizeof(short));
+		replay->filled = ReadSamples(replay->source, decimator,
+			replay->frame + AUDIO_FRAME_SIZE - AUDIO_HOP_SIZE, AUDIO_HOP_SIZE);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	replay->processing_ns += NsBetween(&start, &end);
+	return replay->filled;
+}
+
+void replay_close(Replay* replay)
+{
+	predict_release(&replay->state);
+	replay->source->close(replay->source);
+
+	ReplayResult* result = &replay->result;
+	if (result->frames > 0) {
+		result->samples = (unsigned long long)(result->frames - 1) * AUDIO_HOP_SIZE + AUDIO_FRAME_SIZE;
+	}
+	result->audio_seconds = (float)result->samples / AUDIO_SAMPLE_RATE;
+	result->processing_seconds = (float)replay->processing_ns / 1000000000.0f;
+	if (result->audio_seconds > 0) {
+		result->real_time_factor = result->processing_seconds / result->audio_seconds;
+	}
+	if (result->processing_seconds > 0) {
+		result->frames_per_second = result->frames / result->processing_seconds;
+	}
+}
+
+bool replay_audio_source(AudioSource* source, float threshold, ReplayResult* result)
+{
+	static Replay replay;  // too large for the stack
+	if (!replay_open(&replay, source, threshold)) {
+		memset(result, 0, sizeof(*result));
+		return false;
+	}
+	while (replay_step(&replay, AUDIO_DRAIN_BUDGET)) {
+	}
+	replay_close(&replay);
+	*result = replay.result;
+	return true;
+}
+
+bool replay_wav_file(const char* path, float threshold, ReplayResult* result)
+{
+	AudioSource* source = wav_audio_source_create(path);
+	if (source == NULL) {
+		return false;
+	}
+	bool success = replay_audio_source(source, threshold, result);
+	audio_source_destroy(source);
+	if (success) {
+		Log_Debug("INFO: Replayed '%s': %u frames (%u skipped) in %.3f s, real-time factor %.4f, %.1f frames/s, %d detections.\n",
+			path, result->frames, result->skipped_frames, result->processing_seconds,
+			result->real_time_factor, result->frames_per_second, result->detection_count);
+	}
+	return success;
+}
@@ -0,0 +1,154 @@
+#include "resampler.h"
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+// Samples before the output position which contribute to it
+#define TAPS_BEFORE (RESAMPLER_TAPS / 2 - 1)
+// Low-pass cutoff as a fraction of the Nyquist frequency
+#define CUTOFF 0.9
+// Seconds of audio used for each rate measurement
+#define RATE_WINDOW_SECONDS 1.0
+// Weight given to each new rate measurement
+#define RATE_SMOOTHING 0.2
+
+// Fractional bits of the fixed-point taps
+#define TAP_BITS 15
+
+// Windowed-sinc taps for each fractional phase in Q15. The extra row allows interpolating
+// between the last phase and the next whole sample.
+static short taps[RESAMPLER_PHASES + 1][RESAMPLER_TAPS];
+static bool tapsReady = false;
+
+static void compute_taps(void)
+{
+	const double pi = 3.14159265358979323846;
+	const double halfWidth = RESAMPLER_TAPS / 2;
+	for (int phase = 0; phase <= RESAMPLER_PHASES; ++phase) {
+		double frac = (double)phase / RESAMPLER_PHASES;
+		double values[RESAMPLER_TAPS];
+		double sum = 0;
+		for (int k = 0; k < RESAMPLER_TAPS; ++k) {
+			// distance from input sample k to the output position
+			double t = k - TAPS_BEFORE - frac;
+			double x = pi * CUTOFF * t;
+			double sinc = (t == 0) ? 1.0 : sin(x) / x;
+			double window = (fabs(t) < halfWidth) ? 0.5 * (1.0 + cos(pi * t / halfWidth)) : 0.0;
+			values[k] = sinc * window;
+			sum += values[k];
+		}
+		// normalize for unity gain at DC; the largest tap is 1.0, so clamp it into Q15
+		for (int k = 0; k < RESAMPLER_TAPS; ++k) {
+			long tap = lround(values[k] / sum * (1 << TAP_BITS));
+			taps[phase][k] = (short)(tap > 32767 ? 32767 : tap);
+		}
+	}
+	tapsReady = true;
+}
+
+void resampler_init(Resampler* rs)
+{
+	if (!tapsReady) {
+		compute_taps();
+	}
+	// start with silence before the first sample so output begins immediately
+	memset(rs->history, 0, sizeof(rs->history));
+	rs->history_length = TAPS_BEFORE;
+	rs->position = TAPS_BEFORE;
+	rs->step = 1.0;
+	rs->input_rate = AUDIO_SAMPLE_RATE;
+	rs->window_samples = 0;
+	rs->window_started = false;
+}
+
+void resampler_update_rate(Resampler* rs, double samples, const struct timespec* timestamp)
+{
+	if (!rs->window_started) {
+		// samples received before the window opened belong to an unknown period
+		rs->window_start = *timestamp;
+		rs->window_samples = 0;
+		rs->window_started = true;
+		return;
+	}
+	rs->window_samples += samples;
+	double elapsed = (double)(timestamp->tv_sec - rs->window_start.tv_sec)
+		+ (double)(timestamp->tv_nsec - rs->window_start.tv_nsec) / 1000000000.0;
+	if (elapsed < RATE_WINDOW_SECONDS) {
+		return;
+	}
+
+	double measured = rs->window_samples / elapsed;
+	rs->input_rate += RATE_SMOOTHING * (measured - rs->input_rate);
+	double step = rs->input_rate / AUDIO_SAMPLE_RATE;
+	if (step < 1.0 - RESAMPLER_MAX_DRIFT) {
+		step = 1.0 - RESAMPLER_MAX_DRIFT;
+	}
+	else if (step > 1.0 + RESAMPLER_MAX_DRIFT) {
+		step = 1.0 + RESAMPLER_MAX_DRIFT;
+	}
+	rs->step = step;
+	rs->window_start = *timestamp;
+	rs->window_samples = 0;
+}
+
+int resampler_process(Resampler* rs, const short* input, int inputCount,
+	short* output, int outputSize)
+{
+	int space = RESAMPLER_TAPS + RESAMPLER_MAX_INPUT - rs->history_length;
+	if (inputCount > space) {
+		inputCount = space;
+	}
+	memcpy(rs->history + rs->history_length, input, inputCount * sizeof(short));
+	rs->history_length += inputCount;
+
+	// at a step of 1.0 from a whole sample, e.g. before the first rate measurement, the input
+	// passes through untouched; the low-pass taps would take the top of the band off it
+	bool passThrough = rs->step == 1.0 && rs->position == (double)(int)rs->position;
+	int count = 0;
+	while (count < outputSize) {
+		int base = (int)rs->position;
+		if (base + RESAMPLER_TAPS - TAPS_BEFORE > rs->history_length) {
+			// not enough input after the position yet
+			break;
+		}
+		if (passThrough) {
+			output[count++] = rs->history[base];
+			rs->position += 1.0;
+			continue;
+		}
+		float phase = (float)(rs->position - base) * RESAMPLER_PHASES;
+		int index = (int)phase;
+		float weight = phase - (float)index;
+		const short* x = rs->history + base - TAPS_BEFORE;
+		const short* h0 = taps[index];
+		const short* h1 = taps[index + 1];
+		// the taps of each phase sum to 1.0 with a small overshoot, so the Q30 sums fit in 32 bits
+		int32_t acc0 = 0;
+		int32_t acc1 = 0;
+		for (int k = 0; k < RESAMPLER_TAPS; ++k) {
+			acc0 += x[k] * h0[k];
+			acc1 += x[k] * h1[k];
+		}
+		float value = ((float)acc0 + (float)(acc1 - acc0) * weight) / (1 << TAP_BITS);
+		if (value > 32767.0f) {
+			value = 32767.0f;
+		}
+		else if (value < -32768.0f) {
+			value = -32768.0f;
+		}
+		output[count++] = (short)lrintf(value);
+		rs->position += rs->step;
+	}
+
+	// discard the input that no future output depends on
+	int consumed = (int)rs->position - TAPS_BEFORE;
+	if (consumed > rs->history_length) {
+		consumed = rs->history_length;
+	}
+	if (consumed > 0) {
+		rs->history_length -= consumed;
+		memmove(rs->history, rs->history + consumed, rs->history_length * sizeof(short));
+		rs->position -= consumed;
+	}
+	return count;
+}
@@ -0,0 +1,185 @@
+#!/usr/bin/env python3
+"""Generates inc/log_mel_tables.h, the read-only tables of the native log-mel featurizer.
+
+The tables depend on the sample rate, the FFT size and the number of mel filters. The header
+holds one set of tables per configuration, selected by AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and
+LOG_MEL_FILTERS, and fails to compile for any other configuration. Rerun this script after
+changing one of them, e.g.
+
+    python3 tools/generate_log_mel_tables.py --config 16000 512 80 --config 8000 256 80
+
+The values are computed the way ELL's featurizer computes them, in double precision and then
+rounded to float, so that the features match it.
+"""
+
+import argparse
+import math
+import os
+import struct
+
+DEFAULT_CONFIGS = [(16000, 512, 80), (8000, 256, 80)]
+OUTPUT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "inc", "log_mel_tables.h")
+VALUES_PER_LINE = 8
+
+
+def to_float(value):
+    """Rounds a double to the nearest float."""
+    return struct.unpack("<f", struct.pack("<f", value))[0]
+
+
+def lround(value):
+    """Rounds half away from zero, as C's lround does."""
+    return int(math.copysign(math.floor(abs(value) + 0.5), value))
+
+
+def float_literal(value):
+    text = "%.9g" % value
+    if "." not in text and "e" not in text:
+        text += ".0"
+    return text + "f"
+
+
+def hz_to_mel(hz):
+    return 1127.0 * math.log(1.0 + hz / 700.0)
+
+
+def mel_to_hz(mel):
+    return 700.0 * (math.exp(mel / 1127.0) - 1.0)
+
+
+def mel_filters(sample_rate, fft_size, filter_count):
+    """Returns the first bin and the non-zero float weights of each triangular mel filter."""
+    # the filter edges are evenly spaced in mel and rounded down to bins, as in ELL's
+    # MelFilterBank. Filter f rises from points[f] to its peak at points[f + 1] and falls to
+    # points[f + 2]. The rising edge starts with a weight of 0, which is left out.
+    mel_max = hz_to_mel(sample_rate / 2.0)
+    points = [math.floor((fft_size + 1) * mel_to_hz(mel_max * i / (filter_count + 1)) / sample_rate)
+              for i in range(filter_count + 2)]
+    filters = []
+    for f in range(filter_count):
+        start, center, end = points[f], points[f + 1], points[f + 2]
+        first_bin = start + 1 if center > start else center
+        # float division of small integers, which a double division rounded to float matches
+        weights = [to_float(j / (center - start)) for j in range(1, center - start)]
+        weights += [to_float((end - center - j) / (end - center)) for j in range(end - center)]
+        filters.append((first_bin, weights))
+    return filters
+
+
+def array(c_type, name, values, comment, formatter=str):
+    lines = ["// " + line for line in comment.split("\n")]
+    lines.append("static const %s %s[%d] = {" % (c_type, name, len(values)))
+    for start in range(0, len(values), VALUES_PER_LINE):
+        chunk = values[start:start + VALUES_PER_LINE]
+        lines.append("\t" + ", ".join(formatter(v) for v in chunk) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def config_tables(sample_rate, fft_size, filter_count):
+    if fft_size < 4 or fft_size & (fft_size - 1):
+        raise ValueError("the FFT size must be a power of two of at least 4")
+    half = fft_size // 2
+    twiddle_re, twiddle_im = [], []
+    span = 1
+    while span < half:
+        for k in range(span):
+            angle = -math.pi * k / span
+            twiddle_re.append(math.cos(angle))
+            twiddle_im.append(math.sin(angle))
+        span *= 2
+    split_re, split_im = [], []
+    for k in range(half // 2 + 1):
+        angle = -2 * math.pi * k / fft_size
+        split_re.append(math.cos(angle))
+        split_im.append(math.sin(angle))
+    bits = half.bit_length() - 1
+    bit_reverse = [int(format(i, "0%db" % bits)[::-1], 2) if bits else 0 for i in range(half)]
+
+    filters, weights = [], []
+    for first_bin, filter_weights in mel_filters(sample_rate, fft_size, filter_count):
+        filters.append((first_bin, len(filter_weights), len(weights)))
+        weights += filter_weights
+
+    def q30(value):
+        return lround(value * (1 << 30))
+
+    def f32(value):
+        return float_literal(to_float(value))
+
+    return "\n\n".join([
+        array("float", "twiddleRe", twiddle_re,
+              "Twiddles of all stages of the half-size FFT, e^(-2 pi i k / (2 * span)) for k < span at\n"
+              "index span - 1 + k, so each stage reads its twiddles in order", f32),
+        array("float", "twiddleIm", twiddle_im, "Imaginary parts of twiddleRe", f32),
+        array("unsigned short", "bitReverse", bit_reverse, "Bit-reversed index of each sample of the half-size FFT"),
+        array("float", "splitRe", split_re,
+              "Twiddles of the split, e^(-2 pi i k / LOG_MEL_FFT_SIZE) for k <= HALF_SIZE / 2", f32),
+        array("float", "splitIm", split_im, "Imaginary parts of splitRe", f32),
+        array("MelFilter", "filters", filters, "Triangular mel filters",
+              lambda v: "{ %d, %d, %d }" % v),
+        array("float", "filterWeights", weights,
+              "Weights of all filters one after the other, fewer than two per bin", float_literal),
+        array("int32_t", "twiddleReQ30", [q30(v) for v in twiddle_re],
+              "Fixed-point copies of the tables for log_mel_filter_pcm. The twiddles are in Q30, which\n"
+              "holds 1 exactly, so the trivial twiddles do not leak into the other bins."),
+        array("int32_t", "twiddleImQ30", [q30(v) for v in twiddle_im], "Imaginary parts of twiddleReQ30"),
+        array("int32_t", "splitReQ30", [q30(v) for v in split_re], "splitRe in Q30"),
+        array("int32_t", "splitImQ30", [q30(v) for v in split_im], "splitIm in Q30"),
+        array("uint16_t", "filterWeightsQ15", [lround(w * 32768.0) for w in weights],
+              "filterWeights in Q15, where 32768 is a weight of 1"),
+    ])
+
+
+def generate(configs):
+    parts = [
+        "// Generated by tools/generate_log_mel_tables.py, do not edit.",
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#include \"log_mel.h\"",
+        "",
+        "// Non-zero weights of one triangular mel filter, which covers bins first_bin to",
+        "// first_bin + length - 1",
+        "typedef struct MelFilter {",
+        "\tunsigned short first_bin;",
+        "\tunsigned short length;",
+        "\tunsigned short offset;  // index of the weight of first_bin in filterWeights",
+        "} MelFilter;",
+        "",
+        array("uint32_t", "sqrtTable", [lround(math.sqrt(64.0 + i) * (1 << 27)) for i in range(193)],
+              "sqrt(64 + i) for i <= 192 in Q27, the roots of the top bits of normalized squares"),
+        "",
+        array("int32_t", "log2Table", [lround(math.log2(1.0 + i / 256.0) * 65536.0) for i in range(257)],
+              "log2(1 + i / 256) for i <= 256 in Q16"),
+        "",
+    ]
+    for index, (sample_rate, fft_size, filter_count) in enumerate(configs):
+        parts.append("%s AUDIO_SAMPLE_RATE == %d && LOG_MEL_FFT_SIZE == %d && LOG_MEL_FILTERS == %d"
+                     % ("#if" if index == 0 else "#elif", sample_rate, fft_size, filter_count))
+        parts.append("")
+        parts.append(config_tables(sample_rate, fft_size, filter_count))
+        parts.append("")
+    parts.append("#else")
+    parts.append("#error No log-mel tables for this AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and LOG_MEL_FILTERS, "
+                 "run tools/generate_log_mel_tables.py")
+    parts.append("#endif")
+    return "\n".join(parts) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--config", nargs=3, type=int, action="append",
+                        metavar=("SAMPLE_RATE", "FFT_SIZE", "FILTERS"),
+                        help="configuration to generate tables for, may be repeated "
+                             "(default: 16000 512 80 and 8000 256 80)")
+    parser.add_argument("--output", default=OUTPUT, help="header to write (default: inc/log_mel_tables.h)")
+    args = parser.parse_args()
+    configs = [tuple(c) for c in args.config] if args.config else DEFAULT_CONFIGS
+    with open(args.output, "w", newline="\n") as output:
+        output.write(generate(configs))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+#!/usr/bin/env python3
+"""Generates inc/window_break_features.h, the log-mel features of the prerecorded clip.
+
+The simulated event classifies these features instead of featurizing inc/window_break.h on the
+device. The header holds the features of every row of the clip for each configuration, selected
+by AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and LOG_MEL_FILTERS, and fails to compile for any other
+configuration. Rerun this script after changing the clip or one of them, e.g.
+
+    python3 tools/generate_prerecorded_features.py --config 16000 512 80 --config 8000 256 80
+
+The clip is recorded at the capture rate. For lower rates it goes through the same half-band
+decimator as the captured audio, and the features are computed in double precision the way the
+native featurizer computes them. check_predict_setup checks them against the featurizer in use.
+"""
+
+import argparse
+import cmath
+import math
+import os
+import re
+
+from generate_log_mel_tables import DEFAULT_CONFIGS, float_literal, lround, mel_filters, to_float
+
+CAPTURE_RATE = 16000  # AUDIO_CAPTURE_RATE
+DECIMATOR_TAPS = 31  # DECIMATOR_TAPS of decimator.h
+TAP_BITS = 15
+OFFSET = 1.0  # LOG_MEL_OFFSET
+INC = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "inc")
+
+
+def read_clip(path):
+    """Returns the rows of 16-bit samples of sample_wav_data."""
+    with open(path) as clip:
+        text = clip.read()
+    body = text[text.index("= {") + 3:]
+    return [[int(float(v)) for v in row.split(",") if v.strip()] for row in re.findall(r"\{([^{}]*)\}", body)]
+
+
+def decimator_taps():
+    """Taps of the half-band filter in Q15 at odd distances from the center, as decimator.c computes them."""
+    center = DECIMATOR_TAPS // 2
+    values = []
+    for k in range((DECIMATOR_TAPS + 1) // 4):
+        t = 2 * k + 1
+        sinc = math.sin(math.pi * t / 2) / (math.pi * t)
+        x = math.pi * t / (center + 1)
+        values.append(sinc * (0.42 + 0.5 * math.cos(x) + 0.08 * math.cos(2 * x)))
+    total = 2 * sum(values)
+    return [lround(v * 0.5 / total * (1 << TAP_BITS)) for v in values]
+
+
+def decimate(samples):
+    """Halves the sample rate of a stream the way decimator_process does, starting from silence."""
+    taps = decimator_taps()
+    center = DECIMATOR_TAPS // 2
+    padded = [0] * (DECIMATOR_TAPS - 1) + samples
+    output = []
+    # the first input sample completes an output sample, as does every second one after it
+    for i in range(0, len(samples), 2):
+        x = padded[i:i + DECIMATOR_TAPS]
+        acc = x[center] << (TAP_BITS - 1)
+        for k, tap in enumerate(taps):
+            acc += tap * (x[center - 2 * k - 1] + x[center + 2 * k + 1])
+        acc = (acc + (1 << (TAP_BITS - 1))) >> TAP_BITS
+        output.append(max(-32768, min(32767, acc)))
+    return output
+
+
+def fft(values):
+    if len(values) == 1:
+        return values
+    even = fft(values[0::2])
+    odd = fft(values[1::2])
+    twiddled = [cmath.exp(-2j * math.pi * k / len(values)) * odd[k] for k in range(len(odd))]
+    return [e + t for e, t in zip(even, twiddled)] + [e - t for e, t in zip(even, twiddled)]
+
+
+def features(frame, filters):
+    """log(LOG_MEL_OFFSET + filter output) of the magnitude spectrum of a frame."""
+    spectrum = fft([s / 32768.0 for s in frame])
+    return [math.log(OFFSET + sum(w * abs(spectrum[first_bin + j]) for j, w in enumerate(weights)))
+            for first_bin, weights in filters]
+
+
+def config_features(rows, sample_rate, fft_size, filter_count):
+    decimation = CAPTURE_RATE // sample_rate
+    if decimation not in (1, 2) or CAPTURE_RATE != sample_rate * decimation:
+        raise ValueError("the sample rate must be the capture rate or half of it")
+    if len(rows[0]) != fft_size * decimation:
+        raise ValueError("the clip has rows of %d samples, not %d" % (len(rows[0]), fft_size * decimation))
+    stream = [s for row in rows for s in row]
+    if decimation == 2:
+        stream = decimate(stream)
+    filters = mel_filters(sample_rate, fft_size, filter_count)
+    lines = ["static const float sample_wav_features[%d][LOG_MEL_FILTERS] = {" % len(rows)]
+    for start in range(0, len(stream), fft_size):
+        row = features(stream[start:start + fft_size], filters)
+        lines.append("\t{ " + ", ".join(float_literal(to_float(v)) for v in row) + " },")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def generate(rows, configs):
+    parts = [
+        "// Generated by tools/generate_prerecorded_features.py from window_break.h, do not edit.",
+        "#pragma once",
+        "",
+        "#include \"log_mel.h\"",
+        "",
+        "// Log-mel features of each row of sample_wav_data at AUDIO_SAMPLE_RATE",
+    ]
+    for index, (sample_rate, fft_size, filter_count) in enumerate(configs):
+        parts.append("%s AUDIO_SAMPLE_RATE == %d && LOG_MEL_FFT_SIZE == %d && LOG_MEL_FILTERS == %d"
+                     % ("#if" if index == 0 else "#elif", sample_rate, fft_size, filter_count))
+        parts.append(config_features(rows, sample_rate, fft_size, filter_count))
+    parts.append("#else")
+    parts.append("#error No prerecorded features for this AUDIO_SAMPLE_RATE, LOG_MEL_FFT_SIZE and LOG_MEL_FILTERS, "
+                 "run tools/generate_prerecorded_features.py")
+    parts.append("#endif")
+    return "\n".join(parts) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--config", nargs=3, type=int, action="append",
+                        metavar=("SAMPLE_RATE", "FFT_SIZE", "FILTERS"),
+                        help="configuration to generate features for, may be repeated "
+                             "(default: 16000 512 80 and 8000 256 80)")
+    parser.add_argument("--clip", default=os.path.join(INC, "window_break.h"),
+                        help="header holding sample_wav_data (default: inc/window_break.h)")
+    parser.add_argument("--output", default=os.path.join(INC, "window_break_features.h"),
+                        help="header to write (default: inc/window_break_features.h)")
+    args = parser.parse_args()
+    configs = [tuple(c) for c in args.config] if args.config else DEFAULT_CONFIGS
+    rows = read_clip(args.clip)
+    with open(args.output, "w", newline="\n") as output:
+        output.write(generate(rows, configs))
+
+
+if __name__ == "__main__":
+    main()